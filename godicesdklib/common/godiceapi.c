@@ -1,8 +1,6 @@
 #include "godiceapi.h"
 #include <string.h>
 #include <stdbool.h>
-#include <float.h>
-#include <math.h>
 
 //#define LOGGING
 
@@ -17,10 +15,9 @@
 
 #define countof(array) (sizeof(array) / sizeof(array[0]))
 
-// Event keys
+// Event keys; "R" and "S" are matched on their first byte alone
+// (see godice_incoming_packet)
 static const char EK_Battery[] = "Bat";
-static const char EK_Roll[] = "R";
-static const char EK_Stable[] = "S";
 static const char EK_FakeStable[] = "FS";
 static const char EK_MoveStable[] = "MS";
 static const char EK_TiltStable[] = "TS";
@@ -93,6 +90,30 @@ static const axis_t D24Values[] = {
 	/* 24 */ {  -20,   60,   20 },
 };
 
+// Face lookup tables (godiceapi_lut.h, from test/gen_face_lut.c): one
+// byte per cube of 2^GODICE_LUT_SHIFT units per axis, 4 KB per table at 4
+// and 512 bytes at 5. 0 classifies every packet by distance.
+#ifndef GODICE_LUT_SHIFT
+#define GODICE_LUT_SHIFT 4
+#endif
+
+// 1: a cell that spans several faces is resolved by distance, so every
+// result matches the classifier exactly. 0: the cell's most common face is
+// returned as is, trading accuracy near face boundaries for a fixed cost.
+#ifndef GODICE_LUT_EXACT
+#define GODICE_LUT_EXACT 1
+#endif
+
+#define GODICE_LUT_AMBIGUOUS 0x80
+#define GODICE_LUT_FACE_MASK 0x1F
+
+#if GODICE_LUT_SHIFT
+	#include "godiceapi_lut.h"
+	#define GODICE_LUT(NAME) NAME
+#else
+	#define GODICE_LUT(NAME) NULL
+#endif
+
 static int identity_transform(int roll) {
 	return roll;
 }
@@ -221,33 +242,38 @@ typedef struct {
 	const int max;
 	const axis_t *values;
 	const int values_num;
+	const uint8_t *lut;  // NULL without lookup tables
 	int (*transform)(int roll);
 } diceType_t;
 
 static diceType_t DiceTypes[] = {
-	{4, D24Values, countof(D24Values), d4_transform},
-	{6, D6Values, countof(D6Values), identity_transform},
-	{8, D24Values, countof(D24Values), d8_transform},
-	{10, D20Values, countof(D20Values), d10_transform},
-	{12, D24Values, countof(D24Values), d12_transform},
-	{20, D20Values, countof(D20Values), identity_transform},
-	{100, D20Values, countof(D20Values), d10x_transform},
+	{4, D24Values, countof(D24Values), GODICE_LUT(D24Lut), d4_transform},
+	{6, D6Values, countof(D6Values), GODICE_LUT(D6Lut), identity_transform},
+	{8, D24Values, countof(D24Values), GODICE_LUT(D24Lut), d8_transform},
+	{10, D20Values, countof(D20Values), GODICE_LUT(D20Lut), d10_transform},
+	{12, D24Values, countof(D24Values), GODICE_LUT(D24Lut), d12_transform},
+	{20, D20Values, countof(D20Values), GODICE_LUT(D20Lut), identity_transform},
+	{100, D20Values, countof(D20Values), GODICE_LUT(D20Lut), d10x_transform},
 };
 
-static float axis_distance(const axis_t *from, const axis_t *to) {
-	float x = (float)to->x - (float)from->x;
-	float y = (float)to->y - (float)from->y;
-	float z = (float)to->z - (float)from->z;
-	return sqrtf(x * x + y * y + z * z);
+// Squared distance in integers. Ranking by it picks the same face as the
+// float sqrtf distance did: sqrtf is monotonic, and the square roots of
+// distinct integers up to 3 * 255^2 stay distinct in float, so ties and
+// order are unchanged (checked over every input in test/).
+static int32_t axis_distance_sq(const axis_t *from, const axis_t *to) {
+	int16_t x = (int16_t)to->x - from->x;
+	int16_t y = (int16_t)to->y - from->y;
+	int16_t z = (int16_t)to->z - from->z;
+	return (int32_t)x * x + (int32_t)y * y + (int32_t)z * z;
 }
 
 static int axis_to_value(const axis_t values[], size_t values_num, const axis_t *axis) {
 	int value = 0;
-	float min_dist = FLT_MAX;
+	int32_t min_dist = INT32_MAX;
 	for (int i = 0; i < values_num; i++) {
-		float dist = axis_distance(axis, &values[i]);
-		log("V[%2d] (%-3d, %-3d, %-3d) dist: %.6f",
-			i + 1, (int)values[i].x, (int)values[i].y, (int)values[i].z, dist);
+		int32_t dist = axis_distance_sq(axis, &values[i]);
+		log("V[%2d] (%-3d, %-3d, %-3d) dist^2: %d",
+			i + 1, (int)values[i].x, (int)values[i].y, (int)values[i].z, (int)dist);
 		if (dist < min_dist) {
 			value = i + 1;
 			min_dist = dist;
@@ -256,14 +282,54 @@ static int axis_to_value(const axis_t values[], size_t values_num, const axis_t
 	return value;
 }
 
-static bool is_event_prefix(const uint8_t *packet, size_t size, const char *key) {
-	size_t key_len = strlen(key);
-	if (size < key_len) {
-		return false;
+// One table read; only cells that straddle a face boundary fall back to
+// the distance search (unless GODICE_LUT_EXACT is 0)
+static int axis_to_face(const diceType_t *dice_type, const axis_t *axis) {
+#if GODICE_LUT_SHIFT
+	const int dim = 256 >> GODICE_LUT_SHIFT;
+	int cell = (((uint8_t)(axis->x + 128) >> GODICE_LUT_SHIFT) * dim +
+				((uint8_t)(axis->y + 128) >> GODICE_LUT_SHIFT)) * dim +
+			   ((uint8_t)(axis->z + 128) >> GODICE_LUT_SHIFT);
+	uint8_t entry = dice_type->lut[cell];
+	if (!GODICE_LUT_EXACT || !(entry & GODICE_LUT_AMBIGUOUS)) {
+		return entry & GODICE_LUT_FACE_MASK;
+	}
+#endif
+	return axis_to_value(dice_type->values, dice_type->values_num, axis);
+}
+
+// The winning face (as axis_to_face() picks it) and the nearest face whose
+// number differs after the transform, for on_dice_stable_ex
+static void axis_rank(const diceType_t *dice_type, const axis_t *axis, godice_stable_info_t *info) {
+	int best = 0;
+	int32_t best_dist = INT32_MAX;
+	int32_t dists[24];
+	for (int i = 0; i < dice_type->values_num; i++) {
+		dists[i] = axis_distance_sq(axis, &dice_type->values[i]);
+		if (dists[i] < best_dist) {
+			best = i;
+			best_dist = dists[i];
+		}
+	}
+	int number = dice_type->transform(best + 1);
+	int runner_up = -1;
+	for (int i = 0; i < dice_type->values_num; i++) {
+		if (dice_type->transform(i + 1) != number && (runner_up < 0 || dists[i] < dists[runner_up])) {
+			runner_up = i;
+		}
 	}
-	return memcmp(packet, key, key_len) == 0;
+	info->number = (uint8_t)number;
+	info->runner_up = (uint8_t)dice_type->transform(runner_up + 1);
+	info->margin = dists[runner_up] - best_dist;
+	info->x = axis->x;
+	info->y = axis->y;
+	info->z = axis->z;
 }
 
+// Whether the packet continues with the rest of KEY, its first byte already
+// matched; the length is a compile-time constant so the compare is inlined
+#define EVENT_REST(KEY) (size >= sizeof(KEY) - 1 && memcmp(packet + 1, KEY + 1, sizeof(KEY) - 2) == 0)
+
 static godice_status_t incoming_roll_packet(const godice_callbacks_t *cb, void *cb_userdata,
 											int dice_id, const uint8_t *packet, size_t size) {
 	if (cb->on_dice_roll == NULL) {
@@ -285,7 +351,7 @@ static godice_status_t incoming_stable_packet(const godice_callbacks_t *cb, void
 								   int dice_id, int dice_max,
 								   const uint8_t *raw_packet, size_t size,
 								   const char *stable_type) {
-	if (cb->on_dice_stable == NULL) {
+	if (cb->on_dice_stable == NULL && cb->on_dice_stable_ex == NULL) {
 		return GODICE_INVALID_CALLBACK;
 	}
 	if (size != sizeof(stablePacket_t)) {
@@ -300,9 +366,22 @@ static godice_status_t incoming_stable_packet(const godice_callbacks_t *cb, void
 	for (int i = 0; i < countof(DiceTypes); i++) {
 		diceType_t *dice_type = &DiceTypes[i];
 		if (dice_max == dice_type->max) {
-			int raw_roll = axis_to_value(dice_type->values, dice_type->values_num, &packet->axis);
-			int transformed_roll = dice_type->transform(raw_roll);
-			cb->on_dice_stable(cb_userdata, dice_id, transformed_roll);
+			if (cb->on_dice_stable != NULL) {
+				int raw_roll = axis_to_face(dice_type, &packet->axis);
+				int transformed_roll = dice_type->transform(raw_roll);
+				cb->on_dice_stable(cb_userdata, dice_id, transformed_roll);
+			}
+			if (cb->on_dice_stable_ex != NULL) {
+				godice_stable_info_t info;
+				switch (stable_type == NULL ? 'S' : *stable_type) {
+					case 'F': info.type = GODICE_FAKE_STABLE; break;
+					case 'T': info.type = GODICE_TILT_STABLE; break;
+					case 'M': info.type = GODICE_MOVE_STABLE; break;
+					default: info.type = GODICE_STABLE; break;
+				}
+				axis_rank(dice_type, &packet->axis, &info);
+				cb->on_dice_stable_ex(cb_userdata, dice_id, &info);
+			}
 			break;
 		}
 	}
@@ -360,38 +439,170 @@ godice_status_t godice_incoming_packet(const godice_callbacks_t *cb, void *cb_us
 	if (cb == NULL) {
 		return GODICE_INVALID_CALLBACK;
 	}
-	if (is_event_prefix(packet, size, EK_Roll)) {
-		return incoming_roll_packet(cb, cb_userdata, dice_id, packet, size);
+	if (size == 0) {
+		return GODICE_INVALID_PACKET;
 	}
-	if (is_event_prefix(packet, size, EK_Tap)) {
-		return GODICE_OK;
+	// One jump on the first byte, then at most two key compares
+	switch (packet[0]) {
+		case 'R':
+			return incoming_roll_packet(cb, cb_userdata, dice_id, packet, size);
+		case 'S':
+			return incoming_stable_packet(cb, cb_userdata,
+										  dice_id, dice_max,
+										  packet, size, NULL);
+		case 'F':
+			if (EVENT_REST(EK_FakeStable)) {
+				return incoming_stable_packet(cb, cb_userdata,
+											  dice_id, dice_max,
+											  packet + 1, size - 1, (char*)packet);
+			}
+			break;
+		case 'M':
+			if (EVENT_REST(EK_MoveStable)) {
+				return incoming_stable_packet(cb, cb_userdata,
+											  dice_id, dice_max,
+											  packet + 1, size - 1, (char*)packet);
+			}
+			break;
+		case 'T':
+			if (EVENT_REST(EK_Tap)) {
+				return GODICE_OK;
+			}
+			if (EVENT_REST(EK_TiltStable)) {
+				return incoming_stable_packet(cb, cb_userdata,
+											  dice_id, dice_max,
+											  packet + 1, size - 1, (char*)packet);
+			}
+			break;
+		case 'D':
+			if (EVENT_REST(EK_DoubleTap)) {
+				return GODICE_OK;
+			}
+			break;
+		case 'B':
+			if (EVENT_REST(EK_Battery)) {
+				return incoming_battery_packet(cb, cb_userdata, dice_id, packet + sizeof(EK_Battery) - 1, size - sizeof(EK_Battery) + 1);
+			}
+			break;
+		case 'C':
+			if (EVENT_REST(EK_Charging)) {
+				return incoming_charging_packet(cb, cb_userdata, dice_id, packet + sizeof(EK_Charging) - 1, size - sizeof(EK_Charging) + 1);
+			}
+			if (EVENT_REST(EK_Color)) {
+				return incoming_color_packet(cb, cb_userdata, dice_id, packet + sizeof(EK_Color) - 1, size - sizeof(EK_Color) + 1);
+			}
+			break;
 	}
-	if (is_event_prefix(packet, size, EK_DoubleTap)) {
-		return GODICE_OK;
+	return GODICE_INVALID_PACKET;
+}
+
+// Batched decoding: the same dispatch as godice_incoming_packet, writing
+// an event instead of calling back. Each returns whether it wrote one.
+
+// A settled "S" takes its face from the lookup table; only FS / TS / MS,
+// where callers weigh the margin, pay for the full ranking
+static bool decode_stable_packet(int dice_max, const uint8_t *raw_packet, size_t size,
+								 godice_stable_type_t stable_type, godice_event_t *event) {
+	if (size != sizeof(stablePacket_t)) {
+		return false;
 	}
-	if (is_event_prefix(packet, size, EK_Battery)) {
-		return incoming_battery_packet(cb, cb_userdata, dice_id, packet + sizeof(EK_Battery) - 1, size - sizeof(EK_Battery) + 1);
+	const stablePacket_t *packet = (const stablePacket_t*)raw_packet;
+	for (int i = 0; i < countof(DiceTypes); i++) {
+		const diceType_t *dice_type = &DiceTypes[i];
+		if (dice_max == dice_type->max) {
+			event->type = GODICE_EVENT_STABLE;
+			event->stable_type = (uint8_t)stable_type;
+			event->x = packet->axis.x;
+			event->y = packet->axis.y;
+			event->z = packet->axis.z;
+			if (stable_type == GODICE_STABLE) {
+				event->value = (uint8_t)dice_type->transform(axis_to_face(dice_type, &packet->axis));
+				return true;
+			}
+			godice_stable_info_t info;
+			axis_rank(dice_type, &packet->axis, &info);
+			event->value = info.number;
+			event->runner_up = info.runner_up;
+			event->margin = info.margin;
+			return true;
+		}
 	}
-	if (is_event_prefix(packet, size, EK_Charging)) {
-		return incoming_charging_packet(cb, cb_userdata, dice_id, packet + sizeof(EK_Charging) - 1, size - sizeof(EK_Charging) + 1);
+	return false;
+}
+
+// One payload byte no greater than max
+static bool decode_value_packet(const uint8_t *packet, size_t size, uint8_t max,
+								godice_event_type_t type, godice_event_t *event) {
+	if (size != 1 || packet[0] > max) {
+		return false;
 	}
-	if (is_event_prefix(packet, size, EK_Stable)) {
-		return incoming_stable_packet(cb, cb_userdata,
-									  dice_id, dice_max,
-									  packet, size, NULL);
+	event->type = (uint8_t)type;
+	event->value = packet[0];
+	return true;
+}
+
+static bool decode_packet(const godice_packet_t *p, godice_event_t *event) {
+	const uint8_t *packet = p->data;
+	size_t size = p->size;
+	if (size == 0) {
+		return false;
 	}
-	if (is_event_prefix(packet, size, EK_FakeStable) ||
-		is_event_prefix(packet, size, EK_TiltStable) ||
-		is_event_prefix(packet, size, EK_MoveStable)) {
+	memset(event, 0, sizeof(*event));
+	event->dice_id = (uint8_t)p->dice_id;
+	switch (packet[0]) {
+		case 'R':
+			event->type = GODICE_EVENT_ROLL;
+			return true;
+		case 'S':
+			return decode_stable_packet(p->dice_max, packet, size, GODICE_STABLE, event);
+		case 'F':
+			return EVENT_REST(EK_FakeStable) &&
+				   decode_stable_packet(p->dice_max, packet + 1, size - 1, GODICE_FAKE_STABLE, event);
+		case 'M':
+			return EVENT_REST(EK_MoveStable) &&
+				   decode_stable_packet(p->dice_max, packet + 1, size - 1, GODICE_MOVE_STABLE, event);
+		case 'T':
+			if (EVENT_REST(EK_Tap)) {
+				event->type = GODICE_EVENT_TAP;
+				return true;
+			}
+			return EVENT_REST(EK_TiltStable) &&
+				   decode_stable_packet(p->dice_max, packet + 1, size - 1, GODICE_TILT_STABLE, event);
+		case 'D':
+			if (EVENT_REST(EK_DoubleTap)) {
+				event->type = GODICE_EVENT_DOUBLE_TAP;
+				return true;
+			}
+			return false;
+		case 'B':
+			return EVENT_REST(EK_Battery) &&
+				   decode_value_packet(packet + sizeof(EK_Battery) - 1, size - sizeof(EK_Battery) + 1,
+									   100, GODICE_EVENT_CHARGE_LEVEL, event);
+		case 'C':
+			if (EVENT_REST(EK_Charging)) {
+				return decode_value_packet(packet + sizeof(EK_Charging) - 1, size - sizeof(EK_Charging) + 1,
+										   1, GODICE_EVENT_CHARGING, event);
+			}
+			return EVENT_REST(EK_Color) &&
+				   decode_value_packet(packet + sizeof(EK_Color) - 1, size - sizeof(EK_Color) + 1,
+									   GODICE_ORANGE, GODICE_EVENT_COLOR, event);
+	}
+	return false;
+}
 
-		return incoming_stable_packet(cb, cb_userdata,
-									  dice_id, dice_max,
-									  packet + 1, size - 1, (char*)packet);
+size_t godice_incoming_packets(const godice_packet_t *packets, size_t count,
+							   godice_event_t *events, size_t max_events, size_t *consumed) {
+	size_t written = 0;
+	size_t i = 0;
+	for (; i < count && written < max_events; i++) {
+		if (decode_packet(&packets[i], &events[written])) {
+			written++;
+		}
 	}
-	if (is_event_prefix(packet, size, EK_Color)) {
-		return incoming_color_packet(cb, cb_userdata, dice_id, packet + sizeof(EK_Color) - 1, size - sizeof(EK_Color) + 1);
+	if (consumed != NULL) {
+		*consumed = i;
 	}
-	return GODICE_INVALID_PACKET;
+	return written;
 }
 
 godice_status_t godice_init_packet(uint8_t *buffer, size_t buffer_size, size_t *written_size,
@@ -69,14 +69,65 @@ GODICE_ENUM_BEGIN(godice_color_t)
 	GODICE_ORANGE = 5,
 GODICE_ENUM_END(godice_color_t)
 
+GODICE_ENUM_BEGIN(godice_stable_type_t)
+	GODICE_STABLE = 0,       // "S": the die settled flat
+	GODICE_FAKE_STABLE = 1,  // "FS"
+	GODICE_TILT_STABLE = 2,  // "TS": resting tilted, e.g. leaning on a coin
+	GODICE_MOVE_STABLE = 3,  // "MS"
+GODICE_ENUM_END(godice_stable_type_t)
+
+// Everything behind a stable result. margin is the squared distance to the
+// nearest face that reads as a different number minus the squared distance
+// to the winning face: 0 is a tie, and for a D6 at rest it is about
+// 8192 * (cos a - sin a) with a the tilt towards that face (~3000 at 30°).
+typedef struct {
+	godice_stable_type_t type;
+	uint8_t number;     // As on_dice_stable reports it
+	uint8_t runner_up;  // Number of the nearest face reading differently
+	int32_t margin;
+	int8_t x, y, z;     // Raw axis from the packet
+} godice_stable_info_t;
+
 typedef struct {
 	void (*on_dice_color)(void *userdata, int dice_id, godice_color_t color);
 	void (*on_dice_stable)(void *userdata, int dice_id, uint8_t number);
 	void (*on_charging_state_chaged)(void *userdata, int dice_id, bool charging);
 	void (*on_charge_level)(void *userdata, int dice_id, uint8_t level);
 	void (*on_dice_roll)(void *userdata, int dice_id);
+	// Optional; called with on_dice_stable, or instead of it when that is NULL
+	void (*on_dice_stable_ex)(void *userdata, int dice_id, const godice_stable_info_t *info);
 } godice_callbacks_t;
 
+// Batched decoding (godice_incoming_packets): what a packet decoded to
+GODICE_ENUM_BEGIN(godice_event_type_t)
+	GODICE_EVENT_ROLL = 0,
+	GODICE_EVENT_STABLE = 1,        // value: number; stable_type and axis as for on_dice_stable_ex, runner_up and margin for FS / TS / MS only
+	GODICE_EVENT_COLOR = 2,         // value: godice_color_t
+	GODICE_EVENT_CHARGE_LEVEL = 3,  // value: percentage
+	GODICE_EVENT_CHARGING = 4,      // value: 1 charging, 0 not
+	GODICE_EVENT_TAP = 5,
+	GODICE_EVENT_DOUBLE_TAP = 6,
+GODICE_ENUM_END(godice_event_type_t)
+
+// One notification to decode, as received from a die
+typedef struct {
+	int dice_id;
+	int dice_max;
+	const uint8_t *data;
+	size_t size;
+} godice_packet_t;
+
+// One decoded event (12 bytes); fields a type does not use are 0
+typedef struct {
+	uint8_t type;         // godice_event_type_t
+	uint8_t dice_id;
+	uint8_t value;
+	uint8_t stable_type;  // godice_stable_type_t
+	uint8_t runner_up;
+	int8_t x, y, z;
+	int32_t margin;
+} godice_event_t;
+
 typedef struct {
 	uint8_t number_of_blinks;
 	uint8_t light_on_duration_10ms;
@@ -91,6 +142,18 @@ typedef struct {
 godice_status_t godice_incoming_packet(const godice_callbacks_t *cb, void *cb_userdata,
 									   int dice_id, int dice_max, const uint8_t *packet, size_t size);
 
+// Decodes packets from any number of dice into events, in order, without
+// callbacks: BLE handlers can queue raw notifications and the main loop
+// decode them together. Keys, payload checks and faces are those of
+// godice_incoming_packet, and taps are reported too; a plain "S" is read
+// from the face table alone, so it has no runner_up or margin. A packet
+// that is invalid, or a stable from a die type without a face table,
+// produces no event, so there are never more events than packets.
+// Decoding stops when events is full; consumed (may be NULL) receives the
+// number of packets decoded. Returns the number of events written.
+size_t godice_incoming_packets(const godice_packet_t *packets, size_t count,
+							   godice_event_t *events, size_t max_events, size_t *consumed);
+
 godice_status_t godice_init_packet(uint8_t *buffer, size_t buffer_size, size_t *written_size,
 								   int dice_sensitivity, const godice_toggle_leds_t *toggle_leds);
 godice_status_t godice_open_leds_packet(uint8_t *buffer, size_t buffer_size, size_t *written_size,
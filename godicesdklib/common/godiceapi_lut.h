@@ -0,0 +1,892 @@
+// Generated by test/gen_face_lut.c from the face tables in godiceapi.c; do not edit.
+// Regenerate: gen_face_lut 4 5 > godiceapi_lut.h
+
+#if GODICE_LUT_SHIFT == 4
+
+static const uint8_t D6Lut[4096] = {
+	0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84,
+	0x05, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
+	0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82,
+	0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82,
+	0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82,
+	0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82,
+	0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82,
+	0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82,
+	0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82,
+	0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82,
+	0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82,
+	0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82,
+	0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82,
+	0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82,
+	0x05, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
+	0x85, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84,
+	0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x02,
+	0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02,
+	0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02,
+	0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02,
+	0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02,
+	0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02,
+	0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02,
+	0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02,
+	0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02,
+	0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02,
+	0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02,
+	0x05, 0x05, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x02,
+	0x05, 0x85, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x02,
+	0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84,
+	0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x02, 0x02,
+	0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02,
+	0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84,
+	0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02,
+	0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02,
+	0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84,
+	0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x85, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02,
+	0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02,
+	0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84,
+	0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x81, 0x81, 0x81, 0x81, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x81, 0x01, 0x01, 0x81, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x81, 0x81, 0x81, 0x81, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x83, 0x83, 0x83, 0x83, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02,
+	0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02,
+	0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84,
+	0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x81, 0x81, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x81, 0x81, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x83, 0x83, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02,
+	0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02,
+	0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84,
+	0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x84, 0x84, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02,
+	0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02,
+	0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84,
+	0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x84, 0x84, 0x84, 0x84, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x86, 0x86, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x83, 0x83, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02,
+	0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02,
+	0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84,
+	0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x86, 0x86, 0x86, 0x86, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x05, 0x85, 0x83, 0x83, 0x83, 0x83, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02,
+	0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02,
+	0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84,
+	0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x05, 0x85, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02,
+	0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02,
+	0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84,
+	0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x02,
+	0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02,
+	0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84,
+	0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x02, 0x02,
+	0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02,
+	0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84,
+	0x05, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x02,
+	0x05, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x82, 0x02,
+	0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02,
+	0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02,
+	0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02,
+	0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02,
+	0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02,
+	0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02,
+	0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02,
+	0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02,
+	0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02,
+	0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02,
+	0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x02,
+	0x05, 0x85, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x02,
+	0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+	0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82,
+};
+
+static const uint8_t D20Lut[4096] = {
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x85, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x81, 0x81, 0x8d, 0x8d, 0x85, 0x85, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x87, 0x87, 0x81, 0x81, 0x01, 0x01, 0x8d, 0x0d, 0x8d, 0x8d, 0x85, 0x85, 0x05, 0x05,
+	0x87, 0x87, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x8d, 0x0d, 0x0d, 0x0d, 0x8d, 0x8d, 0x85, 0x85,
+	0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x8d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x8d, 0x8d,
+	0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x8d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x8d, 0x8d,
+	0x93, 0x93, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x8d, 0x0d, 0x0d, 0x0d, 0x8d, 0x8d, 0x8b, 0x8b,
+	0x13, 0x13, 0x93, 0x93, 0x81, 0x81, 0x01, 0x01, 0x8d, 0x0d, 0x8d, 0x8d, 0x8b, 0x8b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x93, 0x93, 0x81, 0x81, 0x8d, 0x8d, 0x8b, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x93, 0x8b, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x81, 0x8d, 0x85, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x87, 0x87, 0x81, 0x81, 0x01, 0x8d, 0x8d, 0x8d, 0x85, 0x85, 0x05, 0x05, 0x05,
+	0x07, 0x87, 0x87, 0x81, 0x81, 0x01, 0x01, 0x01, 0x8d, 0x0d, 0x0d, 0x8d, 0x8d, 0x85, 0x85, 0x05,
+	0x87, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x8d, 0x0d, 0x0d, 0x0d, 0x0d, 0x8d, 0x8d, 0x85,
+	0x93, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x8d, 0x0d, 0x0d, 0x0d, 0x0d, 0x8d, 0x8d, 0x8b,
+	0x13, 0x93, 0x93, 0x81, 0x81, 0x01, 0x01, 0x01, 0x8d, 0x0d, 0x0d, 0x8d, 0x8d, 0x8b, 0x8b, 0x0b,
+	0x13, 0x13, 0x13, 0x93, 0x93, 0x81, 0x81, 0x01, 0x8d, 0x8d, 0x8d, 0x8b, 0x8b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x93, 0x81, 0x8d, 0x8b, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x0f, 0x0f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x85, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x81, 0x81, 0x8d, 0x8d, 0x85, 0x85, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x87, 0x87, 0x81, 0x81, 0x01, 0x01, 0x8d, 0x0d, 0x8d, 0x8d, 0x85, 0x85, 0x05, 0x05,
+	0x87, 0x87, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x8d, 0x0d, 0x0d, 0x0d, 0x8d, 0x8d, 0x85, 0x85,
+	0x93, 0x93, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x8d, 0x0d, 0x0d, 0x0d, 0x8d, 0x8d, 0x8b, 0x8b,
+	0x13, 0x13, 0x93, 0x93, 0x81, 0x81, 0x01, 0x01, 0x8d, 0x0d, 0x8d, 0x8d, 0x8b, 0x8b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x93, 0x93, 0x81, 0x81, 0x8d, 0x8d, 0x8b, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x93, 0x8b, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x09, 0x09, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x0f, 0x0f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x0f, 0x0f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x81, 0x8d, 0x85, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x87, 0x07, 0x07, 0x87, 0x87, 0x81, 0x81, 0x01, 0x8d, 0x8d, 0x8d, 0x85, 0x85, 0x05, 0x05, 0x85,
+	0x87, 0x87, 0x87, 0x81, 0x81, 0x01, 0x01, 0x01, 0x8d, 0x0d, 0x0d, 0x8d, 0x8d, 0x85, 0x85, 0x85,
+	0x93, 0x93, 0x93, 0x81, 0x81, 0x01, 0x01, 0x01, 0x8d, 0x0d, 0x0d, 0x8d, 0x8d, 0x8b, 0x8b, 0x8b,
+	0x93, 0x13, 0x13, 0x93, 0x93, 0x81, 0x81, 0x01, 0x8d, 0x8d, 0x8d, 0x8b, 0x8b, 0x0b, 0x0b, 0x8b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x93, 0x81, 0x8d, 0x8b, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x09, 0x09, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x09, 0x09, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x0f, 0x0f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x0f, 0x0f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x87, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05, 0x85,
+	0x87, 0x87, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x85, 0x85, 0x05, 0x05, 0x05, 0x05, 0x85, 0x85,
+	0x91, 0x87, 0x87, 0x07, 0x87, 0x87, 0x81, 0x81, 0x8d, 0x8d, 0x85, 0x85, 0x05, 0x85, 0x85, 0x92,
+	0x91, 0x91, 0x87, 0x87, 0x81, 0x81, 0x01, 0x01, 0x8d, 0x0d, 0x8d, 0x8d, 0x85, 0x85, 0x92, 0x92,
+	0x83, 0x83, 0x93, 0x93, 0x81, 0x81, 0x01, 0x01, 0x8d, 0x0d, 0x8d, 0x8d, 0x8b, 0x8b, 0x84, 0x84,
+	0x83, 0x93, 0x93, 0x13, 0x93, 0x93, 0x81, 0x81, 0x8d, 0x8d, 0x8b, 0x8b, 0x0b, 0x8b, 0x8b, 0x84,
+	0x93, 0x93, 0x13, 0x13, 0x13, 0x13, 0x93, 0x93, 0x8b, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8b, 0x8b,
+	0x93, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x09, 0x09, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x09, 0x09, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x09, 0x09, 0x09, 0x09, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05,
+	0x87, 0x07, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x0f, 0x0f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x05, 0x85,
+	0x87, 0x87, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x0f, 0x0f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x85, 0x85,
+	0x91, 0x87, 0x87, 0x07, 0x07, 0x07, 0x87, 0x8f, 0x8f, 0x85, 0x05, 0x05, 0x05, 0x85, 0x85, 0x92,
+	0x91, 0x91, 0x87, 0x87, 0x07, 0x07, 0x87, 0x8f, 0x8f, 0x85, 0x05, 0x05, 0x85, 0x85, 0x92, 0x92,
+	0x11, 0x91, 0x91, 0x87, 0x87, 0x87, 0x87, 0x81, 0x8d, 0x85, 0x85, 0x85, 0x85, 0x92, 0x92, 0x12,
+	0x11, 0x11, 0x91, 0x91, 0x87, 0x81, 0x81, 0x01, 0x8d, 0x8d, 0x8d, 0x85, 0x92, 0x92, 0x12, 0x12,
+	0x03, 0x03, 0x83, 0x83, 0x93, 0x81, 0x81, 0x01, 0x8d, 0x8d, 0x8d, 0x8b, 0x84, 0x84, 0x04, 0x04,
+	0x03, 0x83, 0x83, 0x93, 0x93, 0x93, 0x93, 0x81, 0x8d, 0x8b, 0x8b, 0x8b, 0x8b, 0x84, 0x84, 0x04,
+	0x83, 0x83, 0x93, 0x93, 0x13, 0x13, 0x93, 0x89, 0x89, 0x8b, 0x0b, 0x0b, 0x8b, 0x8b, 0x84, 0x84,
+	0x83, 0x93, 0x93, 0x13, 0x13, 0x13, 0x93, 0x89, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x8b, 0x8b, 0x84,
+	0x93, 0x93, 0x13, 0x13, 0x13, 0x93, 0x89, 0x09, 0x09, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x8b, 0x8b,
+	0x93, 0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x09, 0x09, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8b,
+	0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x09, 0x09, 0x09, 0x09, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x13, 0x93, 0x89, 0x09, 0x09, 0x09, 0x09, 0x89, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b,
+	0x87, 0x07, 0x07, 0x87, 0x8f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x85, 0x05, 0x05, 0x85,
+	0x87, 0x87, 0x07, 0x07, 0x87, 0x8f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x85, 0x05, 0x05, 0x85, 0x85,
+	0x91, 0x87, 0x87, 0x07, 0x87, 0x8f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x85, 0x05, 0x85, 0x85, 0x92,
+	0x91, 0x91, 0x87, 0x87, 0x07, 0x87, 0x8f, 0x0f, 0x0f, 0x8f, 0x85, 0x05, 0x85, 0x85, 0x92, 0x92,
+	0x11, 0x91, 0x91, 0x87, 0x87, 0x87, 0x8f, 0x0f, 0x0f, 0x8f, 0x85, 0x85, 0x85, 0x92, 0x92, 0x12,
+	0x11, 0x11, 0x91, 0x91, 0x87, 0x87, 0x87, 0x8f, 0x8f, 0x85, 0x85, 0x85, 0x92, 0x92, 0x12, 0x12,
+	0x11, 0x11, 0x11, 0x91, 0x91, 0x87, 0x87, 0x8f, 0x8f, 0x85, 0x85, 0x92, 0x92, 0x12, 0x12, 0x12,
+	0x11, 0x11, 0x11, 0x11, 0x91, 0x91, 0x81, 0x81, 0x8d, 0x8d, 0x92, 0x92, 0x12, 0x12, 0x12, 0x12,
+	0x03, 0x03, 0x03, 0x03, 0x83, 0x83, 0x81, 0x81, 0x8d, 0x8d, 0x84, 0x84, 0x04, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x03, 0x83, 0x83, 0x93, 0x93, 0x89, 0x89, 0x8b, 0x8b, 0x84, 0x84, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x83, 0x83, 0x93, 0x93, 0x93, 0x89, 0x89, 0x8b, 0x8b, 0x8b, 0x84, 0x84, 0x04, 0x04,
+	0x03, 0x83, 0x83, 0x93, 0x93, 0x93, 0x89, 0x09, 0x09, 0x89, 0x8b, 0x8b, 0x8b, 0x84, 0x84, 0x04,
+	0x83, 0x83, 0x93, 0x93, 0x13, 0x93, 0x89, 0x09, 0x09, 0x89, 0x8b, 0x0b, 0x8b, 0x8b, 0x84, 0x84,
+	0x83, 0x93, 0x93, 0x13, 0x93, 0x89, 0x09, 0x09, 0x09, 0x09, 0x89, 0x8b, 0x0b, 0x8b, 0x8b, 0x84,
+	0x93, 0x93, 0x13, 0x13, 0x93, 0x89, 0x09, 0x09, 0x09, 0x09, 0x89, 0x8b, 0x0b, 0x0b, 0x8b, 0x8b,
+	0x93, 0x13, 0x13, 0x93, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x89, 0x8b, 0x0b, 0x0b, 0x8b,
+	0x91, 0x87, 0x87, 0x87, 0x8f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x85, 0x85, 0x85, 0x92,
+	0x91, 0x91, 0x87, 0x87, 0x8f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x85, 0x85, 0x92, 0x92,
+	0x11, 0x91, 0x91, 0x87, 0x87, 0x8f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x85, 0x85, 0x92, 0x92, 0x12,
+	0x11, 0x11, 0x91, 0x91, 0x87, 0x8f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x85, 0x92, 0x92, 0x12, 0x12,
+	0x11, 0x11, 0x11, 0x91, 0x91, 0x87, 0x8f, 0x0f, 0x0f, 0x8f, 0x85, 0x92, 0x92, 0x12, 0x12, 0x12,
+	0x11, 0x11, 0x11, 0x11, 0x91, 0x91, 0x8f, 0x0f, 0x0f, 0x8f, 0x92, 0x92, 0x12, 0x12, 0x12, 0x12,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x91, 0x91, 0x8f, 0x8f, 0x92, 0x92, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x91, 0x81, 0x8f, 0x92, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x81, 0x8d, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x83, 0x89, 0x89, 0x84, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x03, 0x03, 0x83, 0x83, 0x89, 0x09, 0x09, 0x89, 0x84, 0x84, 0x04, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x03, 0x83, 0x83, 0x93, 0x89, 0x09, 0x09, 0x89, 0x8b, 0x84, 0x84, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x83, 0x83, 0x93, 0x89, 0x09, 0x09, 0x09, 0x09, 0x89, 0x8b, 0x84, 0x84, 0x04, 0x04,
+	0x03, 0x83, 0x83, 0x93, 0x93, 0x89, 0x09, 0x09, 0x09, 0x09, 0x89, 0x8b, 0x8b, 0x84, 0x84, 0x04,
+	0x83, 0x83, 0x93, 0x93, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x89, 0x8b, 0x8b, 0x84, 0x84,
+	0x83, 0x93, 0x93, 0x93, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x89, 0x8b, 0x8b, 0x8b, 0x84,
+	0x91, 0x8a, 0x8a, 0x8a, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x82, 0x82, 0x92, 0x92,
+	0x91, 0x91, 0x8a, 0x8a, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x82, 0x82, 0x92, 0x12,
+	0x11, 0x91, 0x91, 0x8a, 0x8a, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x82, 0x82, 0x92, 0x12, 0x12,
+	0x11, 0x11, 0x91, 0x91, 0x8a, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x82, 0x92, 0x92, 0x12, 0x12,
+	0x11, 0x11, 0x11, 0x91, 0x91, 0x8a, 0x8c, 0x0c, 0x0c, 0x8c, 0x82, 0x92, 0x92, 0x12, 0x12, 0x12,
+	0x11, 0x11, 0x11, 0x11, 0x91, 0x91, 0x8c, 0x0c, 0x0c, 0x8c, 0x92, 0x92, 0x12, 0x12, 0x12, 0x12,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x91, 0x91, 0x8c, 0x8c, 0x92, 0x92, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x91, 0x91, 0x8c, 0x92, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x83, 0x84, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x83, 0x86, 0x86, 0x84, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x03, 0x03, 0x83, 0x83, 0x86, 0x06, 0x06, 0x86, 0x84, 0x84, 0x04, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x03, 0x83, 0x83, 0x90, 0x86, 0x06, 0x06, 0x86, 0x8e, 0x84, 0x84, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x83, 0x83, 0x90, 0x86, 0x06, 0x06, 0x06, 0x06, 0x86, 0x8e, 0x84, 0x84, 0x04, 0x04,
+	0x03, 0x83, 0x83, 0x90, 0x90, 0x86, 0x06, 0x06, 0x06, 0x06, 0x86, 0x8e, 0x8e, 0x84, 0x84, 0x04,
+	0x83, 0x83, 0x90, 0x90, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x86, 0x8e, 0x8e, 0x84, 0x84,
+	0x83, 0x90, 0x90, 0x90, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x86, 0x8e, 0x8e, 0x8e, 0x84,
+	0x8a, 0x0a, 0x0a, 0x8a, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x82, 0x02, 0x82, 0x82,
+	0x8a, 0x8a, 0x0a, 0x0a, 0x8a, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x82, 0x02, 0x02, 0x82, 0x92,
+	0x91, 0x8a, 0x8a, 0x0a, 0x8a, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x82, 0x02, 0x82, 0x82, 0x92,
+	0x91, 0x91, 0x8a, 0x8a, 0x0a, 0x8a, 0x8c, 0x0c, 0x0c, 0x8c, 0x82, 0x02, 0x82, 0x82, 0x92, 0x12,
+	0x11, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8c, 0x0c, 0x0c, 0x8c, 0x82, 0x82, 0x82, 0x92, 0x92, 0x12,
+	0x11, 0x11, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8c, 0x8c, 0x82, 0x82, 0x82, 0x92, 0x92, 0x12, 0x12,
+	0x11, 0x11, 0x11, 0x91, 0x91, 0x8a, 0x8a, 0x8c, 0x8c, 0x82, 0x82, 0x92, 0x92, 0x12, 0x12, 0x12,
+	0x11, 0x11, 0x11, 0x11, 0x91, 0x91, 0x88, 0x88, 0x94, 0x94, 0x92, 0x92, 0x12, 0x12, 0x12, 0x12,
+	0x03, 0x03, 0x03, 0x03, 0x83, 0x83, 0x88, 0x88, 0x94, 0x94, 0x84, 0x84, 0x04, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x03, 0x83, 0x83, 0x90, 0x90, 0x86, 0x86, 0x8e, 0x8e, 0x84, 0x84, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x83, 0x83, 0x90, 0x90, 0x90, 0x86, 0x86, 0x8e, 0x8e, 0x8e, 0x84, 0x84, 0x04, 0x04,
+	0x03, 0x83, 0x83, 0x90, 0x90, 0x90, 0x86, 0x06, 0x06, 0x86, 0x8e, 0x8e, 0x8e, 0x84, 0x84, 0x04,
+	0x83, 0x83, 0x90, 0x90, 0x10, 0x90, 0x86, 0x06, 0x06, 0x86, 0x8e, 0x0e, 0x8e, 0x8e, 0x84, 0x84,
+	0x83, 0x90, 0x90, 0x10, 0x90, 0x86, 0x06, 0x06, 0x06, 0x06, 0x86, 0x8e, 0x0e, 0x8e, 0x8e, 0x84,
+	0x90, 0x90, 0x10, 0x10, 0x90, 0x86, 0x06, 0x06, 0x06, 0x06, 0x86, 0x8e, 0x0e, 0x0e, 0x8e, 0x8e,
+	0x90, 0x10, 0x10, 0x90, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x86, 0x8e, 0x0e, 0x0e, 0x8e,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x82,
+	0x8a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x0c, 0x0c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x82,
+	0x8a, 0x8a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x0c, 0x0c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x82, 0x92,
+	0x91, 0x8a, 0x8a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x82, 0x82, 0x92,
+	0x91, 0x91, 0x8a, 0x8a, 0x0a, 0x0a, 0x8a, 0x8c, 0x8c, 0x82, 0x02, 0x02, 0x82, 0x82, 0x92, 0x12,
+	0x11, 0x91, 0x91, 0x8a, 0x8a, 0x8a, 0x8a, 0x88, 0x82, 0x82, 0x82, 0x82, 0x82, 0x92, 0x92, 0x12,
+	0x11, 0x11, 0x91, 0x91, 0x8a, 0x88, 0x88, 0x08, 0x94, 0x94, 0x94, 0x82, 0x92, 0x92, 0x12, 0x12,
+	0x03, 0x03, 0x83, 0x83, 0x90, 0x88, 0x88, 0x08, 0x94, 0x94, 0x94, 0x8e, 0x84, 0x84, 0x04, 0x04,
+	0x03, 0x83, 0x83, 0x90, 0x90, 0x90, 0x90, 0x88, 0x94, 0x8e, 0x8e, 0x8e, 0x8e, 0x84, 0x84, 0x04,
+	0x83, 0x83, 0x90, 0x90, 0x10, 0x10, 0x90, 0x86, 0x86, 0x8e, 0x0e, 0x0e, 0x8e, 0x8e, 0x84, 0x84,
+	0x83, 0x90, 0x90, 0x10, 0x10, 0x10, 0x90, 0x86, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x8e, 0x8e, 0x84,
+	0x90, 0x90, 0x10, 0x10, 0x10, 0x90, 0x86, 0x06, 0x06, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x8e, 0x8e,
+	0x90, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x06, 0x06, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x8e,
+	0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x06, 0x06, 0x06, 0x06, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x06, 0x06, 0x06, 0x06, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x0c, 0x0c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x0c, 0x0c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x82,
+	0x8a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x82,
+	0x8a, 0x8a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8a, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x82, 0x82,
+	0x91, 0x8a, 0x8a, 0x0a, 0x8a, 0x8a, 0x88, 0x88, 0x94, 0x94, 0x82, 0x82, 0x02, 0x82, 0x82, 0x92,
+	0x91, 0x91, 0x8a, 0x8a, 0x88, 0x88, 0x08, 0x08, 0x94, 0x14, 0x94, 0x94, 0x82, 0x82, 0x92, 0x92,
+	0x83, 0x83, 0x90, 0x90, 0x88, 0x88, 0x08, 0x08, 0x94, 0x14, 0x94, 0x94, 0x8e, 0x8e, 0x84, 0x84,
+	0x83, 0x90, 0x90, 0x10, 0x90, 0x90, 0x88, 0x88, 0x94, 0x94, 0x8e, 0x8e, 0x0e, 0x8e, 0x8e, 0x84,
+	0x90, 0x90, 0x10, 0x10, 0x10, 0x10, 0x90, 0x90, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x8e, 0x8e,
+	0x90, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x8e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x06, 0x06, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x06, 0x06, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x06, 0x06, 0x06, 0x06, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x0c, 0x0c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x0c, 0x0c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8a, 0x88, 0x82, 0x82, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x8a, 0x0a, 0x0a, 0x8a, 0x8a, 0x88, 0x88, 0x08, 0x94, 0x94, 0x94, 0x82, 0x82, 0x02, 0x02, 0x82,
+	0x8a, 0x8a, 0x8a, 0x88, 0x88, 0x08, 0x08, 0x08, 0x94, 0x14, 0x14, 0x94, 0x94, 0x82, 0x82, 0x82,
+	0x90, 0x90, 0x90, 0x88, 0x88, 0x08, 0x08, 0x08, 0x94, 0x14, 0x14, 0x94, 0x94, 0x8e, 0x8e, 0x8e,
+	0x90, 0x10, 0x10, 0x90, 0x90, 0x88, 0x88, 0x08, 0x94, 0x94, 0x94, 0x8e, 0x8e, 0x0e, 0x0e, 0x8e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x90, 0x88, 0x94, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x06, 0x06, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x06, 0x06, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x0c, 0x0c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8a, 0x82, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8a, 0x88, 0x88, 0x94, 0x94, 0x82, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x8a, 0x8a, 0x88, 0x88, 0x08, 0x08, 0x94, 0x14, 0x94, 0x94, 0x82, 0x82, 0x02, 0x02,
+	0x8a, 0x8a, 0x88, 0x88, 0x08, 0x08, 0x08, 0x08, 0x94, 0x14, 0x14, 0x14, 0x94, 0x94, 0x82, 0x82,
+	0x90, 0x90, 0x88, 0x88, 0x08, 0x08, 0x08, 0x08, 0x94, 0x14, 0x14, 0x14, 0x94, 0x94, 0x8e, 0x8e,
+	0x10, 0x10, 0x90, 0x90, 0x88, 0x88, 0x08, 0x08, 0x94, 0x14, 0x94, 0x94, 0x8e, 0x8e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x90, 0x90, 0x88, 0x88, 0x94, 0x94, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x90, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x06, 0x06, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8a, 0x88, 0x94, 0x82, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x8a, 0x8a, 0x88, 0x88, 0x08, 0x94, 0x94, 0x94, 0x82, 0x82, 0x02, 0x02, 0x02,
+	0x0a, 0x8a, 0x8a, 0x88, 0x88, 0x08, 0x08, 0x08, 0x94, 0x14, 0x14, 0x94, 0x94, 0x82, 0x82, 0x02,
+	0x8a, 0x88, 0x88, 0x08, 0x08, 0x08, 0x08, 0x08, 0x94, 0x14, 0x14, 0x14, 0x14, 0x14, 0x94, 0x94,
+	0x90, 0x88, 0x88, 0x08, 0x08, 0x08, 0x08, 0x08, 0x94, 0x14, 0x14, 0x14, 0x14, 0x94, 0x94, 0x8e,
+	0x10, 0x90, 0x90, 0x88, 0x88, 0x08, 0x08, 0x08, 0x94, 0x14, 0x14, 0x94, 0x94, 0x8e, 0x8e, 0x0e,
+	0x10, 0x10, 0x10, 0x90, 0x90, 0x88, 0x88, 0x08, 0x94, 0x94, 0x94, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x90, 0x88, 0x94, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8c, 0x8c, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8a, 0x82, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x0a, 0x0a, 0x8a, 0x8a, 0x88, 0x88, 0x94, 0x94, 0x82, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x8a, 0x8a, 0x88, 0x88, 0x08, 0x08, 0x94, 0x14, 0x94, 0x94, 0x82, 0x82, 0x02, 0x02,
+	0x8a, 0x8a, 0x88, 0x88, 0x08, 0x08, 0x08, 0x08, 0x94, 0x14, 0x14, 0x14, 0x94, 0x94, 0x94, 0x82,
+	0x88, 0x88, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x94, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x94,
+	0x88, 0x88, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x94, 0x14, 0x14, 0x14, 0x14, 0x14, 0x94, 0x94,
+	0x90, 0x90, 0x88, 0x88, 0x08, 0x08, 0x08, 0x08, 0x94, 0x14, 0x14, 0x14, 0x94, 0x94, 0x8e, 0x8e,
+	0x10, 0x10, 0x90, 0x90, 0x88, 0x88, 0x08, 0x08, 0x94, 0x14, 0x94, 0x94, 0x8e, 0x8e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x90, 0x90, 0x88, 0x88, 0x94, 0x94, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x90, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x86, 0x86, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,
+};
+
+static const uint8_t D24Lut[4096] = {
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x86, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x92, 0x83, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x92, 0x92, 0x8d, 0x8d, 0x84, 0x84, 0x83, 0x83, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x92, 0x92, 0x8d, 0x8d, 0x0d, 0x0d, 0x04, 0x04, 0x84, 0x84, 0x83, 0x83, 0x03, 0x03,
+	0x92, 0x92, 0x8d, 0x8d, 0x0d, 0x0d, 0x0d, 0x0d, 0x04, 0x04, 0x04, 0x04, 0x84, 0x84, 0x83, 0x83,
+	0x88, 0x8d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x84,
+	0x88, 0x88, 0x8d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x84,
+	0x08, 0x88, 0x88, 0x8d, 0x0d, 0x0d, 0x0d, 0x0d, 0x04, 0x04, 0x04, 0x04, 0x84, 0x84, 0x89, 0x89,
+	0x08, 0x08, 0x88, 0x88, 0x8d, 0x0d, 0x0d, 0x0d, 0x04, 0x04, 0x84, 0x84, 0x89, 0x89, 0x09, 0x09,
+	0x08, 0x08, 0x08, 0x88, 0x88, 0x8d, 0x0d, 0x0d, 0x84, 0x84, 0x89, 0x89, 0x09, 0x09, 0x09, 0x09,
+	0x08, 0x08, 0x08, 0x08, 0x88, 0x88, 0x8d, 0x8d, 0x89, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x08, 0x08, 0x08, 0x08, 0x88, 0x88, 0x91, 0x91, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x08, 0x08, 0x88, 0x88, 0x91, 0x91, 0x11, 0x91, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x88, 0x88, 0x91, 0x91, 0x11, 0x11, 0x11, 0x91, 0x98, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x86, 0x86, 0x8b, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x86, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x92, 0x8d, 0x84, 0x83, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x92, 0x92, 0x8d, 0x8d, 0x0d, 0x04, 0x84, 0x84, 0x83, 0x83, 0x03, 0x03, 0x03,
+	0x92, 0x92, 0x92, 0x8d, 0x8d, 0x0d, 0x0d, 0x0d, 0x04, 0x04, 0x04, 0x84, 0x84, 0x83, 0x83, 0x83,
+	0x97, 0x88, 0x8d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x84, 0x8a,
+	0x88, 0x88, 0x88, 0x8d, 0x0d, 0x0d, 0x0d, 0x0d, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x84, 0x8a,
+	0x88, 0x08, 0x88, 0x88, 0x8d, 0x0d, 0x0d, 0x0d, 0x04, 0x04, 0x04, 0x84, 0x84, 0x89, 0x89, 0x89,
+	0x08, 0x08, 0x08, 0x88, 0x88, 0x8d, 0x0d, 0x0d, 0x04, 0x84, 0x84, 0x89, 0x89, 0x09, 0x09, 0x09,
+	0x08, 0x08, 0x08, 0x08, 0x88, 0x88, 0x8d, 0x8d, 0x84, 0x89, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x8d, 0x8d, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x08, 0x08, 0x08, 0x88, 0x88, 0x91, 0x91, 0x91, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x08, 0x88, 0x88, 0x91, 0x91, 0x11, 0x11, 0x91, 0x98, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x88, 0x91, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x98, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x12, 0x12, 0x12, 0x12, 0x92, 0x86, 0x86, 0x06, 0x8b, 0x8b, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x86, 0x86, 0x8b, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x86, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x92, 0x83, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x92, 0x12, 0x12, 0x12, 0x92, 0x92, 0x8d, 0x8d, 0x84, 0x84, 0x83, 0x83, 0x03, 0x03, 0x03, 0x03,
+	0x97, 0x92, 0x92, 0x92, 0x8d, 0x8d, 0x0d, 0x0d, 0x04, 0x04, 0x84, 0x84, 0x83, 0x83, 0x83, 0x8a,
+	0x17, 0x97, 0x88, 0x8d, 0x0d, 0x0d, 0x0d, 0x0d, 0x04, 0x04, 0x04, 0x04, 0x84, 0x84, 0x8a, 0x0a,
+	0x97, 0x88, 0x88, 0x88, 0x8d, 0x0d, 0x0d, 0x0d, 0x04, 0x04, 0x04, 0x04, 0x84, 0x84, 0x8a, 0x0a,
+	0x88, 0x88, 0x08, 0x88, 0x88, 0x8d, 0x0d, 0x0d, 0x04, 0x04, 0x84, 0x84, 0x89, 0x89, 0x89, 0x8a,
+	0x88, 0x08, 0x08, 0x08, 0x88, 0x88, 0x8d, 0x0d, 0x84, 0x84, 0x89, 0x89, 0x09, 0x09, 0x09, 0x89,
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x88, 0x8d, 0x89, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x08, 0x08, 0x08, 0x08, 0x88, 0x88, 0x91, 0x91, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x08, 0x08, 0x88, 0x88, 0x91, 0x91, 0x11, 0x91, 0x98, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x88, 0x88, 0x91, 0x91, 0x11, 0x11, 0x11, 0x11, 0x98, 0x98, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x91, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x98, 0x98, 0x89, 0x09, 0x09, 0x09, 0x09,
+	0x12, 0x12, 0x12, 0x92, 0x86, 0x86, 0x06, 0x06, 0x8b, 0x0b, 0x8b, 0x8b, 0x83, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x92, 0x86, 0x86, 0x06, 0x8b, 0x8b, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x86, 0x86, 0x8b, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x86, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x92, 0x92, 0x12, 0x12, 0x12, 0x92, 0x92, 0x8d, 0x84, 0x83, 0x83, 0x03, 0x03, 0x03, 0x03, 0x83,
+	0x97, 0x97, 0x92, 0x92, 0x92, 0x8d, 0x8d, 0x0d, 0x04, 0x84, 0x84, 0x83, 0x83, 0x83, 0x8a, 0x8a,
+	0x17, 0x17, 0x97, 0x88, 0x8d, 0x0d, 0x0d, 0x0d, 0x04, 0x04, 0x04, 0x84, 0x84, 0x8a, 0x0a, 0x0a,
+	0x17, 0x97, 0x88, 0x88, 0x88, 0x8d, 0x0d, 0x0d, 0x04, 0x04, 0x04, 0x84, 0x84, 0x8a, 0x0a, 0x0a,
+	0x97, 0x88, 0x88, 0x08, 0x88, 0x88, 0x8d, 0x0d, 0x04, 0x84, 0x84, 0x89, 0x89, 0x89, 0x8a, 0x8a,
+	0x88, 0x88, 0x08, 0x08, 0x08, 0x88, 0x88, 0x8d, 0x84, 0x89, 0x89, 0x09, 0x09, 0x09, 0x89, 0x89,
+	0x88, 0x08, 0x08, 0x08, 0x08, 0x88, 0x88, 0x91, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x08, 0x08, 0x08, 0x88, 0x88, 0x91, 0x91, 0x91, 0x98, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x08, 0x88, 0x88, 0x91, 0x91, 0x11, 0x11, 0x11, 0x98, 0x98, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x88, 0x91, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x98, 0x98, 0x89, 0x09, 0x09, 0x09, 0x09,
+	0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x98, 0x98, 0x89, 0x09, 0x09, 0x09,
+	0x12, 0x12, 0x92, 0x86, 0x86, 0x06, 0x06, 0x06, 0x8b, 0x0b, 0x0b, 0x8b, 0x8b, 0x83, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x92, 0x86, 0x86, 0x06, 0x06, 0x8b, 0x0b, 0x8b, 0x8b, 0x83, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x92, 0x86, 0x86, 0x06, 0x8b, 0x8b, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x86, 0x86, 0x8b, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x92, 0x12, 0x12, 0x12, 0x12, 0x12, 0x92, 0x86, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+	0x97, 0x92, 0x92, 0x12, 0x12, 0x12, 0x92, 0x92, 0x83, 0x83, 0x03, 0x03, 0x03, 0x03, 0x83, 0x8a,
+	0x17, 0x97, 0x97, 0x92, 0x92, 0x92, 0x8d, 0x8d, 0x84, 0x84, 0x83, 0x83, 0x83, 0x8a, 0x8a, 0x0a,
+	0x17, 0x17, 0x17, 0x97, 0x88, 0x8d, 0x0d, 0x0d, 0x04, 0x04, 0x84, 0x84, 0x8a, 0x0a, 0x0a, 0x0a,
+	0x17, 0x17, 0x97, 0x88, 0x88, 0x88, 0x8d, 0x0d, 0x04, 0x04, 0x84, 0x84, 0x8a, 0x0a, 0x0a, 0x0a,
+	0x17, 0x97, 0x88, 0x88, 0x08, 0x88, 0x88, 0x8d, 0x84, 0x84, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x0a,
+	0x97, 0x88, 0x88, 0x08, 0x08, 0x08, 0x88, 0x8d, 0x89, 0x89, 0x09, 0x09, 0x09, 0x89, 0x89, 0x8a,
+	0x88, 0x88, 0x08, 0x08, 0x88, 0x88, 0x91, 0x91, 0x98, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09, 0x89,
+	0x88, 0x08, 0x88, 0x88, 0x91, 0x91, 0x11, 0x11, 0x98, 0x98, 0x89, 0x09, 0x09, 0x09, 0x09, 0x09,
+	0x88, 0x88, 0x91, 0x91, 0x11, 0x11, 0x11, 0x11, 0x98, 0x98, 0x98, 0x89, 0x09, 0x09, 0x09, 0x09,
+	0x91, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x98, 0x98, 0x89, 0x09, 0x09, 0x09,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x18, 0x98, 0x98, 0x89, 0x09, 0x09,
+	0x12, 0x92, 0x86, 0x86, 0x06, 0x06, 0x06, 0x06, 0x8b, 0x0b, 0x0b, 0x0b, 0x8b, 0x8b, 0x83, 0x03,
+	0x12, 0x12, 0x92, 0x86, 0x86, 0x06, 0x06, 0x06, 0x8b, 0x0b, 0x0b, 0x8b, 0x8b, 0x83, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x92, 0x86, 0x86, 0x06, 0x06, 0x8b, 0x0b, 0x8b, 0x8b, 0x83, 0x03, 0x03, 0x03,
+	0x12, 0x12, 0x12, 0x12, 0x92, 0x86, 0x86, 0x06, 0x8b, 0x8b, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x03,
+	0x92, 0x92, 0x12, 0x12, 0x12, 0x92, 0x86, 0x86, 0x8b, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x03, 0x83,
+	0x97, 0x97, 0x92, 0x92, 0x12, 0x12, 0x92, 0x86, 0x8b, 0x83, 0x03, 0x03, 0x03, 0x83, 0x8a, 0x8a,
+	0x17, 0x17, 0x97, 0x97, 0x92, 0x92, 0x92, 0x8d, 0x84, 0x83, 0x83, 0x83, 0x8a, 0x8a, 0x0a, 0x0a,
+	0x17, 0x17, 0x17, 0x17, 0x97, 0x88, 0x8d, 0x0d, 0x04, 0x84, 0x84, 0x8a, 0x0a, 0x0a, 0x0a, 0x0a,
+	0x17, 0x17, 0x17, 0x97, 0x88, 0x88, 0x88, 0x8d, 0x04, 0x84, 0x84, 0x8a, 0x0a, 0x0a, 0x0a, 0x0a,
+	0x17, 0x17, 0x97, 0x88, 0x88, 0x08, 0x88, 0x88, 0x84, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x0a, 0x0a,
+	0x17, 0x97, 0x88, 0x88, 0x08, 0x88, 0x88, 0x91, 0x98, 0x89, 0x09, 0x09, 0x89, 0x89, 0x8a, 0x8a,
+	0x97, 0x88, 0x88, 0x88, 0x88, 0x91, 0x91, 0x11, 0x98, 0x98, 0x89, 0x09, 0x09, 0x09, 0x89, 0x89,
+	0x88, 0x88, 0x88, 0x91, 0x91, 0x11, 0x11, 0x11, 0x98, 0x98, 0x98, 0x89, 0x09, 0x09, 0x09, 0x09,
+	0x88, 0x91, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x98, 0x98, 0x89, 0x09, 0x09, 0x09,
+	0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x18, 0x98, 0x98, 0x89, 0x09, 0x09,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x18, 0x18, 0x98, 0x98, 0x89, 0x09,
+	0x92, 0x86, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8b, 0x8b, 0x83,
+	0x12, 0x92, 0x86, 0x86, 0x06, 0x06, 0x06, 0x06, 0x8b, 0x0b, 0x0b, 0x0b, 0x8b, 0x8b, 0x83, 0x03,
+	0x12, 0x12, 0x92, 0x86, 0x86, 0x06, 0x06, 0x06, 0x8b, 0x0b, 0x0b, 0x8b, 0x8b, 0x83, 0x03, 0x03,
+	0x92, 0x12, 0x12, 0x92, 0x86, 0x86, 0x06, 0x06, 0x8b, 0x0b, 0x8b, 0x8b, 0x83, 0x03, 0x03, 0x03,
+	0x97, 0x92, 0x92, 0x12, 0x92, 0x86, 0x86, 0x06, 0x8b, 0x8b, 0x8b, 0x83, 0x03, 0x03, 0x83, 0x8a,
+	0x17, 0x97, 0x97, 0x92, 0x92, 0x92, 0x86, 0x86, 0x8b, 0x8b, 0x83, 0x03, 0x83, 0x8a, 0x8a, 0x0a,
+	0x17, 0x17, 0x17, 0x97, 0x97, 0x92, 0x92, 0x86, 0x8b, 0x83, 0x83, 0x8a, 0x8a, 0x0a, 0x0a, 0x0a,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x97, 0x88, 0x8d, 0x84, 0x84, 0x8a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+	0x17, 0x17, 0x17, 0x17, 0x97, 0x88, 0x88, 0x88, 0x84, 0x84, 0x8a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+	0x17, 0x17, 0x17, 0x97, 0x88, 0x88, 0x88, 0x88, 0x98, 0x89, 0x89, 0x8a, 0x8a, 0x0a, 0x0a, 0x0a,
+	0x17, 0x17, 0x97, 0x88, 0x88, 0x88, 0x91, 0x91, 0x98, 0x98, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x0a,
+	0x17, 0x97, 0x88, 0x88, 0x91, 0x91, 0x11, 0x11, 0x98, 0x98, 0x98, 0x89, 0x09, 0x89, 0x89, 0x8a,
+	0x97, 0x97, 0x91, 0x91, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x98, 0x98, 0x89, 0x09, 0x09, 0x89,
+	0x91, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x18, 0x98, 0x98, 0x89, 0x09, 0x09,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x18, 0x18, 0x98, 0x98, 0x89, 0x09,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x18, 0x18, 0x18, 0x98, 0x98, 0x89,
+	0x86, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8b, 0x8b,
+	0x92, 0x86, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x8b, 0x0b, 0x0b, 0x0b, 0x0b, 0x8b, 0x8b, 0x83,
+	0x12, 0x92, 0x86, 0x86, 0x06, 0x06, 0x06, 0x06, 0x8b, 0x0b, 0x0b, 0x0b, 0x8b, 0x8b, 0x83, 0x03,
+	0x92, 0x92, 0x92, 0x86, 0x86, 0x06, 0x06, 0x06, 0x8b, 0x0b, 0x0b, 0x8b, 0x8b, 0x83, 0x03, 0x83,
+	0x97, 0x97, 0x92, 0x92, 0x86, 0x86, 0x06, 0x06, 0x8b, 0x0b, 0x8b, 0x8b, 0x83, 0x83, 0x8a, 0x8a,
+	0x17, 0x17, 0x97, 0x97, 0x92, 0x86, 0x86, 0x06, 0x8b, 0x8b, 0x8b, 0x83, 0x8a, 0x8a, 0x0a, 0x0a,
+	0x17, 0x17, 0x17, 0x17, 0x97, 0x97, 0x86, 0x86, 0x8b, 0x8b, 0x8a, 0x8a, 0x0a, 0x0a, 0x0a, 0x0a,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x97, 0x86, 0x84, 0x8a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+	0x17, 0x17, 0x17, 0x17, 0x17, 0x97, 0x88, 0x88, 0x84, 0x8a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a,
+	0x17, 0x17, 0x17, 0x17, 0x97, 0x88, 0x88, 0x91, 0x98, 0x98, 0x8a, 0x8a, 0x0a, 0x0a, 0x0a, 0x0a,
+	0x17, 0x17, 0x17, 0x97, 0x97, 0x91, 0x91, 0x11, 0x98, 0x98, 0x98, 0x89, 0x8a, 0x8a, 0x0a, 0x0a,
+	0x17, 0x17, 0x97, 0x91, 0x91, 0x11, 0x11, 0x11, 0x98, 0x18, 0x98, 0x98, 0x89, 0x89, 0x8a, 0x8a,
+	0x97, 0x97, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x18, 0x98, 0x98, 0x89, 0x89, 0x89,
+	0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x18, 0x18, 0x98, 0x98, 0x89, 0x09,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x18, 0x18, 0x18, 0x98, 0x98, 0x89,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x18, 0x18, 0x18, 0x18, 0x98, 0x98,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+	0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+	0x81, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+	0x8f, 0x8f, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x82, 0x82,
+	0x0f, 0x8f, 0x8f, 0x81, 0x81, 0x01, 0x01, 0x01, 0x94, 0x94, 0x94, 0x94, 0x94, 0x82, 0x82, 0x02,
+	0x0f, 0x0f, 0x0f, 0x8f, 0x8f, 0x81, 0x81, 0x01, 0x94, 0x94, 0x94, 0x94, 0x82, 0x02, 0x02, 0x02,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x90, 0x90, 0x81, 0x94, 0x93, 0x93, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x90, 0x90, 0x93, 0x93, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x8f, 0x96, 0x85, 0x85, 0x82, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x8f, 0x96, 0x8e, 0x87, 0x85, 0x85, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x0f, 0x0f, 0x0f, 0x8f, 0x8f, 0x8e, 0x8e, 0x0e, 0x07, 0x87, 0x87, 0x82, 0x82, 0x02, 0x02, 0x02,
+	0x0f, 0x0f, 0x8f, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x87, 0x87, 0x82, 0x82, 0x02,
+	0x8f, 0x8f, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x82, 0x82,
+	0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x87,
+	0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87,
+	0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+	0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x14, 0x14, 0x94, 0x94,
+	0x8f, 0x81, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x94, 0x94, 0x94, 0x82,
+	0x0f, 0x8f, 0x90, 0x90, 0x81, 0x81, 0x01, 0x01, 0x94, 0x14, 0x94, 0x94, 0x93, 0x93, 0x82, 0x02,
+	0x0f, 0x0f, 0x8f, 0x90, 0x90, 0x90, 0x81, 0x81, 0x94, 0x94, 0x93, 0x93, 0x93, 0x82, 0x02, 0x02,
+	0x0f, 0x0f, 0x0f, 0x8f, 0x90, 0x90, 0x90, 0x90, 0x93, 0x93, 0x93, 0x93, 0x82, 0x02, 0x02, 0x02,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x90, 0x90, 0x90, 0x93, 0x93, 0x93, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x8f, 0x8f, 0x96, 0x96, 0x85, 0x85, 0x85, 0x82, 0x02, 0x02, 0x02, 0x02,
+	0x0f, 0x0f, 0x0f, 0x8f, 0x8f, 0x96, 0x96, 0x96, 0x85, 0x85, 0x85, 0x85, 0x82, 0x02, 0x02, 0x02,
+	0x0f, 0x0f, 0x8f, 0x8f, 0x96, 0x96, 0x8e, 0x8e, 0x87, 0x87, 0x85, 0x85, 0x85, 0x82, 0x02, 0x02,
+	0x0f, 0x8f, 0x8f, 0x96, 0x8e, 0x8e, 0x0e, 0x0e, 0x07, 0x07, 0x87, 0x87, 0x85, 0x85, 0x82, 0x02,
+	0x8f, 0x8f, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x82, 0x82,
+	0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87,
+	0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x94,
+	0x90, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x14, 0x94, 0x94, 0x93,
+	0x90, 0x90, 0x90, 0x81, 0x81, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x94, 0x94, 0x93, 0x93, 0x93,
+	0x8f, 0x90, 0x90, 0x90, 0x90, 0x81, 0x81, 0x01, 0x94, 0x94, 0x94, 0x93, 0x93, 0x93, 0x93, 0x82,
+	0x0f, 0x8f, 0x90, 0x90, 0x10, 0x90, 0x90, 0x81, 0x94, 0x93, 0x93, 0x13, 0x93, 0x93, 0x82, 0x02,
+	0x0f, 0x0f, 0x8f, 0x90, 0x90, 0x10, 0x90, 0x90, 0x93, 0x93, 0x13, 0x93, 0x93, 0x82, 0x02, 0x02,
+	0x0f, 0x0f, 0x0f, 0x8f, 0x90, 0x90, 0x90, 0x95, 0x8c, 0x93, 0x93, 0x93, 0x82, 0x02, 0x02, 0x02,
+	0x0f, 0x0f, 0x0f, 0x8f, 0x8f, 0x96, 0x96, 0x95, 0x8c, 0x85, 0x85, 0x85, 0x82, 0x02, 0x02, 0x02,
+	0x0f, 0x0f, 0x8f, 0x8f, 0x96, 0x16, 0x96, 0x96, 0x85, 0x85, 0x05, 0x85, 0x85, 0x82, 0x02, 0x02,
+	0x0f, 0x8f, 0x8f, 0x96, 0x16, 0x96, 0x96, 0x8e, 0x87, 0x85, 0x85, 0x05, 0x85, 0x85, 0x82, 0x02,
+	0x8f, 0x8f, 0x96, 0x96, 0x96, 0x8e, 0x8e, 0x0e, 0x07, 0x87, 0x87, 0x85, 0x85, 0x85, 0x85, 0x82,
+	0x8f, 0x96, 0x96, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x87, 0x87, 0x85, 0x85, 0x85,
+	0x96, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x85,
+	0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87,
+	0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+	0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x14, 0x14, 0x94, 0x94,
+	0x90, 0x90, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x94, 0x94, 0x93, 0x93,
+	0x90, 0x10, 0x90, 0x90, 0x81, 0x81, 0x01, 0x01, 0x94, 0x14, 0x94, 0x94, 0x93, 0x93, 0x13, 0x93,
+	0x90, 0x90, 0x10, 0x10, 0x90, 0x90, 0x81, 0x81, 0x94, 0x94, 0x93, 0x93, 0x13, 0x13, 0x93, 0x93,
+	0x8f, 0x90, 0x90, 0x10, 0x10, 0x10, 0x90, 0x81, 0x94, 0x93, 0x13, 0x13, 0x13, 0x93, 0x93, 0x82,
+	0x0f, 0x8f, 0x90, 0x90, 0x10, 0x90, 0x90, 0x95, 0x8c, 0x93, 0x93, 0x13, 0x93, 0x93, 0x82, 0x02,
+	0x0f, 0x0f, 0x8f, 0x90, 0x90, 0x90, 0x95, 0x15, 0x0c, 0x8c, 0x93, 0x93, 0x93, 0x82, 0x02, 0x02,
+	0x0f, 0x0f, 0x8f, 0x8f, 0x96, 0x96, 0x95, 0x15, 0x0c, 0x8c, 0x85, 0x85, 0x85, 0x82, 0x02, 0x02,
+	0x0f, 0x8f, 0x8f, 0x96, 0x16, 0x96, 0x96, 0x95, 0x8c, 0x85, 0x85, 0x05, 0x85, 0x85, 0x82, 0x02,
+	0x8f, 0x8f, 0x96, 0x16, 0x16, 0x16, 0x96, 0x95, 0x8c, 0x85, 0x05, 0x05, 0x05, 0x85, 0x85, 0x82,
+	0x8f, 0x96, 0x16, 0x16, 0x96, 0x96, 0x8e, 0x8e, 0x87, 0x87, 0x85, 0x85, 0x05, 0x05, 0x85, 0x85,
+	0x96, 0x16, 0x96, 0x96, 0x8e, 0x8e, 0x0e, 0x0e, 0x07, 0x07, 0x87, 0x87, 0x85, 0x85, 0x05, 0x85,
+	0x96, 0x96, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x85, 0x85,
+	0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87,
+	0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x94,
+	0x90, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x14, 0x94, 0x94, 0x93,
+	0x10, 0x90, 0x90, 0x81, 0x81, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x94, 0x94, 0x93, 0x93, 0x13,
+	0x10, 0x10, 0x10, 0x90, 0x90, 0x81, 0x81, 0x01, 0x94, 0x94, 0x94, 0x93, 0x93, 0x13, 0x13, 0x13,
+	0x90, 0x10, 0x10, 0x10, 0x10, 0x90, 0x90, 0x81, 0x94, 0x93, 0x93, 0x13, 0x13, 0x13, 0x13, 0x93,
+	0x90, 0x90, 0x10, 0x10, 0x10, 0x90, 0x90, 0x95, 0x8c, 0x93, 0x93, 0x13, 0x13, 0x13, 0x93, 0x93,
+	0x8f, 0x90, 0x90, 0x10, 0x90, 0x90, 0x95, 0x15, 0x0c, 0x8c, 0x93, 0x93, 0x13, 0x93, 0x93, 0x82,
+	0x0f, 0x8f, 0x90, 0x90, 0x90, 0x95, 0x15, 0x15, 0x0c, 0x0c, 0x8c, 0x93, 0x93, 0x93, 0x82, 0x02,
+	0x0f, 0x8f, 0x8f, 0x96, 0x96, 0x95, 0x15, 0x15, 0x0c, 0x0c, 0x8c, 0x85, 0x85, 0x85, 0x82, 0x02,
+	0x8f, 0x8f, 0x96, 0x16, 0x96, 0x96, 0x95, 0x15, 0x0c, 0x8c, 0x85, 0x85, 0x05, 0x85, 0x85, 0x82,
+	0x8f, 0x96, 0x16, 0x16, 0x16, 0x96, 0x96, 0x95, 0x8c, 0x85, 0x85, 0x05, 0x05, 0x05, 0x85, 0x85,
+	0x96, 0x16, 0x16, 0x16, 0x16, 0x96, 0x96, 0x8e, 0x87, 0x85, 0x85, 0x05, 0x05, 0x05, 0x05, 0x85,
+	0x16, 0x16, 0x16, 0x96, 0x96, 0x8e, 0x8e, 0x0e, 0x07, 0x87, 0x87, 0x85, 0x85, 0x05, 0x05, 0x05,
+	0x16, 0x96, 0x96, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x87, 0x87, 0x85, 0x85, 0x05,
+	0x96, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x85,
+	0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87,
+	0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x14, 0x14, 0x94, 0x94,
+	0x90, 0x90, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x94, 0x94, 0x93, 0x93,
+	0x10, 0x10, 0x90, 0x90, 0x81, 0x81, 0x01, 0x01, 0x94, 0x14, 0x94, 0x94, 0x93, 0x93, 0x13, 0x13,
+	0x10, 0x10, 0x10, 0x10, 0x90, 0x90, 0x81, 0x81, 0x94, 0x94, 0x93, 0x93, 0x13, 0x13, 0x13, 0x13,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x90, 0x95, 0x8c, 0x93, 0x93, 0x13, 0x13, 0x13, 0x13, 0x13,
+	0x90, 0x10, 0x10, 0x10, 0x90, 0x90, 0x95, 0x15, 0x0c, 0x8c, 0x93, 0x93, 0x13, 0x13, 0x13, 0x93,
+	0x90, 0x90, 0x10, 0x90, 0x90, 0x95, 0x15, 0x15, 0x0c, 0x0c, 0x8c, 0x93, 0x93, 0x13, 0x93, 0x93,
+	0x8f, 0x90, 0x90, 0x90, 0x95, 0x15, 0x15, 0x15, 0x0c, 0x0c, 0x0c, 0x8c, 0x93, 0x93, 0x93, 0x82,
+	0x8f, 0x8f, 0x96, 0x96, 0x95, 0x15, 0x15, 0x15, 0x0c, 0x0c, 0x0c, 0x8c, 0x85, 0x85, 0x85, 0x82,
+	0x8f, 0x96, 0x16, 0x96, 0x96, 0x95, 0x15, 0x15, 0x0c, 0x0c, 0x8c, 0x85, 0x85, 0x05, 0x85, 0x85,
+	0x96, 0x16, 0x16, 0x16, 0x96, 0x96, 0x95, 0x15, 0x0c, 0x8c, 0x85, 0x85, 0x05, 0x05, 0x05, 0x85,
+	0x16, 0x16, 0x16, 0x16, 0x16, 0x96, 0x96, 0x95, 0x8c, 0x85, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x16, 0x16, 0x16, 0x16, 0x96, 0x96, 0x8e, 0x8e, 0x87, 0x87, 0x85, 0x85, 0x05, 0x05, 0x05, 0x05,
+	0x16, 0x16, 0x96, 0x96, 0x8e, 0x8e, 0x0e, 0x0e, 0x07, 0x07, 0x87, 0x87, 0x85, 0x85, 0x05, 0x05,
+	0x96, 0x96, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x85, 0x85,
+	0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87,
+	0x90, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x14, 0x94, 0x94, 0x93,
+	0x10, 0x90, 0x90, 0x81, 0x81, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x94, 0x94, 0x93, 0x93, 0x13,
+	0x10, 0x10, 0x10, 0x90, 0x90, 0x81, 0x81, 0x01, 0x94, 0x94, 0x94, 0x93, 0x93, 0x13, 0x13, 0x13,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x90, 0x81, 0x81, 0x8c, 0x94, 0x93, 0x13, 0x13, 0x13, 0x13, 0x13,
+	0x10, 0x10, 0x10, 0x10, 0x90, 0x90, 0x95, 0x15, 0x0c, 0x8c, 0x93, 0x93, 0x13, 0x13, 0x13, 0x13,
+	0x10, 0x10, 0x10, 0x90, 0x90, 0x95, 0x15, 0x15, 0x0c, 0x0c, 0x8c, 0x93, 0x93, 0x13, 0x13, 0x13,
+	0x90, 0x10, 0x90, 0x90, 0x95, 0x15, 0x15, 0x15, 0x0c, 0x0c, 0x0c, 0x8c, 0x93, 0x93, 0x13, 0x93,
+	0x90, 0x90, 0x90, 0x95, 0x15, 0x15, 0x15, 0x15, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x93, 0x93, 0x93,
+	0x8f, 0x96, 0x96, 0x95, 0x15, 0x15, 0x15, 0x15, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x85, 0x85, 0x85,
+	0x96, 0x16, 0x96, 0x96, 0x95, 0x15, 0x15, 0x15, 0x0c, 0x0c, 0x0c, 0x8c, 0x85, 0x85, 0x05, 0x85,
+	0x16, 0x16, 0x16, 0x96, 0x96, 0x95, 0x15, 0x15, 0x0c, 0x0c, 0x8c, 0x85, 0x85, 0x05, 0x05, 0x05,
+	0x16, 0x16, 0x16, 0x16, 0x96, 0x96, 0x95, 0x15, 0x0c, 0x8c, 0x85, 0x85, 0x05, 0x05, 0x05, 0x05,
+	0x16, 0x16, 0x16, 0x16, 0x16, 0x96, 0x95, 0x95, 0x8c, 0x8c, 0x85, 0x05, 0x05, 0x05, 0x05, 0x05,
+	0x16, 0x16, 0x16, 0x96, 0x96, 0x8e, 0x8e, 0x0e, 0x07, 0x87, 0x87, 0x85, 0x85, 0x05, 0x05, 0x05,
+	0x16, 0x96, 0x96, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x87, 0x87, 0x85, 0x85, 0x05,
+	0x96, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x85,
+	0x90, 0x90, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x14, 0x94, 0x94, 0x93, 0x93,
+	0x10, 0x10, 0x90, 0x90, 0x81, 0x81, 0x01, 0x01, 0x94, 0x14, 0x94, 0x94, 0x93, 0x93, 0x13, 0x13,
+	0x10, 0x10, 0x10, 0x10, 0x90, 0x90, 0x81, 0x81, 0x94, 0x94, 0x93, 0x93, 0x13, 0x13, 0x13, 0x13,
+	0x10, 0x10, 0x10, 0x10, 0x90, 0x90, 0x95, 0x95, 0x8c, 0x8c, 0x93, 0x93, 0x13, 0x13, 0x13, 0x13,
+	0x10, 0x10, 0x10, 0x90, 0x90, 0x95, 0x15, 0x15, 0x0c, 0x0c, 0x8c, 0x93, 0x93, 0x13, 0x13, 0x13,
+	0x10, 0x10, 0x90, 0x90, 0x95, 0x15, 0x15, 0x15, 0x0c, 0x0c, 0x0c, 0x8c, 0x93, 0x93, 0x13, 0x13,
+	0x10, 0x90, 0x90, 0x95, 0x15, 0x15, 0x15, 0x15, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x93, 0x93, 0x13,
+	0x90, 0x90, 0x95, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x93, 0x93,
+	0x96, 0x96, 0x95, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x85, 0x85,
+	0x16, 0x96, 0x96, 0x95, 0x15, 0x15, 0x15, 0x15, 0x0c, 0x0c, 0x0c, 0x0c, 0x8c, 0x85, 0x85, 0x05,
+	0x16, 0x16, 0x96, 0x96, 0x95, 0x15, 0x15, 0x15, 0x0c, 0x0c, 0x0c, 0x8c, 0x85, 0x85, 0x05, 0x05,
+	0x16, 0x16, 0x16, 0x96, 0x96, 0x95, 0x15, 0x15, 0x0c, 0x0c, 0x8c, 0x85, 0x85, 0x05, 0x05, 0x05,
+	0x16, 0x16, 0x16, 0x16, 0x96, 0x96, 0x95, 0x95, 0x8c, 0x8c, 0x85, 0x85, 0x05, 0x05, 0x05, 0x05,
+	0x16, 0x16, 0x16, 0x16, 0x96, 0x96, 0x8e, 0x8e, 0x87, 0x87, 0x85, 0x85, 0x05, 0x05, 0x05, 0x05,
+	0x16, 0x16, 0x96, 0x96, 0x8e, 0x8e, 0x0e, 0x0e, 0x07, 0x07, 0x87, 0x87, 0x85, 0x85, 0x05, 0x05,
+	0x96, 0x96, 0x8e, 0x8e, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x07, 0x87, 0x87, 0x85, 0x85,
+};
+
+#elif GODICE_LUT_SHIFT == 5
+
+static const uint8_t D6Lut[512] = {
+	0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81,
+	0x81, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x05, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
+	0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82,
+	0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82, 0x05, 0x81, 0x01, 0x01, 0x01, 0x01, 0x81, 0x82,
+	0x05, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x85, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x81, 0x81, 0x81, 0x81, 0x82, 0x02, 0x05, 0x05, 0x81, 0x01, 0x01, 0x81, 0x82, 0x02,
+	0x05, 0x05, 0x81, 0x01, 0x01, 0x81, 0x82, 0x02, 0x05, 0x05, 0x81, 0x81, 0x81, 0x81, 0x82, 0x02,
+	0x05, 0x85, 0x83, 0x83, 0x83, 0x83, 0x82, 0x02, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x84, 0x04, 0x04, 0x84, 0x02, 0x02, 0x05, 0x05, 0x05, 0x81, 0x81, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x81, 0x81, 0x82, 0x02, 0x02, 0x05, 0x05, 0x85, 0x83, 0x83, 0x82, 0x02, 0x02,
+	0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x84, 0x04, 0x04, 0x84, 0x02, 0x02, 0x05, 0x05, 0x05, 0x84, 0x84, 0x02, 0x02, 0x02,
+	0x05, 0x05, 0x05, 0x85, 0x82, 0x02, 0x02, 0x02, 0x05, 0x05, 0x85, 0x03, 0x03, 0x82, 0x02, 0x02,
+	0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x05, 0x84, 0x04, 0x04, 0x04, 0x04, 0x84, 0x02,
+	0x05, 0x05, 0x84, 0x84, 0x84, 0x84, 0x02, 0x02, 0x05, 0x05, 0x85, 0x86, 0x86, 0x82, 0x02, 0x02,
+	0x05, 0x05, 0x85, 0x86, 0x06, 0x82, 0x02, 0x02, 0x05, 0x05, 0x85, 0x83, 0x83, 0x82, 0x02, 0x02,
+	0x05, 0x85, 0x03, 0x03, 0x03, 0x03, 0x82, 0x02, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x84, 0x05, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x02,
+	0x05, 0x85, 0x86, 0x86, 0x86, 0x86, 0x82, 0x02, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x82, 0x02,
+	0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x82, 0x02, 0x05, 0x85, 0x86, 0x06, 0x06, 0x06, 0x82, 0x02,
+	0x05, 0x85, 0x83, 0x83, 0x83, 0x83, 0x82, 0x02, 0x85, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x82,
+	0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82,
+	0x85, 0x86, 0x06, 0x06, 0x06, 0x06, 0x06, 0x82, 0x85, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82,
+};
+
+static const uint8_t D20Lut[512] = {
+	0x07, 0x07, 0x07, 0x87, 0x85, 0x05, 0x05, 0x05, 0x07, 0x07, 0x07, 0x87, 0x85, 0x05, 0x05, 0x05,
+	0x07, 0x87, 0x87, 0x81, 0x8d, 0x85, 0x85, 0x05, 0x87, 0x81, 0x81, 0x01, 0x8d, 0x8d, 0x8d, 0x85,
+	0x93, 0x81, 0x81, 0x01, 0x8d, 0x8d, 0x8d, 0x8b, 0x13, 0x93, 0x93, 0x81, 0x8d, 0x8b, 0x8b, 0x0b,
+	0x13, 0x13, 0x13, 0x93, 0x8b, 0x0b, 0x0b, 0x0b, 0x13, 0x13, 0x13, 0x93, 0x8b, 0x0b, 0x0b, 0x0b,
+	0x07, 0x07, 0x87, 0x8f, 0x8f, 0x85, 0x05, 0x05, 0x07, 0x07, 0x07, 0x87, 0x85, 0x05, 0x05, 0x05,
+	0x07, 0x07, 0x87, 0x87, 0x85, 0x85, 0x05, 0x05, 0x87, 0x87, 0x81, 0x81, 0x8d, 0x8d, 0x85, 0x85,
+	0x93, 0x93, 0x81, 0x81, 0x8d, 0x8d, 0x8b, 0x8b, 0x13, 0x13, 0x93, 0x93, 0x8b, 0x8b, 0x0b, 0x0b,
+	0x13, 0x13, 0x13, 0x93, 0x8b, 0x0b, 0x0b, 0x0b, 0x13, 0x13, 0x93, 0x89, 0x89, 0x8b, 0x0b, 0x0b,
+	0x07, 0x07, 0x87, 0x8f, 0x8f, 0x85, 0x05, 0x05, 0x87, 0x07, 0x87, 0x8f, 0x8f, 0x85, 0x05, 0x85,
+	0x87, 0x87, 0x07, 0x87, 0x85, 0x05, 0x85, 0x85, 0x91, 0x87, 0x87, 0x81, 0x8d, 0x85, 0x85, 0x92,
+	0x83, 0x93, 0x93, 0x81, 0x8d, 0x8b, 0x8b, 0x84, 0x93, 0x93, 0x13, 0x93, 0x8b, 0x0b, 0x8b, 0x8b,
+	0x93, 0x13, 0x93, 0x89, 0x89, 0x8b, 0x0b, 0x8b, 0x13, 0x13, 0x93, 0x89, 0x89, 0x8b, 0x0b, 0x0b,
+	0x87, 0x87, 0x8f, 0x0f, 0x0f, 0x8f, 0x85, 0x85, 0x91, 0x87, 0x87, 0x8f, 0x8f, 0x85, 0x85, 0x92,
+	0x91, 0x91, 0x87, 0x8f, 0x8f, 0x85, 0x92, 0x92, 0x11, 0x91, 0x91, 0x87, 0x85, 0x92, 0x92, 0x12,
+	0x03, 0x83, 0x83, 0x93, 0x8b, 0x84, 0x84, 0x04, 0x83, 0x83, 0x93, 0x89, 0x89, 0x8b, 0x84, 0x84,
+	0x83, 0x93, 0x93, 0x89, 0x89, 0x8b, 0x8b, 0x84, 0x93, 0x93, 0x89, 0x09, 0x09, 0x89, 0x8b, 0x8b,
+	0x8a, 0x8a, 0x8c, 0x0c, 0x0c, 0x8c, 0x82, 0x92, 0x91, 0x8a, 0x8a, 0x8c, 0x8c, 0x82, 0x82, 0x92,
+	0x91, 0x91, 0x8a, 0x8c, 0x8c, 0x82, 0x92, 0x92, 0x11, 0x91, 0x91, 0x8a, 0x82, 0x92, 0x92, 0x12,
+	0x03, 0x83, 0x83, 0x90, 0x8e, 0x84, 0x84, 0x04, 0x83, 0x83, 0x90, 0x86, 0x86, 0x8e, 0x84, 0x84,
+	0x83, 0x90, 0x90, 0x86, 0x86, 0x8e, 0x8e, 0x84, 0x90, 0x90, 0x86, 0x06, 0x06, 0x86, 0x8e, 0x8e,
+	0x0a, 0x0a, 0x8a, 0x8c, 0x8c, 0x82, 0x02, 0x82, 0x8a, 0x0a, 0x8a, 0x8c, 0x8c, 0x82, 0x02, 0x82,
+	0x8a, 0x8a, 0x0a, 0x8a, 0x82, 0x02, 0x82, 0x82, 0x91, 0x8a, 0x8a, 0x88, 0x94, 0x82, 0x82, 0x92,
+	0x83, 0x90, 0x90, 0x88, 0x94, 0x8e, 0x8e, 0x84, 0x90, 0x90, 0x10, 0x90, 0x8e, 0x0e, 0x8e, 0x8e,
+	0x90, 0x10, 0x90, 0x86, 0x86, 0x8e, 0x0e, 0x8e, 0x10, 0x10, 0x90, 0x86, 0x86, 0x8e, 0x0e, 0x0e,
+	0x0a, 0x0a, 0x8a, 0x8c, 0x8c, 0x82, 0x02, 0x02, 0x0a, 0x0a, 0x0a, 0x8a, 0x82, 0x02, 0x02, 0x02,
+	0x0a, 0x0a, 0x8a, 0x8a, 0x82, 0x82, 0x02, 0x02, 0x8a, 0x8a, 0x88, 0x88, 0x94, 0x94, 0x82, 0x82,
+	0x90, 0x90, 0x88, 0x88, 0x94, 0x94, 0x8e, 0x8e, 0x10, 0x10, 0x90, 0x90, 0x8e, 0x8e, 0x0e, 0x0e,
+	0x10, 0x10, 0x10, 0x90, 0x8e, 0x0e, 0x0e, 0x0e, 0x10, 0x10, 0x90, 0x86, 0x86, 0x8e, 0x0e, 0x0e,
+	0x0a, 0x0a, 0x0a, 0x8a, 0x82, 0x02, 0x02, 0x02, 0x0a, 0x0a, 0x0a, 0x8a, 0x82, 0x02, 0x02, 0x02,
+	0x0a, 0x8a, 0x8a, 0x88, 0x94, 0x82, 0x82, 0x02, 0x8a, 0x88, 0x88, 0x08, 0x94, 0x94, 0x94, 0x94,
+	0x90, 0x88, 0x88, 0x08, 0x94, 0x94, 0x94, 0x8e, 0x10, 0x90, 0x90, 0x88, 0x94, 0x8e, 0x8e, 0x0e,
+	0x10, 0x10, 0x10, 0x90, 0x8e, 0x0e, 0x0e, 0x0e, 0x10, 0x10, 0x10, 0x90, 0x8e, 0x0e, 0x0e, 0x0e,
+};
+
+static const uint8_t D24Lut[512] = {
+	0x12, 0x12, 0x92, 0x92, 0x83, 0x83, 0x03, 0x03, 0x12, 0x12, 0x12, 0x92, 0x83, 0x03, 0x03, 0x03,
+	0x12, 0x92, 0x92, 0x8d, 0x84, 0x83, 0x83, 0x03, 0x92, 0x8d, 0x8d, 0x0d, 0x04, 0x84, 0x84, 0x83,
+	0x88, 0x8d, 0x8d, 0x0d, 0x04, 0x84, 0x84, 0x89, 0x08, 0x88, 0x8d, 0x8d, 0x84, 0x89, 0x89, 0x09,
+	0x08, 0x88, 0x88, 0x91, 0x89, 0x09, 0x09, 0x09, 0x88, 0x91, 0x91, 0x91, 0x89, 0x89, 0x09, 0x09,
+	0x12, 0x92, 0x92, 0x86, 0x8b, 0x83, 0x83, 0x03, 0x12, 0x12, 0x92, 0x92, 0x83, 0x83, 0x03, 0x03,
+	0x92, 0x12, 0x92, 0x92, 0x83, 0x83, 0x03, 0x83, 0x97, 0x92, 0x8d, 0x8d, 0x84, 0x84, 0x83, 0x8a,
+	0x97, 0x88, 0x8d, 0x8d, 0x84, 0x84, 0x89, 0x8a, 0x88, 0x08, 0x88, 0x8d, 0x89, 0x89, 0x09, 0x89,
+	0x88, 0x88, 0x91, 0x91, 0x89, 0x89, 0x09, 0x09, 0x91, 0x91, 0x11, 0x11, 0x98, 0x89, 0x89, 0x09,
+	0x92, 0x92, 0x86, 0x06, 0x8b, 0x8b, 0x83, 0x83, 0x12, 0x92, 0x92, 0x86, 0x8b, 0x83, 0x83, 0x03,
+	0x92, 0x92, 0x92, 0x92, 0x83, 0x83, 0x83, 0x83, 0x97, 0x97, 0x92, 0x8d, 0x84, 0x83, 0x8a, 0x8a,
+	0x97, 0x97, 0x88, 0x8d, 0x84, 0x89, 0x8a, 0x8a, 0x97, 0x88, 0x88, 0x91, 0x89, 0x89, 0x89, 0x89,
+	0x88, 0x91, 0x91, 0x11, 0x98, 0x89, 0x89, 0x09, 0x91, 0x11, 0x11, 0x11, 0x98, 0x98, 0x89, 0x89,
+	0x92, 0x86, 0x06, 0x06, 0x8b, 0x0b, 0x8b, 0x83, 0x92, 0x92, 0x86, 0x06, 0x8b, 0x8b, 0x83, 0x83,
+	0x97, 0x92, 0x92, 0x86, 0x8b, 0x83, 0x83, 0x8a, 0x17, 0x97, 0x97, 0x86, 0x8b, 0x8a, 0x8a, 0x0a,
+	0x17, 0x97, 0x97, 0x88, 0x98, 0x8a, 0x8a, 0x0a, 0x97, 0x97, 0x91, 0x91, 0x98, 0x89, 0x89, 0x8a,
+	0x91, 0x91, 0x11, 0x11, 0x98, 0x98, 0x89, 0x89, 0x11, 0x11, 0x11, 0x11, 0x98, 0x18, 0x98, 0x89,
+	0x81, 0x01, 0x01, 0x01, 0x94, 0x94, 0x94, 0x94, 0x81, 0x81, 0x01, 0x01, 0x94, 0x94, 0x94, 0x94,
+	0x8f, 0x8f, 0x81, 0x81, 0x94, 0x94, 0x82, 0x82, 0x0f, 0x8f, 0x8f, 0x90, 0x93, 0x82, 0x82, 0x02,
+	0x0f, 0x8f, 0x8f, 0x96, 0x85, 0x82, 0x82, 0x02, 0x8f, 0x8f, 0x8e, 0x8e, 0x87, 0x87, 0x82, 0x82,
+	0x8e, 0x8e, 0x0e, 0x0e, 0x07, 0x07, 0x87, 0x87, 0x0e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x87,
+	0x81, 0x01, 0x01, 0x01, 0x94, 0x14, 0x14, 0x94, 0x90, 0x81, 0x81, 0x01, 0x94, 0x94, 0x94, 0x93,
+	0x8f, 0x90, 0x90, 0x81, 0x94, 0x93, 0x93, 0x82, 0x8f, 0x8f, 0x90, 0x95, 0x8c, 0x93, 0x82, 0x82,
+	0x8f, 0x8f, 0x96, 0x95, 0x8c, 0x85, 0x82, 0x82, 0x8f, 0x96, 0x96, 0x8e, 0x87, 0x85, 0x85, 0x82,
+	0x96, 0x8e, 0x8e, 0x0e, 0x07, 0x87, 0x87, 0x85, 0x8e, 0x0e, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x87,
+	0x81, 0x81, 0x01, 0x01, 0x94, 0x14, 0x94, 0x94, 0x90, 0x90, 0x81, 0x81, 0x94, 0x94, 0x93, 0x93,
+	0x90, 0x10, 0x90, 0x95, 0x8c, 0x93, 0x13, 0x93, 0x8f, 0x90, 0x95, 0x95, 0x8c, 0x8c, 0x93, 0x82,
+	0x8f, 0x96, 0x95, 0x95, 0x8c, 0x8c, 0x85, 0x82, 0x96, 0x16, 0x96, 0x95, 0x8c, 0x85, 0x05, 0x85,
+	0x96, 0x96, 0x8e, 0x8e, 0x87, 0x87, 0x85, 0x85, 0x8e, 0x8e, 0x0e, 0x0e, 0x07, 0x07, 0x87, 0x87,
+	0x90, 0x81, 0x81, 0x01, 0x94, 0x94, 0x94, 0x93, 0x10, 0x90, 0x90, 0x81, 0x94, 0x93, 0x93, 0x13,
+	0x10, 0x90, 0x95, 0x95, 0x8c, 0x8c, 0x93, 0x13, 0x90, 0x95, 0x95, 0x15, 0x0c, 0x8c, 0x8c, 0x93,
+	0x96, 0x95, 0x95, 0x15, 0x0c, 0x8c, 0x8c, 0x85, 0x16, 0x96, 0x95, 0x95, 0x8c, 0x8c, 0x85, 0x05,
+	0x16, 0x96, 0x96, 0x8e, 0x87, 0x85, 0x85, 0x05, 0x96, 0x8e, 0x8e, 0x0e, 0x07, 0x87, 0x87, 0x85,
+};
+
+#else
+#error "No generated tables for this GODICE_LUT_SHIFT"
+#endif
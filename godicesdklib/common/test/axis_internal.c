@@ -0,0 +1,122 @@
+// Builds godiceapi.c into the test so its static classifier can be called
+// directly, next to the float classifier it replaced as the reference, and
+// keeps the linear prefix parser the first-byte table replaced.
+#include <float.h>
+#include <math.h>
+#include "../godiceapi.c"
+
+static const axis_t *table_values(int table, size_t *num) {
+	switch (table) {
+		case 6: *num = countof(D6Values); return D6Values;
+		case 20: *num = countof(D20Values); return D20Values;
+		default: *num = countof(D24Values); return D24Values;
+	}
+}
+
+static float axis_distance_float(const axis_t *from, const axis_t *to) {
+	float x = (float)to->x - (float)from->x;
+	float y = (float)to->y - (float)from->y;
+	float z = (float)to->z - (float)from->z;
+	return sqrtf(x * x + y * y + z * z);
+}
+
+int test_axis_to_value(int table, int8_t x, int8_t y, int8_t z) {
+	size_t num;
+	const axis_t *values = table_values(table, &num);
+	axis_t axis = {x, y, z};
+	return axis_to_value(values, num, &axis);
+}
+
+int test_axis_to_value_float(int table, int8_t x, int8_t y, int8_t z) {
+	size_t num;
+	const axis_t *values = table_values(table, &num);
+	axis_t axis = {x, y, z};
+	int value = 0;
+	float min_dist = FLT_MAX;
+	for (int i = 0; i < num; i++) {
+		float dist = axis_distance_float(&axis, &values[i]);
+		if (dist < min_dist) {
+			value = i + 1;
+			min_dist = dist;
+		}
+	}
+	return value;
+}
+
+// Raw face through the dice type's lookup table, as incoming_stable_packet()
+// classifies it
+int test_axis_to_face(int dice_max, int8_t x, int8_t y, int8_t z) {
+	axis_t axis = {x, y, z};
+	for (int i = 0; i < countof(DiceTypes); i++) {
+		if (DiceTypes[i].max == dice_max) {
+			return axis_to_face(&DiceTypes[i], &axis);
+		}
+	}
+	return -1;
+}
+
+// Whether the lookup answers without falling back to the distance search
+int test_axis_lut_hit(int dice_max, int8_t x, int8_t y, int8_t z) {
+#if GODICE_LUT_SHIFT
+	axis_t axis = {x, y, z};
+	const int dim = 256 >> GODICE_LUT_SHIFT;
+	for (int i = 0; i < countof(DiceTypes); i++) {
+		if (DiceTypes[i].max == dice_max) {
+			int cell = (((uint8_t)(axis.x + 128) >> GODICE_LUT_SHIFT) * dim +
+						((uint8_t)(axis.y + 128) >> GODICE_LUT_SHIFT)) * dim +
+					   ((uint8_t)(axis.z + 128) >> GODICE_LUT_SHIFT);
+			return !(DiceTypes[i].lut[cell] & GODICE_LUT_AMBIGUOUS);
+		}
+	}
+#endif
+	return 0;
+}
+
+static bool is_event_prefix(const uint8_t *packet, size_t size, const char *key) {
+	size_t key_len = strlen(key);
+	if (size < key_len) {
+		return false;
+	}
+	return memcmp(packet, key, key_len) == 0;
+}
+
+// godice_incoming_packet() as it was before the first-byte table: every key
+// tried in turn until one is a prefix of the packet
+godice_status_t test_incoming_packet_linear(const godice_callbacks_t *cb, void *cb_userdata,
+											 int dice_id, int dice_max, const uint8_t *packet, size_t size) {
+	if (cb == NULL) {
+		return GODICE_INVALID_CALLBACK;
+	}
+	if (is_event_prefix(packet, size, "R")) {
+		return incoming_roll_packet(cb, cb_userdata, dice_id, packet, size);
+	}
+	if (is_event_prefix(packet, size, EK_Tap)) {
+		return GODICE_OK;
+	}
+	if (is_event_prefix(packet, size, EK_DoubleTap)) {
+		return GODICE_OK;
+	}
+	if (is_event_prefix(packet, size, EK_Battery)) {
+		return incoming_battery_packet(cb, cb_userdata, dice_id, packet + sizeof(EK_Battery) - 1, size - sizeof(EK_Battery) + 1);
+	}
+	if (is_event_prefix(packet, size, EK_Charging)) {
+		return incoming_charging_packet(cb, cb_userdata, dice_id, packet + sizeof(EK_Charging) - 1, size - sizeof(EK_Charging) + 1);
+	}
+	if (is_event_prefix(packet, size, "S")) {
+		return incoming_stable_packet(cb, cb_userdata,
+									  dice_id, dice_max,
+									  packet, size, NULL);
+	}
+	if (is_event_prefix(packet, size, EK_FakeStable) ||
+		is_event_prefix(packet, size, EK_TiltStable) ||
+		is_event_prefix(packet, size, EK_MoveStable)) {
+
+		return incoming_stable_packet(cb, cb_userdata,
+									  dice_id, dice_max,
+									  packet + 1, size - 1, (char*)packet);
+	}
+	if (is_event_prefix(packet, size, EK_Color)) {
+		return incoming_color_packet(cb, cb_userdata, dice_id, packet + sizeof(EK_Color) - 1, size - sizeof(EK_Color) + 1);
+	}
+	return GODICE_INVALID_PACKET;
+}
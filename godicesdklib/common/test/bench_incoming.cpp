@@ -0,0 +1,89 @@
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "godiceapi.h"
+
+// Packets per second through godice_incoming_packet() and through the linear
+// prefix parser it replaced, per packet type and for the mix a rolling die
+// sends. Build with -DCMAKE_BUILD_TYPE=MinSizeRel to compare the way size
+// optimized builds leave the linear parser's strlen and memcmp calls in.
+
+using namespace std;
+
+extern "C" godice_status_t test_incoming_packet_linear(const godice_callbacks_t *cb, void *cb_userdata,
+														int dice_id, int dice_max, const uint8_t *packet, size_t size);
+
+typedef godice_status_t (*parser_t)(const godice_callbacks_t *cb, void *cb_userdata,
+									int dice_id, int dice_max, const uint8_t *packet, size_t size);
+
+struct Packet {
+	const char *name;
+	vector<uint8_t> bytes;
+};
+
+static volatile int sink;
+
+static void on_color(void *userdata, int dice_id, godice_color_t color) { sink = color; }
+static void on_stable(void *userdata, int dice_id, uint8_t number) { sink = number; }
+static void on_charging(void *userdata, int dice_id, bool charging) { sink = charging; }
+static void on_level(void *userdata, int dice_id, uint8_t level) { sink = level; }
+static void on_roll(void *userdata, int dice_id) { sink = dice_id; }
+
+static double packets_per_sec(parser_t parse, const godice_callbacks_t *cb, const vector<const Packet*> &stream) {
+	const int rounds = 2000000 / (int)stream.size();
+	auto start = chrono::steady_clock::now();
+	for (int r = 0; r < rounds; r++) {
+		for (const Packet *p : stream) {
+			sink = parse(cb, nullptr, r & 3, 6, p->bytes.data(), p->bytes.size());
+		}
+	}
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+	return rounds * stream.size() / elapsed.count();
+}
+
+int main() {
+	godice_callbacks_t callbacks = {};
+	callbacks.on_dice_color = on_color;
+	callbacks.on_dice_stable = on_stable;
+	callbacks.on_charging_state_chaged = on_charging;
+	callbacks.on_charge_level = on_level;
+	callbacks.on_dice_roll = on_roll;
+
+	const vector<Packet> packets = {
+		{"roll", {'R'}},
+		{"stable", {'S', 64, 0, 0}},
+		{"tilt stable", {'T', 'S', 45, 40, 0}},
+		{"move stable", {'M', 'S', 0, 64, 0}},
+		{"fake stable", {'F', 'S', 0, 0, 64}},
+		{"tap", {'T', 'a', 'p'}},
+		{"double tap", {'D', 'T', 'a', 'p'}},
+		{"battery", {'B', 'a', 't', 87}},
+		{"charging", {'C', 'h', 'a', 'r', 1}},
+		{"color", {'C', 'o', 'l', GODICE_RED}},
+		{"unknown", {'X', 1, 2}},
+	};
+
+	printf("%-12s %14s %14s %8s\n", "packet", "linear pkt/s", "table pkt/s", "speedup");
+	for (const Packet &p : packets) {
+		vector<const Packet*> stream = {&p};
+		double linear = packets_per_sec(test_incoming_packet_linear, &callbacks, stream);
+		double table = packets_per_sec(godice_incoming_packet, &callbacks, stream);
+		printf("%-12s %14.0f %14.0f %7.2fx\n", p.name, linear, table, table / linear);
+	}
+
+	// A roll as the die reports it: moving, a few tilt/move stables while it
+	// settles, the stable, and now and then a battery level
+	vector<const Packet*> mix;
+	for (int i = 0; i < 8; i++) {
+		mix.push_back(&packets[0]);
+	}
+	mix.push_back(&packets[2]);
+	mix.push_back(&packets[3]);
+	mix.push_back(&packets[2]);
+	mix.push_back(&packets[1]);
+	mix.push_back(&packets[7]);
+	double linear = packets_per_sec(test_incoming_packet_linear, &callbacks, mix);
+	double table = packets_per_sec(godice_incoming_packet, &callbacks, mix);
+	printf("%-12s %14.0f %14.0f %7.2fx\n", "roll mix", linear, table, table / linear);
+	return 0;
+}
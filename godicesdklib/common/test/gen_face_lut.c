@@ -0,0 +1,78 @@
+// Generates godiceapi_lut.h: per face table (D6, D20, D24), one byte per
+// cube cell of the int8 x, y, z domain, holding the face every point of
+// the cell classifies to, or its most common face flagged ambiguous.
+//
+// Usage: gen_face_lut SHIFT... > ../godiceapi_lut.h
+// Each SHIFT (1-7) emits a table set for cells of 2^SHIFT units per axis,
+// selected in godiceapi.c with GODICE_LUT_SHIFT. Ambiguous cell counts go
+// to stderr.
+#define GODICE_LUT_SHIFT 0  // Classify by distance only
+#include "../godiceapi.c"
+#include <stdio.h>
+#include <stdlib.h>
+
+static void emit_table(const char *name, const axis_t *values, size_t num, int shift) {
+	int dim = 256 >> shift;
+	int side = 1 << shift;
+	int cells = dim * dim * dim;
+	int ambiguous = 0;
+	printf("static const uint8_t %s[%d] = {", name, cells);
+	for (int cell = 0; cell < cells; cell++) {
+		int cx = cell / (dim * dim), cy = cell / dim % dim, cz = cell % dim;
+		int counts[32] = {0};
+		int faces = 0;
+		for (int dx = 0; dx < side; dx++) {
+			for (int dy = 0; dy < side; dy++) {
+				for (int dz = 0; dz < side; dz++) {
+					axis_t axis = {(int8_t)((cx << shift) + dx - 128), (int8_t)((cy << shift) + dy - 128),
+								   (int8_t)((cz << shift) + dz - 128)};
+					int face = axis_to_value(values, num, &axis);
+					if (counts[face]++ == 0) {
+						faces++;
+					}
+				}
+			}
+		}
+		int best = 1;
+		for (int face = 2; face <= (int)num; face++) {
+			if (counts[face] > counts[best]) {
+				best = face;
+			}
+		}
+		uint8_t entry = (uint8_t)best;
+		if (faces > 1) {
+			entry |= GODICE_LUT_AMBIGUOUS;
+			ambiguous++;
+		}
+		printf("%s0x%02x,", cell % 16 ? " " : "\n\t", entry);
+	}
+	printf("\n};\n\n");
+	fprintf(stderr, "shift %d %-9s %6d cells, %6d ambiguous (%.1f%%)\n", shift, name, cells, ambiguous,
+			100.0 * ambiguous / cells);
+}
+
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s SHIFT...\n", argv[0]);
+		return 1;
+	}
+	printf("// Generated by test/gen_face_lut.c from the face tables in godiceapi.c; do not edit.\n");
+	printf("// Regenerate: gen_face_lut");
+	for (int i = 1; i < argc; i++) {
+		printf(" %s", argv[i]);
+	}
+	printf(" > godiceapi_lut.h\n\n");
+	for (int i = 1; i < argc; i++) {
+		int shift = atoi(argv[i]);
+		if (shift < 1 || shift > 7) {
+			fprintf(stderr, "shift must be 1-7\n");
+			return 1;
+		}
+		printf("%s GODICE_LUT_SHIFT == %d\n\n", i == 1 ? "#if" : "#elif", shift);
+		emit_table("D6Lut", D6Values, countof(D6Values), shift);
+		emit_table("D20Lut", D20Values, countof(D20Values), shift);
+		emit_table("D24Lut", D24Values, countof(D24Values), shift);
+	}
+	printf("#else\n#error \"No generated tables for this GODICE_LUT_SHIFT\"\n#endif\n");
+	return 0;
+}
@@ -1,25 +1,372 @@
+#include <cstring>
 #include <iostream>
+#include <regex>
+#include <string>
+#include <vector>
 #include "godiceapi.h"
 
 using namespace std;
 
+extern "C" int test_axis_to_value(int table, int8_t x, int8_t y, int8_t z);
+extern "C" int test_axis_to_value_float(int table, int8_t x, int8_t y, int8_t z);
+extern "C" int test_axis_to_face(int dice_max, int8_t x, int8_t y, int8_t z);
+extern "C" int test_axis_lut_hit(int dice_max, int8_t x, int8_t y, int8_t z);
+extern "C" godice_status_t test_incoming_packet_linear(const godice_callbacks_t *cb, void *cb_userdata,
+														int dice_id, int dice_max, const uint8_t *packet, size_t size);
+
+static int failures = 0;
+
+#define CHECK(cond) \
+	do { \
+		if (!(cond)) { \
+			cout << "FAIL " << __FILE__ << ":" << __LINE__ << ": " << #cond << endl; \
+			failures++; \
+		} \
+	} while (0)
+
+static int last_number = -1;
+
+static void on_stable(void *userdata, int dice_id, uint8_t number) {
+	last_number = number;
+}
+
+static int stable(int dice_max, const uint8_t *packet, size_t size) {
+	godice_callbacks_t callbacks = {};
+	callbacks.on_dice_stable = on_stable;
+	last_number = -1;
+	if (godice_incoming_packet(&callbacks, nullptr, 0, dice_max, packet, size) != GODICE_OK) {
+		return -1;
+	}
+	return last_number;
+}
+
 void test_stables() {
-	godiceapi_callbacks_t callbacks = {
-		.on_dice_roll = [](void *userdata, int dice_id, int number) {
-			cout << number << endl;
-		}
-	};
 	{
 		uint8_t packet[] = {'S', 0, 0, (uint8_t)-64};
-		incoming_packet(&callbacks, nullptr, 0, packet, sizeof(packet));
+		CHECK(stable(6, packet, sizeof(packet)) == 5);
+	}
+	{
+		uint8_t packet[] = {'S', (uint8_t)-64, 0, (uint8_t)-22};
+		CHECK(stable(20, packet, sizeof(packet)) == 1);
+	}
+	{
+		uint8_t packet[] = {'F', 'S', 64, 0, 0};
+		CHECK(stable(6, packet, sizeof(packet)) == 6);
 	}
 	{
 		uint8_t packet[] = {'F', 'S', 128, 128, 128};
-		incoming_packet(&callbacks, nullptr, 0, packet, sizeof(packet));
+		CHECK(stable(6, packet, sizeof(packet)) >= 1);
+	}
+}
+
+static godice_stable_info_t last_info;
+static int ex_calls = 0;
+
+static void on_stable_ex(void *userdata, int dice_id, const godice_stable_info_t *info) {
+	last_info = *info;
+	ex_calls++;
+}
+
+static bool stable_ex(int dice_max, const uint8_t *packet, size_t size, bool plain) {
+	godice_callbacks_t callbacks = {};
+	callbacks.on_dice_stable = plain ? on_stable : nullptr;
+	callbacks.on_dice_stable_ex = on_stable_ex;
+	last_number = -1;
+	ex_calls = 0;
+	return godice_incoming_packet(&callbacks, nullptr, 0, dice_max, packet, size) == GODICE_OK && ex_calls == 1;
+}
+
+void test_stable_confidence() {
+	{
+		uint8_t packet[] = {'S', 64, 0, 0};  // Flat on 6
+		CHECK(stable_ex(6, packet, sizeof(packet), false));
+		CHECK(last_info.type == GODICE_STABLE);
+		CHECK(last_info.number == 6 && last_info.margin == 8192);
+		CHECK(last_info.x == 64 && last_info.y == 0 && last_info.z == 0);
+	}
+	{
+		uint8_t packet[] = {'T', 'S', 45, 45, 0};  // Exactly between 3 and 6: the lower face wins
+		CHECK(stable_ex(6, packet, sizeof(packet), true));
+		CHECK(last_info.type == GODICE_TILT_STABLE);
+		CHECK(last_info.margin == 0);
+		CHECK(last_info.number == last_number && last_info.number == 3 && last_info.runner_up == 6);
+	}
+	{
+		uint8_t packet[] = {'M', 'S', 55, 30, 0};  // ~29° towards 3
+		CHECK(stable_ex(6, packet, sizeof(packet), true));
+		CHECK(last_info.type == GODICE_MOVE_STABLE && last_info.number == 6);
+		CHECK(last_info.margin > 2500 && last_info.margin < 4000);
+	}
+	{
+		uint8_t packet[] = {'F', 'S', 0, 0, 64};
+		CHECK(stable_ex(6, packet, sizeof(packet), false));
+		CHECK(last_info.type == GODICE_FAKE_STABLE && last_info.number == 2);
+	}
+
+	// Same number as on_dice_stable everywhere, and the runner-up always
+	// reads differently (a D4 maps six D24 faces to each number)
+	const int dice[] = {4, 6, 8, 10, 12, 20, 100};
+	for (int d : dice) {
+		int bad = 0;
+		for (int x = -128; x < 128; x += 3) {
+			for (int y = -128; y < 128; y += 3) {
+				for (int z = -128; z < 128; z += 3) {
+					uint8_t packet[] = {'T', 'S', (uint8_t)x, (uint8_t)y, (uint8_t)z};
+					if (!stable_ex(d, packet, sizeof(packet), true) || last_info.number != last_number ||
+						last_info.runner_up == last_info.number || last_info.margin < 0) {
+						bad++;
+					}
+				}
+			}
+		}
+		CHECK(bad == 0);
+	}
+
+	godice_callbacks_t none = {};
+	uint8_t packet[] = {'S', 64, 0, 0};
+	CHECK(godice_incoming_packet(&none, nullptr, 0, 6, packet, sizeof(packet)) == GODICE_INVALID_CALLBACK);
+}
+
+// Every callback a packet triggers, with its arguments
+static void trace_color(void *userdata, int dice_id, godice_color_t color) {
+	*(string*)userdata += "color " + to_string(color) + ";";
+}
+static void trace_stable(void *userdata, int dice_id, uint8_t number) {
+	*(string*)userdata += "stable " + to_string(number) + ";";
+}
+static void trace_stable_ex(void *userdata, int dice_id, const godice_stable_info_t *info) {
+	*(string*)userdata += "stable_ex " + to_string(info->type) + " " + to_string(info->number) + " " +
+						  to_string(info->runner_up) + " " + to_string(info->margin) + ";";
+}
+static void trace_charging(void *userdata, int dice_id, bool charging) {
+	*(string*)userdata += "charging " + to_string(charging) + ";";
+}
+static void trace_level(void *userdata, int dice_id, uint8_t level) {
+	*(string*)userdata += "level " + to_string(level) + ";";
+}
+static void trace_roll(void *userdata, int dice_id) {
+	*(string*)userdata += "roll;";
+}
+
+static godice_callbacks_t trace_callbacks() {
+	godice_callbacks_t callbacks = {};
+	callbacks.on_dice_color = trace_color;
+	callbacks.on_dice_stable = trace_stable;
+	callbacks.on_dice_stable_ex = trace_stable_ex;
+	callbacks.on_charging_state_chaged = trace_charging;
+	callbacks.on_charge_level = trace_level;
+	callbacks.on_dice_roll = trace_roll;
+	return callbacks;
+}
+
+// Every key and its prefixes with 0-4 payload bytes, then random packets
+static vector<vector<uint8_t>> sample_packets() {
+	const char *keys[] = {"R", "Tap", "DTap", "Bat", "Char", "S", "FS", "TS", "MS", "Col",
+						  "T", "Ta", "TSa", "D", "DT", "Ba", "C", "Ch", "Co", "F", "M", "X", ""};
+	vector<vector<uint8_t>> packets;
+	for (const char *key : keys) {
+		for (size_t extra = 0; extra <= 4; extra++) {
+			vector<uint8_t> packet(key, key + strlen(key));
+			for (size_t i = 0; i < extra; i++) {
+				packet.push_back((uint8_t)(17 + 40 * i));
+			}
+			packets.push_back(packet);
+		}
+	}
+	unsigned seed = 7;
+	for (int i = 0; i < 20000; i++) {
+		vector<uint8_t> packet;
+		seed = seed * 1103515245u + 12345u;
+		size_t size = (seed >> 16) % 7;
+		for (size_t n = 0; n < size; n++) {
+			seed = seed * 1103515245u + 12345u;
+			// Mostly key letters, so random packets hit the keys often
+			packet.push_back((seed >> 20) % 2 ? (uint8_t)"RTapDBtChrSFMol"[(seed >> 8) % 15] : (uint8_t)(seed >> 8));
+		}
+		packets.push_back(packet);
+	}
+	return packets;
+}
+
+// The first-byte table parses every packet exactly as the linear prefix
+// checks did: same status, same callbacks, same payload
+void test_dispatch_matches_linear() {
+	godice_callbacks_t callbacks = trace_callbacks();
+	godice_callbacks_t none = {};
+	vector<vector<uint8_t>> packets = sample_packets();
+
+	const godice_callbacks_t *cbs[] = {&callbacks, &none, nullptr};
+	int mismatches = 0;
+	for (const auto &packet : packets) {
+		for (const godice_callbacks_t *cb : cbs) {
+			string table_trace, linear_trace;
+			godice_status_t table = godice_incoming_packet(cb, &table_trace, 0, 6, packet.data(), packet.size());
+			godice_status_t linear = test_incoming_packet_linear(cb, &linear_trace, 0, 6, packet.data(), packet.size());
+			if ((table != linear || table_trace != linear_trace) && mismatches++ == 0) {
+				cout << "packet \"" << string(packet.begin(), packet.end()) << "\": " << table << " \"" << table_trace
+					 << "\" != " << linear << " \"" << linear_trace << "\"" << endl;
+			}
+		}
+	}
+	CHECK(mismatches == 0);
+}
+
+// An event as the trace callbacks would have written it; a plain stable
+// carries no ranking, so its runner-up and margin are left out
+static string event_trace(const godice_event_t &event) {
+	switch (event.type) {
+		case GODICE_EVENT_ROLL:
+			return "roll;";
+		case GODICE_EVENT_STABLE:
+			return "stable " + to_string(event.value) + ";stable_ex " + to_string(event.stable_type) + " " +
+				   to_string(event.value) +
+				   (event.stable_type == GODICE_STABLE
+						? string()
+						: " " + to_string(event.runner_up) + " " + to_string(event.margin)) +
+				   ";";
+		case GODICE_EVENT_COLOR:
+			return "color " + to_string(event.value) + ";";
+		case GODICE_EVENT_CHARGE_LEVEL:
+			return "level " + to_string(event.value) + ";";
+		case GODICE_EVENT_CHARGING:
+			return "charging " + to_string(event.value) + ";";
+	}
+	return "";  // Taps have no callback
+}
+
+// Batched decoding reports what the callbacks do for every packet, taps
+// besides, and stops where events run out
+void test_incoming_packets() {
+	godice_callbacks_t callbacks = trace_callbacks();
+	vector<vector<uint8_t>> packets = sample_packets();
+	const int dice[] = {6, 20, 7};  // No face table for a D7
+
+	int mismatches = 0;
+	for (int d : dice) {
+		for (size_t i = 0; i < packets.size(); i++) {
+			const vector<uint8_t> &packet = packets[i];
+			string trace;
+			bool ok = godice_incoming_packet(&callbacks, &trace, 0, d, packet.data(), packet.size()) == GODICE_OK;
+			// The batch ranks only FS / TS / MS
+			trace = regex_replace(trace, regex("(stable_ex 0 \\d+) -?\\d+ -?\\d+;"), "$1;");
+			string text(packet.begin(), packet.end());
+			bool tap = ok && (text.compare(0, 3, "Tap") == 0 || text.compare(0, 4, "DTap") == 0);
+
+			godice_packet_t in = {(int)(i % 4), d, packet.data(), packet.size()};
+			godice_event_t event;
+			size_t consumed = 0;
+			size_t n = godice_incoming_packets(&in, 1, &event, 1, &consumed);
+			bool match = consumed == 1 && n == (ok && (tap || !trace.empty()) ? 1u : 0u);
+			if (n == 1) {
+				match = match && event.dice_id == i % 4 && event_trace(event) == trace &&
+						(event.stable_type != GODICE_STABLE || (event.runner_up == 0 && event.margin == 0)) &&
+						(event.type == GODICE_EVENT_TAP || event.type == GODICE_EVENT_DOUBLE_TAP) == tap;
+			}
+			if (!match && mismatches++ == 0) {
+				cout << "D" << d << " packet \"" << text << "\": \"" << trace
+					 << "\" != " << n << " events" << endl;
+			}
+		}
+	}
+	CHECK(mismatches == 0);
+
+	// Several dice in one call; invalid packets are skipped
+	const uint8_t roll[] = {'R'}, level[] = {'B', 'a', 't', 101}, color[] = {'C', 'o', 'l', 2},
+				  face[] = {'S', 0, 0, (uint8_t)-64}, tap[] = {'D', 'T', 'a', 'p'};
+	godice_packet_t batch[] = {
+		{0, 6, roll, sizeof(roll)},
+		{1, 6, level, sizeof(level)},
+		{2, 6, color, sizeof(color)},
+		{3, 6, face, sizeof(face)},
+		{1, 6, tap, sizeof(tap)},
+	};
+	godice_event_t events[5];
+	size_t consumed = 0;
+	CHECK(godice_incoming_packets(batch, 5, events, 5, &consumed) == 4 && consumed == 5);
+	CHECK(events[0].type == GODICE_EVENT_ROLL && events[0].dice_id == 0);
+	CHECK(events[1].type == GODICE_EVENT_COLOR && events[1].dice_id == 2 && events[1].value == GODICE_GREEN);
+	CHECK(events[2].type == GODICE_EVENT_STABLE && events[2].dice_id == 3 && events[2].value == 5);
+	CHECK(events[2].stable_type == GODICE_STABLE && events[2].z == -64);
+	CHECK(events[3].type == GODICE_EVENT_DOUBLE_TAP && events[3].dice_id == 1);
+
+	// Full after two events: the rest is left for the next call
+	CHECK(godice_incoming_packets(batch, 5, events, 2, &consumed) == 2 && consumed == 3);
+	CHECK(godice_incoming_packets(batch + consumed, 5 - consumed, events, 2, nullptr) == 2);
+	CHECK(events[0].dice_id == 3 && events[1].dice_id == 1);
+	CHECK(godice_incoming_packets(batch, 5, events, 0, &consumed) == 0 && consumed == 0);
+}
+
+// Every int8 x, y, z against every face table: the integer classifier
+// must pick exactly the face the float one did
+void test_classifier_matches_float() {
+	const int tables[] = {6, 20, 24};
+	for (int table : tables) {
+		int mismatches = 0;
+		for (int x = -128; x < 128; x++) {
+			for (int y = -128; y < 128; y++) {
+				for (int z = -128; z < 128; z++) {
+					int fast = test_axis_to_value(table, (int8_t)x, (int8_t)y, (int8_t)z);
+					int reference = test_axis_to_value_float(table, (int8_t)x, (int8_t)y, (int8_t)z);
+					if (fast != reference && mismatches++ == 0) {
+						cout << "D" << table << " (" << x << ", " << y << ", " << z << "): "
+							 << fast << " != " << reference << endl;
+					}
+				}
+			}
+		}
+		CHECK(mismatches == 0);
+	}
+}
+
+// The lookup table path gives the classifier's face for every input; for
+// readings near a face (what a resting die reports) report how many are
+// answered by the table alone
+void test_lookup_matches_classifier() {
+	const int dice[][2] = {{6, 6}, {20, 20}, {12, 24}};  // dice_max, face table
+	for (const auto &d : dice) {
+		int mismatches = 0;
+		for (int x = -128; x < 128; x++) {
+			for (int y = -128; y < 128; y++) {
+				for (int z = -128; z < 128; z++) {
+					if (test_axis_to_face(d[0], (int8_t)x, (int8_t)y, (int8_t)z) !=
+						test_axis_to_value(d[1], (int8_t)x, (int8_t)y, (int8_t)z)) {
+						mismatches++;
+					}
+				}
+			}
+		}
+		CHECK(mismatches == 0);
+
+		unsigned seed = 1;
+		int hits = 0, samples = 0;
+		for (int i = 0; i < 100000; i++) {
+			seed = seed * 1103515245u + 12345u;
+			int8_t x = (int8_t)((seed >> 8) % 256 - 128), y = (int8_t)((seed >> 16) % 256 - 128);
+			seed = seed * 1103515245u + 12345u;
+			int8_t z = (int8_t)((seed >> 8) % 256 - 128);
+			int r2 = x * x + y * y + z * z;
+			if (r2 < 56 * 56 || r2 > 72 * 72) {
+				continue;  // Not at rest: gravity is ~64
+			}
+			samples++;
+			hits += test_axis_lut_hit(d[0], x, y, z);
+		}
+		cout << "D" << d[1] << " table: " << (samples ? 100 * hits / samples : 0)
+			 << "% of resting readings answered without a distance search" << endl;
 	}
 }
 
 int main() {
 	test_stables();
+	test_stable_confidence();
+	test_dispatch_matches_linear();
+	test_incoming_packets();
+	test_classifier_matches_float();
+	test_lookup_matches_classifier();
+	if (failures) {
+		cout << failures << " failures" << endl;
+		return 1;
+	}
+	cout << "godiceapi tests passed" << endl;
 	return 0;
 }
@@ -0,0 +1,297 @@
+/*
+ * Last Drop - GoDice Decoder
+ *
+ * The one GoDice decode path for every sketch: a C++ wrapper over the GoDice
+ * SDK (godicesdklib/common/godiceapi.c, compiled by godice_sdk.c next to
+ * this file), so decoding costs and behaves the same everywhere and
+ * test/bench_godice_decoder.cpp measures it for all of them.
+ *
+ * GoDice messages carry no framing of their own: a key ("R", "S", "TS",
+ * "Bat", ...) followed by a payload whose length the key fixes, and the link
+ * may pack several messages into one notification or split one across two.
+ * GoDiceDecoder finds each message by its key length and collects pointers
+ * into the notification buffer as godice_packet_t, which
+ * godice_incoming_packets() decodes up to GODICE_DECODER_BATCH at a time
+ * into an event array; no callback runs per message. Nothing is copied
+ * except the start of a message the notification cuts off (at most
+ * GODICE_MESSAGE_MAX - 1 bytes), kept per slot until the rest arrives:
+ *   - a byte that starts no key is skipped and counted as malformed, so
+ *     decoding resyncs on the next key;
+ *   - a message the SDK rejects (level > 100, unknown colour) is counted,
+ *     without an event;
+ *   - a partial message still waiting when the next notification comes
+ *     more than GODICE_DECODER_STALE_MS later is dropped, since the rest of
+ *     a split message follows straight away.
+ *
+ * decode() takes one notification and calls a handler per event;
+ * decodeBatch() takes the notifications a queue has collected and fills
+ * an event array.
+ *
+ * Sketches use it as an Arduino library (sketchbook location = repo root,
+ * as for BLE_Modified) with #include <GoDice.h>.
+ */
+
+#ifndef GODICE_DECODER_H
+#define GODICE_DECODER_H
+
+#include <stdint.h>
+#include <string.h>
+#include "../../../godicesdklib/common/godiceapi.h"
+
+#ifndef GODICE_DECODER_STALE_MS
+#define GODICE_DECODER_STALE_MS 200
+#endif
+
+#ifndef GODICE_DECODER_BATCH
+#define GODICE_DECODER_BATCH 16  // Messages per godice_incoming_packets() call
+#endif
+
+#define GODICE_MESSAGE_MAX 5  // "FS" / "MS" / "TS" / "Char" + payload
+
+// Event types are the SDK's godice_event_type_t
+struct GoDiceEvent {
+  godice_event_type_t type;
+  uint8_t slot;
+  uint8_t key;                  // First byte: 'S', or 'F' / 'M' / 'T' for fake/move/tilt stables
+  uint8_t value;                // Face for stables
+  godice_stable_info_t stable;  // Stables only: SDK face and axis; runner-up and margin for F / M / T
+};
+
+// One notification for decodeBatch()
+struct GoDiceNotification {
+  uint8_t slot;
+  const uint8_t *data;
+  size_t size;
+};
+
+struct GoDiceKey {
+  const char *key;
+  uint8_t keyLen;
+  uint8_t length;  // Key plus payload
+  godice_event_type_t type;
+};
+
+// Every message the die sends. No key is a prefix of another.
+static const GoDiceKey GODICE_KEYS[] = {
+  {"R",    1, 1, GODICE_EVENT_ROLL},
+  {"S",    1, 4, GODICE_EVENT_STABLE},
+  {"FS",   2, 5, GODICE_EVENT_STABLE},
+  {"MS",   2, 5, GODICE_EVENT_STABLE},
+  {"TS",   2, 5, GODICE_EVENT_STABLE},
+  {"Tap",  3, 3, GODICE_EVENT_TAP},
+  {"DTap", 4, 4, GODICE_EVENT_DOUBLE_TAP},
+  {"Bat",  3, 4, GODICE_EVENT_CHARGE_LEVEL},
+  {"Char", 4, 5, GODICE_EVENT_CHARGING},
+  {"Col",  3, 4, GODICE_EVENT_COLOR},
+};
+
+template <uint8_t SLOTS>
+class GoDiceDecoder {
+  static_assert(SLOTS > 0, "GoDiceDecoder needs at least one slot");
+
+public:
+  GoDiceDecoder() : decoded(0), malformed(0), badPayloads(0), stale(0) {
+    for (uint8_t i = 0; i < SLOTS; i++) {
+      slots[i].carryLen = 0;
+      slots[i].carryMs = 0;
+      slots[i].diceMax = 6;
+    }
+  }
+
+  // Die type for the SDK's face tables (6, 8, 10, 12, 20, ...); default D6
+  void setDiceMax(uint8_t slot, uint8_t diceMax) {
+    if (slot < SLOTS) slots[slot].diceMax = diceMax;
+  }
+
+  // Forget a partial message (new connection); counters are kept
+  void reset(uint8_t slot) {
+    if (slot < SLOTS) slots[slot].carryLen = 0;
+  }
+
+  // Decodes one notification from slot's die and calls
+  // handler(const GoDiceEvent&) for each message in it, in order
+  template <typename Handler>
+  void decode(uint8_t slot, const uint8_t *data, size_t len, uint32_t nowMs, Handler &&handler) {
+    frame(slot, data, len, nowMs, [&](const godice_event_t *events, size_t count) {
+      for (size_t i = 0; i < count; i++) handler(toEvent(events[i]));
+    });
+  }
+
+  // Decodes notifications from any slots, in order, into events. Stops
+  // before a notification whose messages might not fit in what is left of
+  // events (its size + GODICE_MESSAGE_MAX - 1); consumed (may be nullptr)
+  // receives the number of notifications decoded. Returns the number of
+  // events written.
+  size_t decodeBatch(const GoDiceNotification *notifications, size_t count, uint32_t nowMs,
+                     GoDiceEvent *events, size_t maxEvents, size_t *consumed = nullptr) {
+    size_t written = 0;
+    size_t i = 0;
+    for (; i < count; i++) {
+      const GoDiceNotification &n = notifications[i];
+      if (maxEvents - written < n.size + GODICE_MESSAGE_MAX - 1) break;
+      frame(n.slot, n.data, n.size, nowMs, [&](const godice_event_t *decodedEvents, size_t decodedCount) {
+        for (size_t j = 0; j < decodedCount; j++) events[written++] = toEvent(decodedEvents[j]);
+      });
+    }
+    if (consumed) *consumed = i;
+    return written;
+  }
+
+  uint32_t messageCount() const { return decoded; }
+  uint32_t malformedBytes() const { return malformed; }
+  uint32_t badPayloadCount() const { return badPayloads; }
+  uint32_t staleBytes() const { return stale; }
+
+private:
+  struct Slot {
+    uint8_t carry[GODICE_MESSAGE_MAX];
+    uint8_t carryLen;
+    uint8_t diceMax;
+    uint32_t carryMs;
+  };
+
+  // Messages framed but not yet decoded
+  struct Pending {
+    godice_packet_t packets[GODICE_DECODER_BATCH];
+    size_t count;
+    size_t stables;
+  };
+
+  // The key data starts with (nullptr if none can match); false while the
+  // bytes are still a proper prefix of some key
+  static bool matchKey(const uint8_t *data, size_t len, const GoDiceKey *&found) {
+    found = nullptr;
+    bool partial = false;
+    for (const GoDiceKey &k : GODICE_KEYS) {
+      size_t n = k.keyLen < len ? k.keyLen : len;
+      size_t i = 0;
+      while (i < n && data[i] == (uint8_t)k.key[i]) i++;
+      if (i < n) continue;
+      if (n == k.keyLen) {
+        found = &k;
+        return true;
+      }
+      partial = true;
+    }
+    return !partial;
+  }
+
+  static GoDiceEvent toEvent(const godice_event_t &e) {
+    GoDiceEvent event;
+    memset(&event, 0, sizeof(event));
+    event.type = (godice_event_type_t)e.type;
+    event.slot = e.dice_id;
+    event.key = (uint8_t)"RSCBCTD"[e.type];
+    event.value = e.value;
+    if (e.type == GODICE_EVENT_STABLE) {
+      event.key = (uint8_t)"SFTM"[e.stable_type];
+      event.stable.type = (godice_stable_type_t)e.stable_type;
+      event.stable.number = e.value;
+      event.stable.runner_up = e.runner_up;
+      event.stable.margin = e.margin;
+      event.stable.x = e.x;
+      event.stable.y = e.y;
+      event.stable.z = e.z;
+    }
+    return event;
+  }
+
+  // Frames one notification and hands the SDK's events to
+  // out(const godice_event_t*, size_t), a batch at a time
+  template <typename Out>
+  void frame(uint8_t slot, const uint8_t *data, size_t len, uint32_t nowMs, Out &&out) {
+    if (slot >= SLOTS) return;
+    Slot &s = slots[slot];
+    if (s.carryLen > 0 && nowMs - s.carryMs > GODICE_DECODER_STALE_MS) {
+      stale += s.carryLen;
+      s.carryLen = 0;
+    }
+    Pending pending;
+    pending.count = 0;
+    pending.stables = 0;
+
+    // Finish the message the last notification cut off, a byte at a time;
+    // it is decoded before the carry moves under it
+    size_t pos = 0;
+    while (s.carryLen > 0) {
+      const GoDiceKey *key = nullptr;
+      bool keyed = matchKey(s.carry, s.carryLen, key);
+      if (keyed && key == nullptr) {
+        malformed++;
+        s.carryLen--;
+        memmove(s.carry, s.carry + 1, s.carryLen);
+      } else if (keyed && s.carryLen >= key->length) {
+        add(pending, slot, s.carry, *key, out);
+        flush(pending, out);
+        s.carryLen -= key->length;
+        memmove(s.carry, s.carry + key->length, s.carryLen);
+      } else if (pos < len) {
+        s.carry[s.carryLen++] = data[pos++];
+      } else {
+        break;
+      }
+    }
+
+    // Whole messages straight from the notification buffer
+    while (pos < len) {
+      const uint8_t *msg = data + pos;
+      size_t left = len - pos;
+      const GoDiceKey *key = nullptr;
+      bool keyed = matchKey(msg, left, key);
+      if (keyed && key == nullptr) {
+        malformed++;
+        pos++;
+        continue;
+      }
+      if (!keyed || left < key->length) {
+        memcpy(s.carry + s.carryLen, msg, left);
+        s.carryLen += left;
+        break;
+      }
+      add(pending, slot, msg, *key, out);
+      pos += key->length;
+    }
+
+    flush(pending, out);
+    if (s.carryLen > 0) s.carryMs = nowMs;
+  }
+
+  template <typename Out>
+  void add(Pending &pending, uint8_t slot, const uint8_t *msg, const GoDiceKey &key, Out &out) {
+    godice_packet_t &packet = pending.packets[pending.count++];
+    packet.dice_id = slot;
+    packet.dice_max = slots[slot].diceMax;
+    packet.data = msg;
+    packet.size = key.length;
+    if (key.type == GODICE_EVENT_STABLE) pending.stables++;
+    if (pending.count == GODICE_DECODER_BATCH) flush(pending, out);
+  }
+
+  template <typename Out>
+  void flush(Pending &pending, Out &out) {
+    if (pending.count == 0) return;
+    godice_event_t events[GODICE_DECODER_BATCH];
+    size_t count = godice_incoming_packets(pending.packets, pending.count, events, pending.count, nullptr);
+
+    // A stable's size is fixed by its key, so the SDK only drops one from a
+    // die type it has no table for; any other message it drops had a bad
+    // payload
+    size_t stables = 0;
+    for (size_t i = 0; i < count; i++) {
+      if (events[i].type == GODICE_EVENT_STABLE) stables++;
+    }
+    badPayloads += (uint32_t)((pending.count - pending.stables) - (count - stables));
+    decoded += (uint32_t)count;
+    pending.count = 0;
+    pending.stables = 0;
+    out(events, count);
+  }
+
+  Slot slots[SLOTS];
+  uint32_t decoded;
+  uint32_t malformed;
+  uint32_t badPayloads;
+  uint32_t stale;
+};
+
+#endif // GODICE_DECODER_H
@@ -0,0 +1,3 @@
+// The GoDice SDK, built from its only copy so every sketch decodes with the
+// same code as the SDK tests (godicesdklib/common/test)
+#include "../../../godicesdklib/common/godiceapi.c"
@@ -8,6 +8,7 @@
 // Force use of external NimBLE-Arduino library (not bundled version)
 #define CONFIG_BT_NIMBLE_ROLE_CENTRAL_ONLY
 #include <NimBLEDevice.h>
+#include <GoDice.h>
 
 // Add timing check
 unsigned long scanStartTime = 0;
@@ -26,22 +27,43 @@ static NimBLEClient* pClient = nullptr;
 static NimBLERemoteCharacteristic* pRemoteCharacteristicTX = nullptr;
 static NimBLERemoteCharacteristic* pRemoteCharacteristicRX = nullptr;
 
+// Shared GoDice decoder (libraries/GoDice): whole messages are decoded in
+// place, however the link packs or splits them
+static GoDiceDecoder<1> diceDecoder;
+
+static void onDiceEvent(const GoDiceEvent& event) {
+    switch (event.type) {
+        case GODICE_EVENT_ROLL:
+            Serial.println("🎲 Rolling...");
+            break;
+        case GODICE_EVENT_STABLE:
+            Serial.printf("✅ Stable: %d (%c, margin %ld)\n",
+                event.value, event.key, (long)event.stable.margin);
+            break;
+        case GODICE_EVENT_CHARGE_LEVEL:
+            Serial.printf("🔋 Battery: %d%%\n", event.value);
+            break;
+        case GODICE_EVENT_CHARGING:
+            Serial.printf("🔌 Charging: %s\n", event.value ? "yes" : "no");
+            break;
+        case GODICE_EVENT_COLOR:
+            Serial.printf("🎨 Color code: %d\n", event.value);
+            break;
+        default:  // Taps
+            break;
+    }
+}
+
 // Notification callback for dice data
 static void notifyCallback(NimBLERemoteCharacteristic* pChar, uint8_t* pData, size_t length, bool isNotify) {
-    Serial.print("📨 Notification received: ");
-    for (size_t i = 0; i < length; i++) {
-        Serial.printf("%02X ", pData[i]);
-    }
-    Serial.println();
-    
-    // Parse GoDice protocol here
-    // This is where you'd integrate godiceapi.c parsing
+    diceDecoder.decode(0, pData, length, millis(), onDiceEvent);
 }
 
 // Client callback
 class ClientCallbacks : public NimBLEClientCallbacks {
     void onConnect(NimBLEClient* pClient) {
         Serial.println("✅ Connected to GoDice!");
+        diceDecoder.reset(0);
         connected = true;
     }
 
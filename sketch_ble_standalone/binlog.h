@@ -0,0 +1,203 @@
+/*
+ * Last Drop - Binary Log Ring
+ *
+ * Hot-path logging that costs microseconds instead of the milliseconds a
+ * Serial.printf blocks for at 115200 baud. log<ID>(args...) stores the
+ * message id (log_catalog.h), a timestamp and the raw integer arguments in
+ * a fixed ring; nothing is formatted or written to the UART until the game
+ * task drains the ring in idle time.
+ *
+ * Any task may log (GoDice and BLE callbacks, game task, render loop):
+ * producers claim a slot with a CAS and publish it through the slot's
+ * sequence number (a bounded MPMC queue used with one consumer). A full
+ * ring drops the record, counted in dropped(), rather than blocking.
+ *
+ * Messages below BINLOG_LEVEL compile out; their arguments are still
+ * evaluated, so keep them side-effect free.
+ *
+ * Drained records go to Serial as one line each: "$B" then the record in
+ * hex (encodeLogLine()), so they can share the port with plain text. The
+ * host decoder (test/binlog_decode.cpp) turns those lines back into text
+ * and passes everything else through.
+ *
+ * Define BINLOG_MICROS() before including this header to stamp records
+ * (micros() on the board).
+ */
+
+#ifndef BINLOG_H
+#define BINLOG_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include "log_catalog.h"
+
+#ifndef BINLOG_LEVEL
+#define BINLOG_LEVEL LOG_LEVEL_DEBUG
+#endif
+
+#ifndef BINLOG_MICROS
+#error "Define BINLOG_MICROS() before including binlog.h"
+#endif
+
+#define LOG_LINE_MARKER "$B"
+#define LOG_LINE_MAX (2 + 2 * (7 + 4 * LOG_MAX_ARGS) + 1)  // Marker, hex, NUL
+
+struct LogRecord {
+  uint16_t id;
+  uint8_t argc;
+  uint32_t timestampUs;
+  int32_t args[LOG_MAX_ARGS];
+};
+
+template <uint32_t SLOTS>
+class BinLog {
+  static_assert(SLOTS > 0 && (SLOTS & (SLOTS - 1)) == 0, "BinLog slot count must be a power of two");
+
+public:
+  BinLog() : head(0), tail(0), droppedCount(0), loggedCount(0) {
+    for (uint32_t i = 0; i < SLOTS; i++) {
+      cells[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  template <LogMsgId ID, typename... Args>
+  void log(Args... args) {
+    static_assert(sizeof...(Args) == logFormatArgs(LOG_FORMATS[ID]),
+                  "Argument count does not match the log_catalog.h format");
+    if (LOG_LEVELS[ID] < BINLOG_LEVEL) return;
+    const int32_t values[] = {0, (int32_t)args...};  // Leading 0: never zero-sized
+    push(ID, (uint32_t)BINLOG_MICROS(), values + 1, (uint8_t)sizeof...(Args));
+  }
+
+  // Any task; false (and counted) when the ring is full
+  bool push(uint16_t id, uint32_t timestampUs, const int32_t *args, uint8_t argc) {
+    uint32_t pos = head.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+      cell = &cells[pos & (SLOTS - 1)];
+      uint32_t seq = cell->seq.load(std::memory_order_acquire);
+      int32_t diff = (int32_t)(seq - pos);
+      if (diff == 0) {
+        if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+      } else if (diff < 0) {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      } else {
+        pos = head.load(std::memory_order_relaxed);
+      }
+    }
+    if (argc > LOG_MAX_ARGS) argc = LOG_MAX_ARGS;
+    cell->rec.id = id;
+    cell->rec.argc = argc;
+    cell->rec.timestampUs = timestampUs;
+    memcpy(cell->rec.args, args, argc * sizeof(int32_t));
+    cell->seq.store(pos + 1, std::memory_order_release);
+    loggedCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // One consumer task: oldest published record, false when empty
+  bool pop(LogRecord &out) {
+    uint32_t pos = tail;
+    Cell &cell = cells[pos & (SLOTS - 1)];
+    if (cell.seq.load(std::memory_order_acquire) != pos + 1) return false;
+    out = cell.rec;
+    cell.seq.store(pos + SLOTS, std::memory_order_release);
+    tail = pos + 1;
+    return true;
+  }
+
+  // Drops since the last call, for the consumer to report in the log
+  uint32_t takeDropped() {
+    return droppedCount.exchange(0, std::memory_order_relaxed);
+  }
+
+  uint32_t logged() const { return loggedCount.load(std::memory_order_relaxed); }
+  uint32_t capacity() const { return SLOTS; }
+
+private:
+  struct Cell {
+    std::atomic<uint32_t> seq;
+    LogRecord rec;
+  };
+
+  Cell cells[SLOTS];
+  std::atomic<uint32_t> head;
+  uint32_t tail;  // Consumer only
+  std::atomic<uint32_t> droppedCount;
+  std::atomic<uint32_t> loggedCount;
+};
+
+// "$B" + hex of: id (u16 LE), timestamp (u32 LE), argc (u8), args (i32 LE).
+// Returns the length written, or 0 if out is too small.
+inline uint32_t encodeLogLine(const LogRecord &rec, char *out, uint32_t size) {
+  static const char HEX_DIGITS[] = "0123456789ABCDEF";
+  uint8_t bytes[7 + 4 * LOG_MAX_ARGS];
+  uint32_t n = 0;
+  uint8_t argc = rec.argc > LOG_MAX_ARGS ? LOG_MAX_ARGS : rec.argc;
+  bytes[n++] = (uint8_t)rec.id;
+  bytes[n++] = (uint8_t)(rec.id >> 8);
+  for (int i = 0; i < 4; i++) bytes[n++] = (uint8_t)(rec.timestampUs >> (8 * i));
+  bytes[n++] = argc;
+  for (int a = 0; a < argc; a++) {
+    for (int i = 0; i < 4; i++) bytes[n++] = (uint8_t)((uint32_t)rec.args[a] >> (8 * i));
+  }
+  uint32_t len = 2 + 2 * n;
+  if (size < len + 1) return 0;
+  memcpy(out, LOG_LINE_MARKER, 2);
+  for (uint32_t i = 0; i < n; i++) {
+    out[2 + 2 * i] = HEX_DIGITS[bytes[i] >> 4];
+    out[3 + 2 * i] = HEX_DIGITS[bytes[i] & 0x0F];
+  }
+  out[len] = '\0';
+  return len;
+}
+
+inline int logHexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+// Inverse of encodeLogLine(); trailing "\r" / "\n" are ignored. False for
+// anything that is not a well-formed log line.
+inline bool decodeLogLine(const char *line, LogRecord &rec) {
+  if (strncmp(line, LOG_LINE_MARKER, 2) != 0) return false;
+  const char *hex = line + 2;
+  uint32_t hexLen = 0;
+  while (hex[hexLen] && hex[hexLen] != '\r' && hex[hexLen] != '\n') hexLen++;
+  if (hexLen % 2 != 0 || hexLen < 14 || hexLen > 2 * (7 + 4 * LOG_MAX_ARGS)) return false;
+  uint8_t bytes[7 + 4 * LOG_MAX_ARGS];
+  uint32_t n = hexLen / 2;
+  for (uint32_t i = 0; i < n; i++) {
+    int hi = logHexValue(hex[2 * i]);
+    int lo = logHexValue(hex[2 * i + 1]);
+    if (hi < 0 || lo < 0) return false;
+    bytes[i] = (uint8_t)((hi << 4) | lo);
+  }
+  rec.id = (uint16_t)(bytes[0] | (bytes[1] << 8));
+  rec.timestampUs = (uint32_t)bytes[2] | ((uint32_t)bytes[3] << 8) |
+                    ((uint32_t)bytes[4] << 16) | ((uint32_t)bytes[5] << 24);
+  rec.argc = bytes[6];
+  if (rec.argc > LOG_MAX_ARGS || n != 7 + 4u * rec.argc) return false;
+  for (int a = 0; a < rec.argc; a++) {
+    const uint8_t *p = bytes + 7 + 4 * a;
+    rec.args[a] = (int32_t)((uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+                            ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+  }
+  return true;
+}
+
+// Text of a record with its catalog format, without the timestamp
+inline int formatLogRecord(const LogRecord &rec, char *out, uint32_t size) {
+  if (rec.id >= LOG_MSG_COUNT) return snprintf(out, size, "<unknown log id %u>", rec.id);
+  int32_t a[LOG_MAX_ARGS] = {0};
+  for (int i = 0; i < rec.argc && i < LOG_MAX_ARGS; i++) a[i] = rec.args[i];
+  static_assert(LOG_MAX_ARGS == 6, "Update the snprintf argument list");
+  return snprintf(out, size, LOG_FORMATS[rec.id], a[0], a[1], a[2], a[3], a[4], a[5]);
+}
+
+#endif // BINLOG_H
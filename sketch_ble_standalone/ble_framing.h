@@ -0,0 +1,381 @@
+/*
+ * Last Drop - Notification Framing
+ *
+ * A BLE notification carries at most MTU - 3 bytes and the stack silently
+ * truncates anything longer. FragmentWriter splits a message that does not
+ * fit into sequenced fragments; one that fits is sent as-is, so short
+ * messages look exactly as before. NotifySender pushes the fragments to
+ * the link without blocking on congestion. Reassembler is the receiving
+ * side.
+ *
+ * Fragment:  [0xF0 | flags] [message seq] [fragment index] payload
+ *   flags:   FRAG_FIRST, FRAG_LAST
+ *   first fragment only: total message length (uint16 LE) before payload
+ *
+ * The marker never starts a whole message (JSON starts with '{', binary
+ * frames with 0xB_, see wire_protocol.h), so the receiver tells fragments
+ * from whole messages by the first byte. Fragments of one message are sent
+ * back to back and in order; a gap, a new seq or a length mismatch drops
+ * the partial message.
+ *
+ * The host build of this header is the reference for the app side.
+ */
+
+#ifndef BLE_FRAMING_H
+#define BLE_FRAMING_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define FRAG_MARKER 0xF0
+#define FRAG_MARKER_MASK 0xFC
+#define FRAG_FIRST 0x01
+#define FRAG_LAST 0x02
+#define FRAG_HEADER_SIZE 3
+#define FRAG_LENGTH_SIZE 2   // Total length, first fragment only
+#define FRAG_MAX_FRAGMENTS 256
+#define FRAG_MAX_MESSAGE 0xFFFF
+
+#define ATT_NOTIFY_OVERHEAD 3
+#define ATT_DEFAULT_MTU 23
+
+// Largest notification payload for a negotiated ATT MTU
+inline uint32_t notifyPayloadSize(uint16_t mtu) {
+  if (mtu < ATT_DEFAULT_MTU) mtu = ATT_DEFAULT_MTU;
+  return mtu - ATT_NOTIFY_OVERHEAD;
+}
+
+inline bool isFragment(const uint8_t *data, uint32_t len) {
+  return len >= FRAG_HEADER_SIZE && (data[0] & FRAG_MARKER_MASK) == FRAG_MARKER;
+}
+
+// Turns one message into the notification payloads to send, in order
+class FragmentWriter {
+public:
+  FragmentWriter() : msg(nullptr), msgLen(0), payloadSize(0), seq(0), offset(0), index(0), split(false), done(true) {}
+
+  // False if the message cannot be framed (too long, or payload too small)
+  bool begin(const uint8_t *message, uint32_t len, uint32_t payload, uint8_t messageSeq) {
+    msg = message;
+    msgLen = len;
+    payloadSize = payload;
+    seq = messageSeq;
+    offset = 0;
+    index = 0;
+    done = false;
+    split = len > payload || (len > 0 && (message[0] & FRAG_MARKER_MASK) == FRAG_MARKER);
+    if (!split) {
+      done = len == 0;
+      return !done;
+    }
+    if (payload <= FRAG_HEADER_SIZE + FRAG_LENGTH_SIZE || len > FRAG_MAX_MESSAGE) {
+      done = true;
+      return false;
+    }
+    if (fragmentCount() > FRAG_MAX_FRAGMENTS) {
+      done = true;
+      return false;
+    }
+    return true;
+  }
+
+  bool fragmented() const { return split; }
+
+  // The message was copied to message: continue from the same offset there
+  void rebase(const uint8_t *message) { msg = message; }
+
+  uint32_t fragmentCount() const {
+    if (!split) return msgLen > 0 ? 1 : 0;
+    uint32_t firstData = payloadSize - FRAG_HEADER_SIZE - FRAG_LENGTH_SIZE;
+    if (msgLen <= firstData) return 1;
+    uint32_t restData = payloadSize - FRAG_HEADER_SIZE;
+    return 1 + (msgLen - firstData + restData - 1) / restData;
+  }
+
+  // Writes the next payload (at most the payload size given to begin());
+  // false once everything has been handed out
+  bool next(uint8_t *out, uint32_t &outLen) {
+    if (done) return false;
+    if (!split) {
+      memcpy(out, msg, msgLen);
+      outLen = msgLen;
+      done = true;
+      return true;
+    }
+    bool first = offset == 0;
+    uint32_t pos = FRAG_HEADER_SIZE;
+    if (first) {
+      out[pos++] = (uint8_t)(msgLen & 0xFF);
+      out[pos++] = (uint8_t)(msgLen >> 8);
+    }
+    uint32_t chunk = payloadSize - pos;
+    if (chunk > msgLen - offset) chunk = msgLen - offset;
+    memcpy(out + pos, msg + offset, chunk);
+    offset += chunk;
+    bool last = offset >= msgLen;
+    out[0] = FRAG_MARKER | (first ? FRAG_FIRST : 0) | (last ? FRAG_LAST : 0);
+    out[1] = seq;
+    out[2] = (uint8_t)index++;
+    outLen = pos + chunk;
+    done = last;
+    return true;
+  }
+
+private:
+  const uint8_t *msg;
+  uint32_t msgLen;
+  uint32_t payloadSize;
+  uint8_t seq;
+  uint32_t offset;
+  uint32_t index;
+  bool split;
+  bool done;
+};
+
+enum NotifyResult {
+  NOTIFY_SENT = 0,      // Every fragment went out
+  NOTIFY_QUEUED,        // The link refused a fragment; the rest waits for pump()
+  NOTIFY_UNFRAMEABLE,   // Dropped: too long for the fragment format
+  NOTIFY_BACKLOG_FULL   // Dropped: no room to keep it while the link is busy
+};
+
+// Sends messages without waiting on a busy link. send(fragment, len)
+// offers one notification payload to the link and returns false if it is
+// refused (controller congested, send failed). The refused fragment stays
+// in the caller's fragment buffer and its message keeps its FragmentWriter
+// position, so pump() on a later pass resumes at exactly that fragment.
+// Messages sent meanwhile are copied into a BACKLOG-byte buffer behind it
+// and go out in order. A message that makes no progress for giveUpMs is
+// dropped, so a stuck link cannot hold the backlog forever.
+template <uint32_t BACKLOG>
+class NotifySender {
+public:
+  explicit NotifySender(uint32_t giveUpMs)
+      : giveUp(giveUpMs), used(0), writing(false), fragmentReady(false), fragmentLen(0), progressMs(0),
+        sentCount(0), refusedCount(0), droppedCount(0) {}
+
+  template <typename Send>
+  NotifyResult send(const uint8_t *message, uint32_t len, uint32_t payload, uint8_t seq,
+                    uint8_t *fragment, uint32_t nowMs, Send &&link) {
+    if (!pump(fragment, nowMs, link)) {
+      // Wait behind what is queued; framed when it reaches the head
+      FragmentWriter check;
+      if (!check.begin(message, len, payload, seq)) return drop(NOTIFY_UNFRAMEABLE);
+      return store(message, len, payload, seq) ? NOTIFY_QUEUED : drop(NOTIFY_BACKLOG_FULL);
+    }
+    if (!writer.begin(message, len, payload, seq)) return drop(NOTIFY_UNFRAMEABLE);
+    writing = true;
+    progressMs = nowMs;
+    if (drive(fragment, nowMs, link)) return NOTIFY_SENT;
+
+    // Refused part-way: keep the rest of this message
+    if (!store(message, len, payload, seq)) {
+      writing = false;
+      fragmentReady = false;
+      return drop(NOTIFY_BACKLOG_FULL);
+    }
+    writer.rebase(buf + sizeof(Header));
+    return NOTIFY_QUEUED;
+  }
+
+  // Offers what is waiting to the link again; true once nothing is left
+  template <typename Send>
+  bool pump(uint8_t *fragment, uint32_t nowMs, Send &&link) {
+    while (used > 0) {
+      Header h;
+      memcpy(&h, buf, sizeof(h));
+      if (!writing) {
+        if (!writer.begin(buf + sizeof(Header), h.len, h.payload, h.seq)) {
+          popHead();
+          droppedCount++;
+          continue;
+        }
+        writing = true;
+        progressMs = nowMs;
+      }
+      if (!drive(fragment, nowMs, link)) {
+        if (nowMs - progressMs <= giveUp) return false;
+        writing = false;
+        fragmentReady = false;
+        progressMs = nowMs;
+        popHead();
+        droppedCount++;  // Link stuck for giveUpMs
+        continue;
+      }
+      popHead();
+    }
+    return true;
+  }
+
+  // Forgets everything waiting (the link went away)
+  void reset() {
+    used = 0;
+    writing = false;
+    fragmentReady = false;
+  }
+
+  bool idle() const { return used == 0; }
+  uint32_t backlogBytes() const { return used; }
+  uint32_t fragmentsSent() const { return sentCount; }
+  uint32_t refusals() const { return refusedCount; }
+  uint32_t dropped() const { return droppedCount; }
+
+private:
+  struct Header {
+    uint16_t len;
+    uint16_t payload;
+    uint8_t seq;
+  };
+
+  // Sends the current message's fragments until one is refused (false)
+  // or all are out (true)
+  template <typename Send>
+  bool drive(uint8_t *fragment, uint32_t nowMs, Send &link) {
+    for (;;) {
+      if (!fragmentReady) {
+        if (!writer.next(fragment, fragmentLen)) {
+          writing = false;
+          return true;
+        }
+        fragmentReady = true;
+      }
+      if (!link(fragment, fragmentLen)) {
+        refusedCount++;
+        return false;
+      }
+      fragmentReady = false;
+      sentCount++;
+      progressMs = nowMs;
+    }
+  }
+
+  bool store(const uint8_t *message, uint32_t len, uint32_t payload, uint8_t seq) {
+    if (len > FRAG_MAX_MESSAGE || sizeof(Header) + len > BACKLOG - used) return false;
+    Header h;
+    h.len = (uint16_t)len;
+    h.payload = (uint16_t)payload;
+    h.seq = seq;
+    memcpy(buf + used, &h, sizeof(h));
+    memcpy(buf + used + sizeof(h), message, len);
+    used += sizeof(h) + len;
+    return true;
+  }
+
+  void popHead() {
+    Header h;
+    memcpy(&h, buf, sizeof(h));
+    uint32_t size = sizeof(h) + h.len;
+    used -= size;
+    memmove(buf, buf + size, used);
+  }
+
+  NotifyResult drop(NotifyResult why) {
+    droppedCount++;
+    return why;
+  }
+
+  uint8_t buf[BACKLOG];
+  uint32_t giveUp;
+  uint32_t used;
+  FragmentWriter writer;
+  bool writing;
+  bool fragmentReady;
+  uint32_t fragmentLen;
+  uint32_t progressMs;
+  uint32_t sentCount;
+  uint32_t refusedCount;
+  uint32_t droppedCount;
+};
+
+enum ReassemblyResult {
+  REASM_PENDING = 0,  // Fragment stored, message not complete yet
+  REASM_COMPLETE,     // message() / length() hold a whole message
+  REASM_ERROR         // Fragment rejected; any partial message was dropped
+};
+
+// Receiving side. A whole (unfragmented) notification completes at once
+// and message() points at the caller's buffer; fragments are copied into
+// a fixed MAX_MESSAGE buffer.
+template <uint32_t MAX_MESSAGE>
+class Reassembler {
+public:
+  Reassembler() : active(false), seq(0), nextIndex(0), expected(0), received(0),
+                  out(nullptr), outLen(0), completed(0), errors(0) {}
+
+  ReassemblyResult feed(const uint8_t *data, uint32_t len) {
+    out = nullptr;
+    outLen = 0;
+    if (len == 0) return reject();
+    if (!isFragment(data, len)) {
+      if ((data[0] & FRAG_MARKER_MASK) == FRAG_MARKER) return reject();  // Short fragment
+      if (active) errors++;  // Partial message interrupted
+      active = false;
+      return complete(data, len);
+    }
+
+    uint8_t flags = data[0] & ~FRAG_MARKER_MASK;
+    const uint8_t *payload = data + FRAG_HEADER_SIZE;
+    uint32_t payloadLen = len - FRAG_HEADER_SIZE;
+
+    if (flags & FRAG_FIRST) {
+      if (active) errors++;  // Previous message never finished
+      active = false;
+      if (data[2] != 0 || payloadLen < FRAG_LENGTH_SIZE) return reject();
+      expected = payload[0] | ((uint32_t)payload[1] << 8);
+      if (expected > MAX_MESSAGE) return reject();
+      payload += FRAG_LENGTH_SIZE;
+      payloadLen -= FRAG_LENGTH_SIZE;
+      active = true;
+      seq = data[1];
+      nextIndex = 0;
+      received = 0;
+    } else if (!active || data[1] != seq || data[2] != nextIndex) {
+      return reject();
+    }
+
+    if (received + payloadLen > expected) return reject();
+    memcpy(buffer + received, payload, payloadLen);
+    received += payloadLen;
+    nextIndex = (uint8_t)(nextIndex + 1);
+
+    if (flags & FRAG_LAST) {
+      active = false;
+      if (received != expected) return reject();
+      return complete(buffer, received);
+    }
+    return REASM_PENDING;
+  }
+
+  const uint8_t *message() const { return out; }
+  uint32_t length() const { return outLen; }
+  bool inProgress() const { return active; }
+  uint32_t completedCount() const { return completed; }
+  uint32_t errorCount() const { return errors; }
+
+private:
+  uint8_t buffer[MAX_MESSAGE];
+  bool active;
+  uint8_t seq;
+  uint8_t nextIndex;
+  uint32_t expected;
+  uint32_t received;
+  const uint8_t *out;
+  uint32_t outLen;
+  uint32_t completed;
+  uint32_t errors;
+
+  ReassemblyResult complete(const uint8_t *data, uint32_t len) {
+    out = data;
+    outLen = len;
+    completed++;
+    return REASM_COMPLETE;
+  }
+
+  ReassemblyResult reject() {
+    active = false;
+    errors++;
+    return REASM_ERROR;
+  }
+};
+
+#endif // BLE_FRAMING_H
@@ -0,0 +1,591 @@
+/*
+ * Last Drop - Command Layer
+ *
+ * Everything between a command's raw bytes and its handler: the typed
+ * argument structs, their JSON and binary (wire_protocol.h) parsers, and
+ * dispatchCommand(), which detects the encoding, resolves the CommandId,
+ * applies the pairing gate, parses and validates, then calls the handler.
+ *
+ * Handlers are reached through a Board class (BoardCommands in the sketch
+ * forwards to the game; the host harness in test/ plugs in a model of the
+ * board), so the tests, the fuzzer and the throughput bench run this exact
+ * code:
+ *
+ *   bool paired();
+ *   void received(CommandId id, uint32_t len, bool binary, const RequestTag& request);
+ *   void handleRoll(const RollArgs&);      void handleUndo();
+ *   void handleReset();                    void handlePair(const PairArgs&);
+ *   void handleUnpair();                   void handleConfig(const ConfigArgs&);
+ *   void handleSyncState(const SyncStateArgs&);
+ *   void handleUpdateSettings(const UpdateSettingsArgs&);
+ *   void sendStatus();                     void sendTaskStats(bool reset);
+ *   void sendProfile(bool reset);          void handleVictory(const VictoryArgs&);
+ *   void handleStateAck(const StateAckArgs&);
+ *   void handleResync(const ResyncArgs&);
+ *
+ * JSON commands need ArduinoJson, which the sketch includes first. A build
+ * without it (the host, unless ArduinoJson is installed) rejects them with
+ * an error and still covers the binary path.
+ */
+
+#ifndef COMMAND_LAYER_H
+#define COMMAND_LAYER_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "command_table.h"
+#include "wire_protocol.h"
+
+#ifndef NUM_PLAYERS
+#define NUM_PLAYERS 4
+#endif
+
+#ifndef NUM_TILES
+#define NUM_TILES 20
+#endif
+
+inline int commandMin(int a, int b) { return a < b ? a : b; }
+
+// ==================== ARGUMENTS ====================
+// Filled and checked by the parse*Args functions before a handler runs, so
+// handlers never see missing or out-of-range fields. Strings point into the
+// command ring slot and are only valid until the command is popped.
+
+// Commands rejected before parsing while the board is not paired
+constexpr uint32_t PAIRED_COMMANDS = (1u << CMD_ROLL) | (1u << CMD_UPDATE_SETTINGS);
+
+struct RollArgs {
+  int playerId;   // 0..NUM_PLAYERS-1 (checked against activePlayerCount by the handler)
+  int diceValue;  // 1..12
+};
+
+struct PairArgs {
+  const char* password;  // nullptr if missing
+  uint8_t wireVersion;   // Highest binary version the app accepts, 0 = JSON only
+};
+
+struct ConfigArgs {
+  int playerCount;                    // 2..NUM_PLAYERS
+  uint8_t colorCount;
+  uint32_t colors[NUM_PLAYERS];       // 0xRRGGBB as sent
+  bool hasHallSensorMode;
+  bool hallSensorMode;
+  bool hasTurnDelay;
+  int turnDelaySeconds;               // 1..300 when present
+  bool hasCommandBudget;
+  uint32_t commandBudgetUs;           // 500..50000 when present
+};
+
+struct SyncStateArgs {
+  bool gameActive;
+  int playerCount;                    // 2..NUM_PLAYERS when gameActive
+  uint8_t colorCount;
+  uint8_t positionCount;
+  uint8_t scoreCount;
+  uint8_t aliveCount;
+  uint32_t colors[NUM_PLAYERS];       // 0xRRGGBB as sent
+  int positions[NUM_PLAYERS];
+  int scores[NUM_PLAYERS];
+  bool alive[NUM_PLAYERS];
+};
+
+struct UpdateSettingsArgs {
+  const char* password;  // nullptr if not being changed, else >= 6 chars
+  const char* nickname;  // nullptr if not being changed, else 1..30 chars
+};
+
+struct StateAckArgs {
+  uint32_t seq;
+  bool hasChecksum;
+  uint32_t checksum;  // App's checksum at seq, to detect divergence
+};
+
+struct ResyncArgs {
+  uint32_t seq;       // Last seq the app applied
+  uint32_t checksum;  // Its checksum of the state at seq
+};
+
+struct VictoryArgs {
+  int winnerId;             // 0..NUM_PLAYERS-1
+  const char* winnerColor;  // nullptr if missing
+  const char* winnerName;   // nullptr if missing
+};
+
+// ==================== PARSING ====================
+// Each returns nullptr when args is filled and valid, else the error to send
+
+// "RRGGBB" -> 0xRRGGBB; false if not six hex digits
+inline bool parseHexColor(const char* hex, uint32_t& color) {
+  if (hex == nullptr || strlen(hex) != 6) return false;
+  char* end = nullptr;
+  color = (uint32_t)strtoul(hex, &end, 16);
+  return *end == '\0';
+}
+
+#ifdef ARDUINOJSON_VERSION
+
+inline const char* parseRollArgs(JsonDocument& doc, RollArgs& args) {
+  if (!doc["playerId"].is<int>() || !doc["diceValue"].is<int>()) {
+    return "Missing playerId or diceValue";
+  }
+  args.playerId = doc["playerId"];
+  args.diceValue = doc["diceValue"];
+  if (args.playerId < 0 || args.playerId >= NUM_PLAYERS) return "Invalid player ID";
+  if (args.diceValue < 1 || args.diceValue > 12) return "Invalid dice value";
+  return nullptr;
+}
+
+inline const char* parsePairArgs(JsonDocument& doc, PairArgs& args) {
+  args.password = doc["password"];
+  args.wireVersion = doc["wire"] | 0;
+  return nullptr;  // A missing password is answered with pair_failed
+}
+
+inline const char* parseConfigArgs(JsonDocument& doc, ConfigArgs& args) {
+  args.playerCount = doc["playerCount"] | 0;
+  if (args.playerCount < 2 || args.playerCount > NUM_PLAYERS) return "Invalid player count";
+  
+  JsonArray colorsArray = doc["colors"];
+  args.colorCount = commandMin((int)colorsArray.size(), args.playerCount);
+  for (int i = 0; i < args.colorCount; i++) {
+    if (!parseHexColor(colorsArray[i].as<const char*>(), args.colors[i])) return "Invalid player color";
+  }
+  
+  args.hasHallSensorMode = doc.containsKey("hallSensorMode");
+  args.hallSensorMode = doc["hallSensorMode"] | false;
+  
+  // Out-of-range optional settings are ignored, as before
+  int delaySeconds = doc["turnDelaySeconds"] | 0;
+  args.hasTurnDelay = delaySeconds >= 1 && delaySeconds <= 300;  // 1s to 5 minutes
+  args.turnDelaySeconds = delaySeconds;
+  
+  uint32_t budgetUs = doc["commandBudgetUs"] | 0;
+  args.hasCommandBudget = budgetUs >= 500 && budgetUs <= 50000;
+  args.commandBudgetUs = budgetUs;
+  return nullptr;
+}
+
+inline const char* parseSyncStateArgs(JsonDocument& doc, SyncStateArgs& args) {
+  args.gameActive = doc["gameActive"] | false;
+  args.playerCount = doc["playerCount"] | 0;
+  args.colorCount = args.positionCount = args.scoreCount = args.aliveCount = 0;
+  if (!args.gameActive) return nullptr;  // Nothing else is read
+  if (args.playerCount < 2 || args.playerCount > NUM_PLAYERS) return "Invalid player count";
+  
+  JsonArray colorsArray = doc["colors"];
+  JsonArray positionsArray = doc["positions"];
+  JsonArray scoresArray = doc["scores"];
+  JsonArray aliveArray = doc["alive"];
+  
+  args.colorCount = commandMin((int)colorsArray.size(), args.playerCount);
+  for (int i = 0; i < args.colorCount; i++) {
+    if (!parseHexColor(colorsArray[i].as<const char*>(), args.colors[i])) return "Invalid player color";
+  }
+  args.positionCount = commandMin((int)positionsArray.size(), args.playerCount);
+  for (int i = 0; i < args.positionCount; i++) {
+    args.positions[i] = positionsArray[i];
+    if (args.positions[i] < 1 || args.positions[i] > NUM_TILES) return "Invalid player position";
+  }
+  args.scoreCount = commandMin((int)scoresArray.size(), args.playerCount);
+  for (int i = 0; i < args.scoreCount; i++) {
+    args.scores[i] = scoresArray[i];
+  }
+  args.aliveCount = commandMin((int)aliveArray.size(), args.playerCount);
+  for (int i = 0; i < args.aliveCount; i++) {
+    args.alive[i] = aliveArray[i];
+  }
+  return nullptr;
+}
+
+inline const char* parseUpdateSettingsArgs(JsonDocument& doc, UpdateSettingsArgs& args) {
+  args.password = doc["password"];
+  args.nickname = doc["nickname"];
+  if (args.password != nullptr && strlen(args.password) < 6) {
+    return "Password must be at least 6 characters";
+  }
+  if (args.nickname != nullptr && (strlen(args.nickname) == 0 || strlen(args.nickname) > 30)) {
+    return "Nickname must be 1-30 characters";
+  }
+  if (args.password == nullptr && args.nickname == nullptr) return "No valid settings provided";
+  return nullptr;
+}
+
+inline const char* parseVictoryArgs(JsonDocument& doc, VictoryArgs& args) {
+  args.winnerId = doc["winnerId"] | 0;
+  args.winnerColor = doc["winnerColor"];
+  args.winnerName = doc["winnerName"];
+  if (args.winnerId < 0 || args.winnerId >= NUM_PLAYERS) return "Invalid winner ID";
+  return nullptr;
+}
+
+inline const char* parseStateAckArgs(JsonDocument& doc, StateAckArgs& args) {
+  if (!doc["seq"].is<uint32_t>()) return "Missing seq";
+  args.seq = doc["seq"];
+  args.hasChecksum = doc["checksum"].is<uint32_t>();
+  args.checksum = doc["checksum"] | 0u;
+  return nullptr;
+}
+
+inline const char* parseResyncArgs(JsonDocument& doc, ResyncArgs& args) {
+  if (!doc["seq"].is<uint32_t>() || !doc["checksum"].is<uint32_t>()) return "Missing seq or checksum";
+  args.seq = doc["seq"];
+  args.checksum = doc["checksum"];
+  return nullptr;
+}
+
+#endif // ARDUINOJSON_VERSION
+
+// Binary frames (wire_protocol.h) carry the same fields; unknown tags are
+// skipped and repeated tags fill the per-player lists in order
+
+inline bool wireFlag(const WireReader& wire, uint8_t tag) {
+  int32_t value = 0;
+  return wire.findInt(tag, value) && value != 0;
+}
+
+inline const char* parseRollArgs(WireReader& wire, RollArgs& args) {
+  bool hasPlayer = false, hasDice = false;
+  WireField field;
+  while (wire.next(field)) {
+    if (field.kind != WIRE_KIND_INT) continue;
+    if (field.tag == WIRE_TAG_PLAYER_ID) {
+      args.playerId = field.value;
+      hasPlayer = true;
+    } else if (field.tag == WIRE_TAG_DICE_VALUE) {
+      args.diceValue = field.value;
+      hasDice = true;
+    }
+  }
+  if (wire.error()) return "Malformed binary command";
+  if (!hasPlayer || !hasDice) return "Missing playerId or diceValue";
+  if (args.playerId < 0 || args.playerId >= NUM_PLAYERS) return "Invalid player ID";
+  if (args.diceValue < 1 || args.diceValue > 12) return "Invalid dice value";
+  return nullptr;
+}
+
+inline const char* parsePairArgs(WireReader& wire, PairArgs& args) {
+  args.password = nullptr;
+  args.wireVersion = wire.version();  // Pairing in binary implies support
+  WireField field;
+  while (wire.next(field)) {
+    if (field.tag == WIRE_TAG_PASSWORD) args.password = field.str();
+  }
+  if (wire.error()) return "Malformed binary command";
+  return nullptr;
+}
+
+inline const char* parseConfigArgs(WireReader& wire, ConfigArgs& args) {
+  args.playerCount = 0;
+  args.colorCount = 0;
+  args.hasHallSensorMode = false;
+  args.hallSensorMode = false;
+  int delaySeconds = 0;
+  int32_t budgetUs = 0;
+  WireField field;
+  while (wire.next(field)) {
+    if (field.kind != WIRE_KIND_INT) continue;
+    switch (field.tag) {
+      case WIRE_TAG_PLAYER_COUNT: args.playerCount = field.value; break;
+      case WIRE_TAG_COLOR:
+        if (args.colorCount < NUM_PLAYERS) args.colors[args.colorCount++] = (uint32_t)field.value & 0xFFFFFF;
+        break;
+      case WIRE_TAG_HALL_MODE:
+        args.hasHallSensorMode = true;
+        args.hallSensorMode = field.value != 0;
+        break;
+      case WIRE_TAG_TURN_DELAY_S: delaySeconds = field.value; break;
+      case WIRE_TAG_BUDGET_US: budgetUs = field.value; break;
+    }
+  }
+  if (wire.error()) return "Malformed binary command";
+  if (args.playerCount < 2 || args.playerCount > NUM_PLAYERS) return "Invalid player count";
+  args.colorCount = commandMin((int)args.colorCount, args.playerCount);
+  args.hasTurnDelay = delaySeconds >= 1 && delaySeconds <= 300;
+  args.turnDelaySeconds = delaySeconds;
+  args.hasCommandBudget = budgetUs >= 500 && budgetUs <= 50000;
+  args.commandBudgetUs = budgetUs;
+  return nullptr;
+}
+
+inline const char* parseSyncStateArgs(WireReader& wire, SyncStateArgs& args) {
+  args.gameActive = false;
+  args.playerCount = 0;
+  args.colorCount = args.positionCount = args.scoreCount = args.aliveCount = 0;
+  WireField field;
+  while (wire.next(field)) {
+    if (field.kind != WIRE_KIND_INT) continue;
+    switch (field.tag) {
+      case WIRE_TAG_GAME_ACTIVE: args.gameActive = field.value != 0; break;
+      case WIRE_TAG_PLAYER_COUNT: args.playerCount = field.value; break;
+      case WIRE_TAG_COLOR:
+        if (args.colorCount < NUM_PLAYERS) args.colors[args.colorCount++] = (uint32_t)field.value & 0xFFFFFF;
+        break;
+      case WIRE_TAG_POSITION:
+        if (args.positionCount < NUM_PLAYERS) args.positions[args.positionCount++] = field.value;
+        break;
+      case WIRE_TAG_SCORE:
+        if (args.scoreCount < NUM_PLAYERS) args.scores[args.scoreCount++] = field.value;
+        break;
+      case WIRE_TAG_ALIVE:
+        if (args.aliveCount < NUM_PLAYERS) args.alive[args.aliveCount++] = field.value != 0;
+        break;
+    }
+  }
+  if (wire.error()) return "Malformed binary command";
+  if (!args.gameActive) return nullptr;
+  if (args.playerCount < 2 || args.playerCount > NUM_PLAYERS) return "Invalid player count";
+  args.colorCount = commandMin((int)args.colorCount, args.playerCount);
+  args.positionCount = commandMin((int)args.positionCount, args.playerCount);
+  args.scoreCount = commandMin((int)args.scoreCount, args.playerCount);
+  args.aliveCount = commandMin((int)args.aliveCount, args.playerCount);
+  for (int i = 0; i < args.positionCount; i++) {
+    if (args.positions[i] < 1 || args.positions[i] > NUM_TILES) return "Invalid player position";
+  }
+  return nullptr;
+}
+
+inline const char* parseUpdateSettingsArgs(WireReader& wire, UpdateSettingsArgs& args) {
+  args.password = nullptr;
+  args.nickname = nullptr;
+  WireField field;
+  while (wire.next(field)) {
+    if (field.tag == WIRE_TAG_PASSWORD) args.password = field.str();
+    else if (field.tag == WIRE_TAG_NICKNAME) args.nickname = field.str();
+  }
+  if (wire.error()) return "Malformed binary command";
+  if (args.password != nullptr && strlen(args.password) < 6) {
+    return "Password must be at least 6 characters";
+  }
+  if (args.nickname != nullptr && (strlen(args.nickname) == 0 || strlen(args.nickname) > 30)) {
+    return "Nickname must be 1-30 characters";
+  }
+  if (args.password == nullptr && args.nickname == nullptr) return "No valid settings provided";
+  return nullptr;
+}
+
+inline const char* parseVictoryArgs(WireReader& wire, VictoryArgs& args) {
+  args.winnerId = 0;
+  args.winnerColor = nullptr;
+  args.winnerName = nullptr;
+  WireField field;
+  while (wire.next(field)) {
+    if (field.tag == WIRE_TAG_WINNER_ID && field.kind == WIRE_KIND_INT) args.winnerId = field.value;
+    else if (field.tag == WIRE_TAG_WINNER_COLOR) args.winnerColor = field.str();
+    else if (field.tag == WIRE_TAG_WINNER_NAME) args.winnerName = field.str();
+  }
+  if (wire.error()) return "Malformed binary command";
+  if (args.winnerId < 0 || args.winnerId >= NUM_PLAYERS) return "Invalid winner ID";
+  return nullptr;
+}
+
+inline const char* parseStateAckArgs(WireReader& wire, StateAckArgs& args) {
+  bool hasSeq = false;
+  args.hasChecksum = false;
+  args.checksum = 0;
+  WireField field;
+  while (wire.next(field)) {
+    if (field.kind != WIRE_KIND_INT) continue;
+    if (field.tag == WIRE_TAG_SEQ) {
+      args.seq = (uint32_t)field.value;
+      hasSeq = true;
+    } else if (field.tag == WIRE_TAG_CHECKSUM) {
+      args.checksum = (uint32_t)field.value;
+      args.hasChecksum = true;
+    }
+  }
+  if (wire.error()) return "Malformed binary command";
+  if (!hasSeq) return "Missing seq";
+  return nullptr;
+}
+
+inline const char* parseResyncArgs(WireReader& wire, ResyncArgs& args) {
+  bool hasSeq = false, hasChecksum = false;
+  WireField field;
+  while (wire.next(field)) {
+    if (field.kind != WIRE_KIND_INT) continue;
+    if (field.tag == WIRE_TAG_SEQ) {
+      args.seq = (uint32_t)field.value;
+      hasSeq = true;
+    } else if (field.tag == WIRE_TAG_CHECKSUM) {
+      args.checksum = (uint32_t)field.value;
+      hasChecksum = true;
+    }
+  }
+  if (wire.error()) return "Malformed binary command";
+  if (!hasSeq || !hasChecksum) return "Missing seq or checksum";
+  return nullptr;
+}
+
+// ==================== REQUEST IDS ====================
+// A command may carry a request id ("id" in JSON, WIRE_TAG_REQUEST_ID in a
+// frame) so the app can pipeline requests instead of waiting out a BLE
+// round trip for each. The board echoes it on everything the command
+// causes: its response or error, events sent while it runs, and deferred
+// events (coin_placed, coin_timeout, heartbeat for a roll). Unsolicited
+// events (dice, misplacement scans, state deltas) carry none. Ordering
+// per category is described with COMMAND_CATEGORIES (command_table.h).
+
+struct RequestTag {
+  bool has;
+  uint32_t id;
+};
+
+const RequestTag NO_REQUEST = {false, 0};
+
+// Adds "id" to a serialized JSON object in place. Returns the new length,
+// or 0 if it no longer fits in capacity (with its NUL).
+inline uint32_t appendRequestId(char* json, uint32_t len, uint32_t capacity, const RequestTag& request) {
+  if (!request.has || len < 2 || json[len - 1] != '}') return len;
+  bool empty = json[len - 2] == '{';
+  uint32_t at = len - 1;
+  int n = snprintf(json + at, capacity - at, "%s\"id\":%lu}", empty ? "" : ",", (unsigned long)request.id);
+  if (n < 0 || at + (uint32_t)n + 1 > capacity) return 0;
+  return at + (uint32_t)n;
+}
+
+inline void appendRequestId(WireWriter& frame, const RequestTag& request) {
+  if (request.has) frame.putInt(WIRE_TAG_REQUEST_ID, (int32_t)request.id);
+}
+
+// ==================== DISPATCH ====================
+
+// Parse and run one command. cmd must be NUL-terminated and writable: both
+// encodings parse in place, and string args point into it. Returns nullptr,
+// or the error to send back; id is set to the command run (CMD_UNKNOWN if
+// none was). The board learns the request id through received(), before
+// any handler runs, and keeps it until the error (if any) has been sent.
+template <class Board>
+const char* dispatchCommand(Board& board, char* cmd, uint32_t len, CommandId& id) {
+  bool binary = isWireFrame((const uint8_t*)cmd, len);
+  WireReader wire((const uint8_t*)cmd, len);
+  const char* argError = nullptr;
+  RequestTag request = NO_REQUEST;
+  id = CMD_UNKNOWN;
+  
+#ifdef ARDUINOJSON_VERSION
+  StaticJsonDocument<512> doc;
+#endif
+  
+  if (binary) {
+    if (!wire.valid()) {
+      argError = "Unsupported binary frame version";
+    } else {
+      if (wire.type() < CMD_COUNT) id = (CommandId)wire.type();
+      int32_t requestId = 0;
+      if (wire.findInt(WIRE_TAG_REQUEST_ID, requestId)) request = {true, (uint32_t)requestId};
+    }
+  } else {
+#ifdef ARDUINOJSON_VERSION
+    if (deserializeJson(doc, cmd, len)) {
+      argError = "Invalid JSON format";
+    } else {
+      id = lookupCommand(doc["command"] | "");
+      JsonVariant requestId = doc["id"];
+      if (requestId.is<uint32_t>()) {
+        request = {true, requestId.as<uint32_t>()};
+      } else if (!requestId.isNull()) {
+        argError = "Invalid request id";
+        id = CMD_UNKNOWN;
+      }
+    }
+#else
+    argError = "JSON commands not supported in this build";
+#endif
+  }
+  
+  board.received(id, len, binary, request);
+  
+  if (id != CMD_UNKNOWN && (PAIRED_COMMANDS & (1u << id)) && !board.paired()) {
+    argError = "Device not paired - pairing required";
+    id = CMD_UNKNOWN;  // Handled; counted with the rejects
+  }
+  
+#ifdef ARDUINOJSON_VERSION
+#define COMMAND_PARSE(parser, args) (binary ? parser(wire, args) : parser(doc, args))
+#define COMMAND_FLAG(tag, key) (binary ? wireFlag(wire, tag) : (doc[key] | false))
+#else
+#define COMMAND_PARSE(parser, args) parser(wire, args)
+#define COMMAND_FLAG(tag, key) wireFlag(wire, tag)
+#endif
+  
+  switch (id) {
+    case CMD_ROLL: {
+      RollArgs args;
+      argError = COMMAND_PARSE(parseRollArgs, args);
+      if (argError == nullptr) board.handleRoll(args);
+      break;
+    }
+    case CMD_UNDO:
+      board.handleUndo();
+      break;
+    case CMD_RESET:
+      board.handleReset();
+      break;
+    case CMD_PAIR: {
+      PairArgs args;
+      argError = COMMAND_PARSE(parsePairArgs, args);
+      if (argError == nullptr) board.handlePair(args);
+      break;
+    }
+    case CMD_UNPAIR:
+      board.handleUnpair();
+      break;
+    case CMD_CONFIG: {
+      ConfigArgs args;
+      argError = COMMAND_PARSE(parseConfigArgs, args);
+      if (argError == nullptr) board.handleConfig(args);
+      break;
+    }
+    case CMD_SYNC_STATE: {
+      SyncStateArgs args;
+      argError = COMMAND_PARSE(parseSyncStateArgs, args);
+      if (argError == nullptr) board.handleSyncState(args);
+      break;
+    }
+    case CMD_UPDATE_SETTINGS: {
+      UpdateSettingsArgs args;
+      argError = COMMAND_PARSE(parseUpdateSettingsArgs, args);
+      if (argError == nullptr) board.handleUpdateSettings(args);
+      break;
+    }
+    case CMD_STATUS:
+      board.sendStatus();
+      break;
+    case CMD_TASK_STATS:
+      board.sendTaskStats(COMMAND_FLAG(WIRE_TAG_RESET, "reset"));
+      break;
+    case CMD_PROFILE:
+      board.sendProfile(COMMAND_FLAG(WIRE_TAG_RESET, "reset"));
+      break;
+    case CMD_VICTORY: {
+      VictoryArgs args;
+      argError = COMMAND_PARSE(parseVictoryArgs, args);
+      if (argError == nullptr) board.handleVictory(args);
+      break;
+    }
+    case CMD_STATE_ACK: {
+      StateAckArgs args;
+      argError = COMMAND_PARSE(parseStateAckArgs, args);
+      if (argError == nullptr) board.handleStateAck(args);
+      break;
+    }
+    case CMD_RESYNC: {
+      ResyncArgs args;
+      argError = COMMAND_PARSE(parseResyncArgs, args);
+      if (argError == nullptr) board.handleResync(args);
+      break;
+    }
+    default:
+      if (argError == nullptr) argError = "Unknown command";
+      break;
+  }
+  
+#undef COMMAND_PARSE
+#undef COMMAND_FLAG
+  
+  return argError;
+}
+
+#endif // COMMAND_LAYER_H
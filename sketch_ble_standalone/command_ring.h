@@ -0,0 +1,115 @@
+/*
+ * Last Drop - BLE Command Ring
+ *
+ * Hands raw command bytes from the BLE write callback (Bluedroid task) to
+ * the game task without touching the heap. The ring has SLOTS fixed slots
+ * of SLOT_SIZE bytes each (the largest ATT attribute value), and every slot
+ * is NUL-terminated so the consumer can parse it in place.
+ *
+ * Exactly one task may push() and exactly one task may front()/pop().
+ * Indices are free-running and published with release / acquire, so a slot
+ * is only reused after the consumer has popped it.
+ *
+ * A full ring drops the new command (counted in droppedCount()) rather than
+ * blocking the BLE stack; commands longer than SLOT_SIZE are rejected and
+ * counted in oversizeCount(). The game task reports both back to the app.
+ *
+ * Each slot also carries a caller-supplied stamp (the enqueue time in us on
+ * the board) so the consumer can measure how long a command waited.
+ */
+
+#ifndef COMMAND_RING_H
+#define COMMAND_RING_H
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+enum CommandPushResult {
+  CMD_PUSH_OK = 0,
+  CMD_PUSH_FULL,
+  CMD_PUSH_TOO_LONG,
+  CMD_PUSH_EMPTY
+};
+
+template <uint32_t SLOTS, uint32_t SLOT_SIZE>
+class CommandRing {
+  static_assert(SLOTS > 0 && (SLOTS & (SLOTS - 1)) == 0, "CommandRing slot count must be a power of two");
+
+public:
+  CommandRing() : head(0), tail(0), dropped(0), oversize(0), peak(0) {}
+
+  // Producer side: copy one command into the next free slot
+  CommandPushResult push(const uint8_t *data, uint32_t len, uint32_t stamp = 0) {
+    if (len == 0) return CMD_PUSH_EMPTY;
+    if (len > SLOT_SIZE) {
+      oversize.fetch_add(1, std::memory_order_relaxed);
+      return CMD_PUSH_TOO_LONG;
+    }
+    uint32_t h = head.load(std::memory_order_relaxed);
+    uint32_t t = tail.load(std::memory_order_acquire);
+    uint32_t depth = h - t;
+    if (depth >= SLOTS) {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return CMD_PUSH_FULL;
+    }
+    Slot &slot = slots[h & (SLOTS - 1)];
+    memcpy(slot.data, data, len);
+    slot.data[len] = '\0';
+    slot.len = len;
+    slot.stamp = stamp;
+    head.store(h + 1, std::memory_order_release);
+    if (depth + 1 > peak.load(std::memory_order_relaxed)) {
+      peak.store(depth + 1, std::memory_order_relaxed);
+    }
+    return CMD_PUSH_OK;
+  }
+
+  // Consumer side: oldest command (NUL-terminated, writable in place until
+  // pop()), or nullptr when empty. stamp receives the value given to push().
+  char *front(uint32_t &len, uint32_t *stamp = nullptr) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return nullptr;
+    Slot &slot = slots[t & (SLOTS - 1)];
+    len = slot.len;
+    if (stamp != nullptr) *stamp = slot.stamp;
+    return slot.data;
+  }
+
+  // Consumer side: release the slot returned by front()
+  void pop() {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return;
+    tail.store(t + 1, std::memory_order_release);
+  }
+
+  bool empty() const {
+    return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+  }
+
+  uint32_t size() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+  }
+
+  uint32_t capacity() const { return SLOTS; }
+  uint32_t slotSize() const { return SLOT_SIZE; }
+  uint32_t droppedCount() const { return dropped.load(std::memory_order_relaxed); }
+  uint32_t oversizeCount() const { return oversize.load(std::memory_order_relaxed); }
+  uint32_t highWater() const { return peak.load(std::memory_order_relaxed); }
+
+private:
+  struct Slot {
+    uint32_t len;
+    uint32_t stamp;
+    char data[SLOT_SIZE + 1];
+  };
+
+  Slot slots[SLOTS];
+  std::atomic<uint32_t> head;
+  std::atomic<uint32_t> tail;
+  std::atomic<uint32_t> dropped;
+  std::atomic<uint32_t> oversize;
+  std::atomic<uint32_t> peak;     // Deepest the ring has been
+};
+
+#endif // COMMAND_RING_H
@@ -0,0 +1,151 @@
+/*
+ * Last Drop - Command Name Table
+ *
+ * Maps the "command" string of a BLE command to a CommandId with one hash
+ * and one strcmp instead of a strcmp chain. The hash is FNV-1a with a seed
+ * chosen at compile time so every name lands in its own slot of a small
+ * power-of-two table (a perfect hash); adding a name that cannot be placed
+ * fails the build rather than slowing dispatch down.
+ *
+ * To add a command: append to CommandId (before CMD_COUNT), and to
+ * COMMAND_NAMES and COMMAND_CATEGORIES in the same order.
+ */
+
+#ifndef COMMAND_TABLE_H
+#define COMMAND_TABLE_H
+
+#include <stdint.h>
+#include <string.h>
+
+enum CommandId : uint8_t {
+  CMD_ROLL = 0,
+  CMD_UNDO,
+  CMD_RESET,
+  CMD_PAIR,
+  CMD_UNPAIR,
+  CMD_CONFIG,
+  CMD_SYNC_STATE,
+  CMD_UPDATE_SETTINGS,
+  CMD_STATUS,
+  CMD_TASK_STATS,
+  CMD_PROFILE,
+  CMD_VICTORY,
+  CMD_STATE_ACK,
+  CMD_RESYNC,
+  CMD_COUNT,
+  CMD_UNKNOWN = 0xFF
+};
+
+constexpr const char *COMMAND_NAMES[CMD_COUNT] = {
+  "roll",
+  "undo",
+  "reset",
+  "pair",
+  "unpair",
+  "config",
+  "sync_state",
+  "update_settings",
+  "status",
+  "task_stats",
+  "profile",
+  "victory",
+  "state_ack",
+  "resync"
+};
+
+// Ordering classes for pipelined requests. The board answers the commands
+// of one category in the order they were written, including events a
+// command triggers later (a roll's coin_placed / coin_timeout); across
+// categories, responses can interleave and are matched by request id
+// (command_layer.h). Once a later GAME command runs, events of a wait an
+// earlier one left open no longer carry the earlier id.
+enum CommandCategory : uint8_t {
+  CMD_CAT_GAME = 0,  // Moves the game state
+  CMD_CAT_LINK,      // Pairing, configuration, state sync acks
+  CMD_CAT_QUERY      // Read-only reports
+};
+
+constexpr CommandCategory COMMAND_CATEGORIES[] = {
+  CMD_CAT_GAME,   // roll
+  CMD_CAT_GAME,   // undo
+  CMD_CAT_GAME,   // reset
+  CMD_CAT_LINK,   // pair
+  CMD_CAT_LINK,   // unpair
+  CMD_CAT_LINK,   // config
+  CMD_CAT_GAME,   // sync_state
+  CMD_CAT_LINK,   // update_settings
+  CMD_CAT_QUERY,  // status
+  CMD_CAT_QUERY,  // task_stats
+  CMD_CAT_QUERY,  // profile
+  CMD_CAT_GAME,   // victory
+  CMD_CAT_LINK,   // state_ack
+  CMD_CAT_LINK    // resync
+};
+static_assert(sizeof(COMMAND_CATEGORIES) == CMD_COUNT, "One COMMAND_CATEGORIES entry per command");
+
+#define COMMAND_HASH_BITS 5
+#define COMMAND_HASH_SLOTS (1 << COMMAND_HASH_BITS)
+
+// FNV-1a, seeded through the offset basis
+constexpr uint32_t commandHash(const char *s, uint32_t seed) {
+  uint32_t h = 2166136261u ^ seed;
+  while (*s) {
+    h ^= (uint8_t)*s++;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+// Slot from the top bits: the low bits of an FNV hash only depend on the
+// low bits of the seed, so they would leave too few seeds to choose from
+constexpr uint32_t commandSlot(const char *s, uint32_t seed) {
+  return commandHash(s, seed) >> (32 - COMMAND_HASH_BITS);
+}
+
+constexpr bool commandSeedIsPerfect(uint32_t seed) {
+  bool used[COMMAND_HASH_SLOTS] = {};
+  for (int i = 0; i < CMD_COUNT; i++) {
+    uint32_t slot = commandSlot(COMMAND_NAMES[i], seed);
+    if (used[slot]) return false;
+    used[slot] = true;
+  }
+  return true;
+}
+
+// First seed that gives every name its own slot (0 if none below the limit)
+constexpr uint32_t findCommandSeed() {
+  for (uint32_t seed = 1; seed < 4096; seed++) {
+    if (commandSeedIsPerfect(seed)) return seed;
+  }
+  return 0;
+}
+
+constexpr uint32_t COMMAND_HASH_SEED = findCommandSeed();
+static_assert(COMMAND_HASH_SEED != 0, "No perfect hash seed for COMMAND_NAMES; raise COMMAND_HASH_BITS");
+
+struct CommandHashTable {
+  uint8_t slots[COMMAND_HASH_SLOTS];
+};
+
+constexpr CommandHashTable buildCommandTable() {
+  CommandHashTable table = {};
+  for (int s = 0; s < COMMAND_HASH_SLOTS; s++) {
+    table.slots[s] = CMD_UNKNOWN;
+  }
+  for (int i = 0; i < CMD_COUNT; i++) {
+    table.slots[commandSlot(COMMAND_NAMES[i], COMMAND_HASH_SEED)] = (uint8_t)i;
+  }
+  return table;
+}
+
+constexpr CommandHashTable COMMAND_TABLE = buildCommandTable();
+
+// CommandId for a command name, CMD_UNKNOWN if it is not one
+inline CommandId lookupCommand(const char *name) {
+  if (name == nullptr) return CMD_UNKNOWN;
+  uint8_t id = COMMAND_TABLE.slots[commandSlot(name, COMMAND_HASH_SEED)];
+  if (id == CMD_UNKNOWN || strcmp(name, COMMAND_NAMES[id]) != 0) return CMD_UNKNOWN;
+  return (CommandId)id;
+}
+
+#endif // COMMAND_TABLE_H
@@ -54,6 +54,9 @@ void showChanceCard(int cardIndex, ScreenID returnTo);
 void updateChanceCard();
 void dismissChanceCard();
 
+// Chance card auto-dismiss (renderTimers wheel lives in the main sketch)
+WheelTimer chanceCardTimer("card_dismiss", updateChanceCard);
+
 // ==================== INITIALIZATION ====================
 
 void initDisplay() {
@@ -1043,6 +1046,7 @@ void showChanceCard(int cardIndex, ScreenID returnTo) {
   displayState.chanceCardEffect = CHANCE_CARDS[cardIndex].effect;
   displayState.showingChanceCard = true;
   displayState.cardShowTime = millis();
+  renderTimers.arm(chanceCardTimer, CARD_DISPLAY_TIME);
   displayState.returnScreen = returnTo;
   displayState.cardFlipFrame = 0;
   
@@ -1061,17 +1065,15 @@ void showChanceCard(int cardIndex, ScreenID returnTo) {
   changeScreen(SCREEN_CHANCE_CARD);
 }
 
-// Check if chance card should auto-dismiss
+// chanceCardTimer callback: auto-dismiss CARD_DISPLAY_TIME after showChanceCard()
 void updateChanceCard() {
   if (displayState.showingChanceCard && displayState.currentScreen == SCREEN_CHANCE_CARD) {
-    // Auto-dismiss after CARD_DISPLAY_TIME
-    if (millis() - displayState.cardShowTime > CARD_DISPLAY_TIME) {
-      dismissChanceCard();
-    }
+    dismissChanceCard();
   }
 }
 
 void dismissChanceCard() {
+  renderTimers.cancel(chanceCardTimer);
   displayState.showingChanceCard = false;
   changeScreen(displayState.returnScreen);
 }
@@ -1474,9 +1476,6 @@ void updateDisplay() {
   // Update animations
   updateAnimations();
   
-  // Check for chance card auto-dismiss
-  updateChanceCard();
-  
   // Redraw gameplay screen if active (for animations)
   if (displayState.currentScreen == SCREEN_GAMEPLAY) {
     static unsigned long lastRedraw = 0;
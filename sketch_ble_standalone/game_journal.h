@@ -0,0 +1,362 @@
+/*
+ * Last Drop - Game Journal
+ *
+ * Append-only log of turn records in a dedicated flash partition
+ * ("journal" in partitions.csv), replacing a full snapshot write per save.
+ *
+ * Layout: the partition is a ring of erase sectors. Each sector starts
+ * with a header holding a base GameSnapshot (game_snapshot.h), the state
+ * when the sector was opened, followed by 8-byte records, each one
+ * player's tile / score / flags after a change. Only the head sector is
+ * written; records land in erased (0xFF) flash in order, so there is no
+ * erase per save and the erase load rotates through every sector.
+ *
+ * Group commit: record() queues one record per player that changed and
+ * commit() writes the queue with one flash write. The records of a commit
+ * share a group number and the last carries JOURNAL_COMMIT; replay applies
+ * a group only once its commit record is seen, so a power cut mid-write
+ * loses that save and nothing else.
+ *
+ * Compaction: when the head sector cannot take the next group, the oldest
+ * sector is erased and opened as the new head with the current state as
+ * its base. Recovery therefore reads sector headers, then replays at most
+ * one sector of records. A torn header leaves the previous head (not yet
+ * erased) as the newest valid sector. Older sectors keep the turn history
+ * until the ring comes back round to them (forEachRecord()).
+ *
+ * Flash is anything with NOR semantics (writes only clear bits):
+ *   uint32_t size();  uint32_t sectorSize();
+ *   bool erase(uint32_t addr);  // One sector
+ *   bool write(uint32_t addr, const void* data, uint32_t len);
+ *   bool read(uint32_t addr, void* data, uint32_t len);
+ */
+
+#ifndef GAME_JOURNAL_H
+#define GAME_JOURNAL_H
+
+#include <stdint.h>
+#include <string.h>
+#include "game_snapshot.h"
+
+#define JOURNAL_MAGIC 0x4A444C31  // "1LDJ"
+#define JOURNAL_HEADER_SIZE 48    // Header rounded up to whole records
+#define JOURNAL_COMMIT 0x80       // In JournalRecord::kind: last record of a group
+#define JOURNAL_PLAYER_MASK 0x0F
+#define JOURNAL_GROUP_MAX 16      // Queued records before commit() is forced
+#define JOURNAL_READ_CHUNK 32     // Records read per flash read during replay
+
+struct JournalSectorHeader {
+  uint32_t magic;
+  uint32_t generation;  // +1 per sector opened; the newest valid one is the head
+  GameSnapshot base;
+  uint32_t crc;         // CRC-32 of the fields above
+};
+
+struct JournalRecord {
+  uint8_t kind;   // Player, | JOURNAL_COMMIT on the last of a group; never 0xFF
+  uint8_t group;  // Records written by one commit() share it
+  uint8_t tile;
+  uint8_t flags;  // SNAPSHOT_ALIVE | SNAPSHOT_COIN
+  int16_t score;
+  uint16_t crc;   // CRC-16/CCITT of the six bytes above
+};
+
+static_assert(sizeof(JournalSectorHeader) <= JOURNAL_HEADER_SIZE, "Journal header outgrew its slot");
+static_assert(sizeof(JournalRecord) == 8, "JournalRecord must stay packed");
+static_assert(JOURNAL_HEADER_SIZE % sizeof(JournalRecord) == 0, "Records must stay aligned");
+static_assert(NUM_PLAYERS <= JOURNAL_PLAYER_MASK, "Player index must fit JournalRecord::kind");
+
+inline uint16_t journalCrc16(const void *data, uint32_t len) {
+  const uint8_t *p = (const uint8_t *)data;
+  uint16_t crc = 0xFFFF;
+  for (uint32_t i = 0; i < len; i++) {
+    crc ^= (uint16_t)p[i] << 8;
+    for (int b = 0; b < 8; b++) crc = crc & 0x8000 ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+  }
+  return crc;
+}
+
+inline bool journalRecordErased(const JournalRecord &r) {
+  const uint8_t *p = (const uint8_t *)&r;
+  for (uint32_t i = 0; i < sizeof(r); i++) {
+    if (p[i] != 0xFF) return false;
+  }
+  return true;
+}
+
+inline bool journalRecordValid(const JournalRecord &r) {
+  return (r.kind & JOURNAL_PLAYER_MASK) < NUM_PLAYERS && (r.kind & ~(JOURNAL_COMMIT | JOURNAL_PLAYER_MASK)) == 0 &&
+         r.crc == journalCrc16(&r, offsetof(JournalRecord, crc));
+}
+
+template <class Flash>
+class GameJournal {
+public:
+  explicit GameJournal(Flash &flash)
+    : flash(flash), sectorCount(0), sectorBytes(0), head(0), generation(0), writeOffset(0), nextGroup(0),
+      pendingCount(0), open(false), appendCount(0), commitCount(0), bytesWritten(0), compactCount(0),
+      eraseCount(0), replayedCount(0), tornCount(0), failCount(0) {
+    memset(&committed, 0, sizeof(committed));
+    memset(&current, 0, sizeof(current));
+  }
+
+  // False if the partition cannot hold a ring (two sectors at least)
+  bool begin() {
+    sectorBytes = flash.sectorSize();
+    sectorCount = sectorBytes ? flash.size() / sectorBytes : 0;
+    return sectorCount >= 2 && sectorBytes >= JOURNAL_HEADER_SIZE + JOURNAL_GROUP_MAX * sizeof(JournalRecord);
+  }
+
+  // State at the last commit that reached flash. SNAPSHOT_EMPTY / _CORRUPT:
+  // no usable sector, call start() with the state to journal from.
+  SnapshotLoadResult recover(GameSnapshot &out) {
+    open = false;
+    bool any = false;
+    int best = -1;
+    JournalSectorHeader bestHeader;
+    memset(&bestHeader, 0, sizeof(bestHeader));
+    for (uint32_t s = 0; s < sectorCount; s++) {
+      JournalSectorHeader h;
+      if (!readHeader(s, h, any)) continue;
+      if (best < 0 || (int32_t)(h.generation - bestHeader.generation) > 0) {
+        best = (int)s;
+        bestHeader = h;
+      }
+    }
+    if (best < 0) return any ? SNAPSHOT_CORRUPT : SNAPSHOT_EMPTY;
+
+    head = (uint32_t)best;
+    generation = bestHeader.generation;
+    committed = bestHeader.base;
+    replayedCount = 0;
+    tornCount = 0;
+    CountReplayed count = {&replayedCount};
+    writeOffset = replay(head, committed, generation, count, true);
+    current = committed;
+    pendingCount = 0;
+    open = true;
+    out = committed;
+    return SNAPSHOT_LOADED;
+  }
+
+  // Opens a sector with base as its state (first use, or after recover()
+  // found nothing usable)
+  bool start(const GameSnapshot &base) {
+    current = base;
+    pendingCount = 0;
+    if (!open) head = sectorCount - 1;  // First sector opened is 0
+    return compact();
+  }
+
+  // Queues a record for each player whose state differs from the last one
+  // recorded. Returns the number queued.
+  uint32_t record(const GameSnapshot &state) {
+    if (!open) return 0;
+    uint32_t queued = 0;
+    for (int i = 0; i < NUM_PLAYERS; i++) {
+      const SnapshotPlayer &now = state.players[i];
+      SnapshotPlayer &was = current.players[i];
+      if (now.tile == was.tile && now.score == was.score && now.flags == was.flags) continue;
+      if (pendingCount == JOURNAL_GROUP_MAX && !commit()) break;  // Rest queued next time
+      JournalRecord &r = queue[pendingCount++];
+      r.kind = (uint8_t)i;
+      r.tile = now.tile;
+      r.flags = now.flags;
+      r.score = now.score;
+      was = now;
+      queued++;
+    }
+    appendCount += queued;
+    return queued;
+  }
+
+  // Writes the queued records as one group. False if flash failed; the
+  // records stay queued for the next commit.
+  bool commit() {
+    if (!open) return false;
+    if (pendingCount == 0) return true;
+    uint32_t bytes = pendingCount * sizeof(JournalRecord);
+    if (writeOffset + bytes > sectorBytes) return compact();  // The new base includes them
+    for (uint32_t i = 0; i < pendingCount; i++) {
+      JournalRecord &r = queue[i];
+      r.kind = (uint8_t)((r.kind & JOURNAL_PLAYER_MASK) | (i + 1 == pendingCount ? JOURNAL_COMMIT : 0));
+      r.group = nextGroup;
+      r.crc = journalCrc16(&r, offsetof(JournalRecord, crc));
+    }
+    // Even a failed write may have programmed part of the slots: skip them
+    uint32_t at = writeOffset;
+    writeOffset += bytes;
+    nextGroup++;
+    if (!flash.write(head * sectorBytes + at, queue, bytes)) {
+      failCount++;
+      return false;
+    }
+    bytesWritten += bytes;
+    commitCount++;
+    committed = current;
+    pendingCount = 0;
+    return true;
+  }
+
+  // Erases the oldest sector and opens it with the current state as base
+  bool compact() {
+    uint32_t next = (head + 1) % sectorCount;
+    eraseCount++;
+    if (!flash.erase(next * sectorBytes)) {
+      failCount++;
+      return false;
+    }
+    JournalSectorHeader h;
+    memset(&h, 0, sizeof(h));
+    h.magic = JOURNAL_MAGIC;
+    h.generation = generation + 1;
+    h.base = current;
+    h.base.magic = SNAPSHOT_MAGIC;
+    h.base.version = SNAPSHOT_VERSION;
+    h.base.playerCount = NUM_PLAYERS;
+    h.base.seq = h.generation;
+    h.base.crc = snapshotBodyCrc(h.base);
+    h.crc = snapshotCrc32(&h, offsetof(JournalSectorHeader, crc));
+    if (!flash.write(next * sectorBytes, &h, sizeof(h))) {
+      failCount++;
+      return false;
+    }
+    bytesWritten += sizeof(h);
+    compactCount++;
+    head = next;
+    generation = h.generation;
+    writeOffset = JOURNAL_HEADER_SIZE;
+    current = h.base;
+    committed = current;
+    pendingCount = 0;
+    open = true;
+    return true;
+  }
+
+  // Every committed record still in flash, oldest first:
+  // fn(generation, player, const SnapshotPlayer&)
+  template <class Fn>
+  void forEachRecord(Fn fn) {
+    if (!open) return;
+    // Sectors after the head, in ring order, are older than it
+    for (uint32_t k = 1; k <= sectorCount; k++) {
+      uint32_t s = (head + k) % sectorCount;
+      JournalSectorHeader h;
+      bool any = false;
+      if (!readHeader(s, h, any) || (int32_t)(generation - h.generation) < 0) continue;
+      GameSnapshot state = h.base;
+      replay(s, state, h.generation, fn, false);
+    }
+  }
+
+  bool isOpen() const { return open; }
+  uint32_t sectors() const { return sectorCount; }
+  uint32_t recordsPerSector() const { return (sectorBytes - JOURNAL_HEADER_SIZE) / sizeof(JournalRecord); }
+  uint32_t headSector() const { return head; }
+  uint32_t headGeneration() const { return generation; }
+  uint32_t headUsed() const { return writeOffset; }  // Bytes of the head sector in use
+  uint32_t pending() const { return pendingCount; }
+
+  uint32_t appended() const { return appendCount; }
+  uint32_t commits() const { return commitCount; }
+  uint32_t bytes() const { return bytesWritten; }       // Programmed, headers included
+  uint32_t compactions() const { return compactCount; }
+  uint32_t erases() const { return eraseCount; }
+  uint32_t replayed() const { return replayedCount; }   // Records applied by the last recover()
+  uint32_t torn() const { return tornCount; }           // Damaged records skipped by recover()
+  uint32_t failures() const { return failCount; }
+
+private:
+  Flash &flash;
+  uint32_t sectorCount;
+  uint32_t sectorBytes;
+  uint32_t head;
+  uint32_t generation;
+  uint32_t writeOffset;
+  uint8_t nextGroup;
+  JournalRecord queue[JOURNAL_GROUP_MAX];
+  uint32_t pendingCount;
+  bool open;
+  GameSnapshot committed;
+  GameSnapshot current;
+
+  uint32_t appendCount;
+  uint32_t commitCount;
+  uint32_t bytesWritten;
+  uint32_t compactCount;
+  uint32_t eraseCount;
+  uint32_t replayedCount;
+  uint32_t tornCount;
+  uint32_t failCount;
+
+  // any is set if the sector holds anything but erased flash
+  bool readHeader(uint32_t sector, JournalSectorHeader &h, bool &any) {
+    if (!flash.read(sector * sectorBytes, &h, sizeof(h))) return false;
+    if (h.magic == 0xFFFFFFFFu && h.generation == 0xFFFFFFFFu) return false;  // Erased
+    any = true;
+    return h.magic == JOURNAL_MAGIC && h.crc == snapshotCrc32(&h, offsetof(JournalSectorHeader, crc)) &&
+           snapshotValid(h.base);
+  }
+
+  struct CountReplayed {
+    uint32_t *applied;
+    void operator()(uint32_t, int, const SnapshotPlayer &) { (*applied)++; }
+  };
+
+  // Applies the committed groups of a sector to state, calling fn for each
+  // record applied. Returns the offset of the first erased slot, where
+  // appending resumes; recovering also sets the next group number and
+  // counts torn records.
+  template <class Fn>
+  uint32_t replay(uint32_t sector, GameSnapshot &state, uint32_t gen, Fn &fn, bool recovering) {
+    JournalRecord chunk[JOURNAL_READ_CHUNK];
+    JournalRecord group[JOURNAL_GROUP_MAX];
+    uint32_t groupCount = 0;
+    int groupId = -1;
+    uint32_t base = sector * sectorBytes;
+    uint32_t offset = JOURNAL_HEADER_SIZE;
+    uint8_t lastGroup = 0;
+    bool sawRecord = false;
+    while (offset < sectorBytes) {
+      uint32_t n = (sectorBytes - offset) / sizeof(JournalRecord);
+      if (n > JOURNAL_READ_CHUNK) n = JOURNAL_READ_CHUNK;
+      if (n == 0 || !flash.read(base + offset, chunk, n * sizeof(JournalRecord))) break;
+      for (uint32_t i = 0; i < n; i++, offset += sizeof(JournalRecord)) {
+        const JournalRecord &r = chunk[i];
+        if (journalRecordErased(r)) {
+          if (recovering) nextGroup = sawRecord ? (uint8_t)(lastGroup + 1) : 0;
+          return offset;
+        }
+        sawRecord = true;
+        lastGroup = r.group;
+        if (!journalRecordValid(r)) {
+          if (recovering) tornCount++;
+          groupCount = 0;  // A damaged group is dropped whole
+          groupId = -1;
+          continue;
+        }
+        if (groupId != r.group || groupCount == JOURNAL_GROUP_MAX) {
+          groupCount = 0;  // Uncommitted records of an earlier group
+          groupId = r.group;
+        }
+        group[groupCount++] = r;
+        if (r.kind & JOURNAL_COMMIT) {
+          for (uint32_t g = 0; g < groupCount; g++) {
+            int player = group[g].kind & JOURNAL_PLAYER_MASK;
+            SnapshotPlayer &p = state.players[player];
+            p.tile = group[g].tile;
+            p.flags = group[g].flags;
+            p.score = group[g].score;
+            fn(gen, player, p);
+          }
+          groupCount = 0;
+          groupId = -1;
+        }
+      }
+    }
+    if (recovering) nextGroup = sawRecord ? (uint8_t)(lastGroup + 1) : 0;
+    return sectorBytes;  // Full
+  }
+};
+
+#endif // GAME_JOURNAL_H
@@ -0,0 +1,173 @@
+/*
+ * Last Drop - Game Snapshot Persistence
+ *
+ * The saved game (tile, score, alive, coin placed per player) as one packed
+ * struct written with a single putBytes() instead of one NVS write per
+ * field. Each snapshot carries a version, a sequence number and a CRC-32
+ * over everything before the CRC.
+ *
+ * Snapshots alternate between two keys, so a power cut during a write can
+ * only damage the slot being written; load() takes the valid slot with the
+ * newest sequence number and ignores a torn or stale one. Saving a snapshot
+ * identical to the last one written is skipped entirely, which makes the
+ * coalesced save after roll + coin + sync a no-op when nothing moved.
+ *
+ * A snapshot that loads has passed its CRC, so it is applied as is; the
+ * values are never clamped into range the way loose keys had to be.
+ *
+ * Store is anything with Preferences' byte API:
+ *   size_t putBytes(const char* key, const void* value, size_t len);
+ *   size_t getBytes(const char* key, void* buf, size_t maxLen);
+ */
+
+#ifndef GAME_SNAPSHOT_H
+#define GAME_SNAPSHOT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef NUM_PLAYERS
+#define NUM_PLAYERS 4
+#endif
+
+#define SNAPSHOT_MAGIC 0x4C44  // "LD"
+#define SNAPSHOT_VERSION 1
+#define SNAPSHOT_KEY_A "snap_a"
+#define SNAPSHOT_KEY_B "snap_b"
+
+#define SNAPSHOT_ALIVE 0x01
+#define SNAPSHOT_COIN 0x02
+
+struct SnapshotPlayer {
+  uint8_t tile;   // 1..NUM_TILES
+  uint8_t flags;  // SNAPSHOT_ALIVE | SNAPSHOT_COIN
+  int16_t score;
+};
+
+// Written byte for byte; the layout is the on-flash format
+struct GameSnapshot {
+  uint16_t magic;
+  uint8_t version;
+  uint8_t playerCount;  // Entries in players[], NUM_PLAYERS when written
+  uint32_t seq;
+  SnapshotPlayer players[NUM_PLAYERS];
+  uint32_t crc;         // CRC-32 of every byte above
+};
+
+static_assert(sizeof(SnapshotPlayer) == 4, "SnapshotPlayer must stay packed");
+static_assert(offsetof(GameSnapshot, crc) == sizeof(GameSnapshot) - 4, "crc must be the last field");
+
+// CRC-32 (IEEE, reflected), four bits per step from a 16-entry table
+inline uint32_t snapshotCrc32(const void *data, size_t len, uint32_t crc = 0) {
+  static const uint32_t NIBBLE[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+  };
+  const uint8_t *p = (const uint8_t *)data;
+  crc = ~crc;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= p[i];
+    crc = (crc >> 4) ^ NIBBLE[crc & 0x0F];
+    crc = (crc >> 4) ^ NIBBLE[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+inline uint32_t snapshotBodyCrc(const GameSnapshot &s) {
+  return snapshotCrc32(&s, offsetof(GameSnapshot, crc));
+}
+
+inline bool snapshotValid(const GameSnapshot &s) {
+  return s.magic == SNAPSHOT_MAGIC && s.version == SNAPSHOT_VERSION &&
+         s.playerCount == NUM_PLAYERS && s.crc == snapshotBodyCrc(s);
+}
+
+enum SnapshotLoadResult {
+  SNAPSHOT_LOADED = 0,  // out holds the newest valid snapshot
+  SNAPSHOT_EMPTY,       // Nothing saved yet
+  SNAPSHOT_CORRUPT      // Something was saved, but no slot passed its CRC
+};
+
+template <class Store>
+class SnapshotStore {
+public:
+  explicit SnapshotStore(Store &store)
+    : store(store), lastSeq(0), hasLast(false), newestSlot(0), writeCount(0), skipCount(0),
+      failCount(0), rejectCount(0) {
+    memset(&last, 0, sizeof(last));
+  }
+
+  // Newest valid slot into out. Call once at boot, before the first save().
+  SnapshotLoadResult load(GameSnapshot &out) {
+    GameSnapshot slots[2];
+    bool present[2], valid[2];
+    for (int i = 0; i < 2; i++) {
+      size_t n = store.getBytes(slotKey(i), &slots[i], sizeof(GameSnapshot));
+      present[i] = n > 0;
+      valid[i] = n == sizeof(GameSnapshot) && snapshotValid(slots[i]);
+      if (present[i] && !valid[i]) rejectCount++;
+    }
+    int pick = -1;
+    if (valid[0] && valid[1]) {
+      pick = (int32_t)(slots[1].seq - slots[0].seq) > 0 ? 1 : 0;  // Wrap-safe
+    } else if (valid[0] || valid[1]) {
+      pick = valid[0] ? 0 : 1;
+    }
+    if (pick < 0) return present[0] || present[1] ? SNAPSHOT_CORRUPT : SNAPSHOT_EMPTY;
+    out = slots[pick];
+    last = out;
+    lastSeq = out.seq;
+    hasLast = true;
+    newestSlot = pick;
+    return SNAPSHOT_LOADED;
+  }
+
+  // Seals the payload (players) of s and writes it to the older slot.
+  // Returns false only if the write failed; an unchanged payload is skipped.
+  bool save(const GameSnapshot &s) {
+    if (hasLast && memcmp(s.players, last.players, sizeof(s.players)) == 0) {
+      skipCount++;
+      return true;
+    }
+    GameSnapshot sealed = s;
+    sealed.magic = SNAPSHOT_MAGIC;
+    sealed.version = SNAPSHOT_VERSION;
+    sealed.playerCount = NUM_PLAYERS;
+    sealed.seq = hasLast ? lastSeq + 1 : 1;
+    sealed.crc = snapshotBodyCrc(sealed);
+    int slot = hasLast ? 1 - newestSlot : 0;
+    if (store.putBytes(slotKey(slot), &sealed, sizeof(sealed)) != sizeof(sealed)) {
+      failCount++;
+      return false;  // The other slot still holds the previous snapshot
+    }
+    last = sealed;
+    lastSeq = sealed.seq;
+    hasLast = true;
+    newestSlot = slot;
+    writeCount++;
+    return true;
+  }
+
+  static const char *slotKey(int slot) { return slot ? SNAPSHOT_KEY_B : SNAPSHOT_KEY_A; }
+
+  uint32_t seq() const { return lastSeq; }
+  int slot() const { return newestSlot; }
+  uint32_t writes() const { return writeCount; }
+  uint32_t skipped() const { return skipCount; }
+  uint32_t failures() const { return failCount; }
+  uint32_t rejected() const { return rejectCount; }  // Slots that failed validation at load
+
+private:
+  Store &store;
+  GameSnapshot last;
+  uint32_t lastSeq;
+  bool hasLast;
+  int newestSlot;
+  uint32_t writeCount;
+  uint32_t skipCount;
+  uint32_t failCount;
+  uint32_t rejectCount;
+};
+
+#endif // GAME_SNAPSHOT_H
@@ -11,70 +11,6 @@
 // Static pointer to access client instance from BLE lambda callbacks
 static GoDiceBLEClient* g_clientInstance = nullptr;
 
-// ==================== STATIC GODICE CALLBACKS ====================
-
-// Global callback trampolines (godiceapi.c expects C function pointers)
-static void godice_color_callback(void* userdata, int dice_id, godice_color_t color) {
-    GoDiceBLEClient* client = (GoDiceBLEClient*)userdata;
-    GoDiceInfo* info = client->getDiceInfo(dice_id);
-    if (info && info->connected) {
-        info->shellColor = color;
-        // Forward to user event handler
-        if (client->eventHandler) {
-            client->eventHandler->onDiceColor(dice_id, color);
-        }
-    }
-}
-
-static void godice_stable_callback(void* userdata, int dice_id, uint8_t number) {
-    GoDiceBLEClient* client = (GoDiceBLEClient*)userdata;
-    GoDiceInfo* info = client->getDiceInfo(dice_id);
-    if (info && info->connected) {
-        info->lastRoll = number;
-        info->rolling = false;
-        info->lastSeen = millis();
-        if (client->eventHandler) {
-            client->eventHandler->onDiceStable(dice_id, number);
-        }
-    }
-}
-
-static void godice_roll_callback(void* userdata, int dice_id) {
-    GoDiceBLEClient* client = (GoDiceBLEClient*)userdata;
-    GoDiceInfo* info = client->getDiceInfo(dice_id);
-    if (info && info->connected) {
-        info->rolling = true;
-        info->lastSeen = millis();
-        if (client->eventHandler) {
-            client->eventHandler->onDiceRolling(dice_id);
-        }
-    }
-}
-
-static void godice_battery_callback(void* userdata, int dice_id, uint8_t level) {
-    GoDiceBLEClient* client = (GoDiceBLEClient*)userdata;
-    GoDiceInfo* info = client->getDiceInfo(dice_id);
-    if (info && info->connected) {
-        info->batteryLevel = level;
-        info->lastSeen = millis();
-        if (client->eventHandler) {
-            client->eventHandler->onDiceBattery(dice_id, level);
-        }
-    }
-}
-
-static void godice_charging_callback(void* userdata, int dice_id, bool charging) {
-    GoDiceBLEClient* client = (GoDiceBLEClient*)userdata;
-    GoDiceInfo* info = client->getDiceInfo(dice_id);
-    if (info && info->connected) {
-        info->charging = charging;
-        info->lastSeen = millis();
-        if (client->eventHandler) {
-            client->eventHandler->onDiceCharging(dice_id, charging);
-        }
-    }
-}
-
 // ==================== BLE CLIENT CALLBACKS ====================
 
 void GoDiceBLEClient::DiceClientCallbacks::onConnect(BLEClient* client) {
@@ -121,6 +57,8 @@ void GoDiceBLEClient::DiceClientCallbacks::onConnect(BLEClient* client) {
     
     Serial.print("  [5/6] Registering for notifications... ");
     Serial.flush();
+    // Before any notification of this connection is queued
+    parent->connectionCount[slot] = parent->connectionCount[slot] + 1;
     if (parent->dice[slot].txChar->canNotify()) {
         auto notifyCallbacks = new DiceNotifyCallbacks();
         notifyCallbacks->parent = parent;
@@ -189,15 +127,17 @@ void GoDiceBLEClient::DiceNotifyCallbacks::onNotify(
     size_t length,
     bool isNotify
 ) {
-    // Parse incoming packet using godiceapi.c
-    godice_incoming_packet(
-        &parent->callbacks,
-        parent,
-        slot,
-        6,  // D6 die (change if using other die types)
-        data,
-        length
-    );
+    // Runs in the BLE task: only queue the bytes, update() decodes them
+    if (length > GODICE_MAX_PACKET_SIZE) {
+        parent->oversizedPackets++;
+        return;
+    }
+    GoDiceRawPacket raw;
+    raw.slot = slot;
+    raw.connection = parent->connectionCount[slot];
+    raw.size = length;
+    memcpy(raw.data, data, length);
+    parent->packetQueue.push(raw);
 }
 
 // ==================== SCAN CALLBACK ====================
@@ -295,14 +235,11 @@ GoDiceBLEClient::GoDiceBLEClient() {
         dice[i].lastRoll = 0;
         dice[i].rolling = false;
         dice[i].lastSeen = 0;
+        connectionCount[i] = 0;
+        decodedConnection[i] = 0;
     }
     
-    // Setup godiceapi callbacks
-    callbacks.on_dice_color = godice_color_callback;
-    callbacks.on_dice_stable = godice_stable_callback;
-    callbacks.on_dice_roll = godice_roll_callback;
-    callbacks.on_charge_level = godice_battery_callback;
-    callbacks.on_charging_state_changed = godice_charging_callback;
+    oversizedPackets = 0;
 }
 
 void GoDiceBLEClient::begin(const char* deviceName) {
@@ -738,7 +675,108 @@ void GoDiceBLEClient::updateDetectionSettings(int slot,
     }
 }
 
+// Drain queued notifications a batch at a time and hand each event to the
+// handler
+void GoDiceBLEClient::decodePackets() {
+    GoDiceRawPacket raw[GODICE_PACKET_QUEUE_SIZE];
+    size_t count = 0;
+    while (packetQueue.pop(raw[count])) {
+        GoDiceRawPacket& packet = raw[count];
+        if (packet.connection != decodedConnection[packet.slot]) {
+            // First bytes of a new connection: decode what came before,
+            // then drop any message the old one left unfinished
+            decodeRawPackets(raw, count);
+            raw[0] = packet;
+            count = 0;
+            decodedConnection[packet.slot] = packet.connection;
+            decoder.reset(packet.slot);
+        }
+        if (++count == GODICE_PACKET_QUEUE_SIZE) {
+            decodeRawPackets(raw, count);
+            count = 0;
+        }
+    }
+    decodeRawPackets(raw, count);
+}
+
+void GoDiceBLEClient::decodeRawPackets(const GoDiceRawPacket* raw, size_t count) {
+    GoDiceNotification notifications[GODICE_PACKET_QUEUE_SIZE];
+    for (size_t i = 0; i < count; i++) {
+        notifications[i] = {raw[i].slot, raw[i].data, raw[i].size};
+    }
+    
+    // Room for at least one notification's messages, so every call makes progress
+    GoDiceEvent events[2 * GODICE_MAX_PACKET_SIZE];
+    static_assert(sizeof(events) / sizeof(events[0]) >= GODICE_MAX_PACKET_SIZE + GODICE_MESSAGE_MAX - 1,
+                  "events must hold one notification's messages");
+    uint32_t now = millis();
+    size_t done = 0;
+    while (done < count) {
+        size_t consumed = 0;
+        size_t n = decoder.decodeBatch(notifications + done, count - done, now,
+                                       events, sizeof(events) / sizeof(events[0]), &consumed);
+        for (size_t i = 0; i < n; i++) {
+            dispatchEvent(events[i]);
+        }
+        done += consumed;
+    }
+}
+
+void GoDiceBLEClient::dispatchEvent(const GoDiceEvent& event) {
+    GoDiceInfo* info = getDiceInfo(event.slot);
+    if (!info || !info->connected) {
+        return;
+    }
+    
+    switch (event.type) {
+        case GODICE_EVENT_COLOR:
+            info->shellColor = (godice_color_t)event.value;
+            if (eventHandler) {
+                eventHandler->onDiceColor(event.slot, info->shellColor);
+            }
+            break;
+            
+        case GODICE_EVENT_STABLE:
+            info->lastRoll = event.value;
+            info->rolling = false;
+            info->lastSeen = millis();
+            if (eventHandler) {
+                eventHandler->onDiceStable(event.slot, event.value);
+            }
+            break;
+            
+        case GODICE_EVENT_ROLL:
+            info->rolling = true;
+            info->lastSeen = millis();
+            if (eventHandler) {
+                eventHandler->onDiceRolling(event.slot);
+            }
+            break;
+            
+        case GODICE_EVENT_CHARGE_LEVEL:
+            info->batteryLevel = event.value;
+            info->lastSeen = millis();
+            if (eventHandler) {
+                eventHandler->onDiceBattery(event.slot, event.value);
+            }
+            break;
+            
+        case GODICE_EVENT_CHARGING:
+            info->charging = event.value;
+            info->lastSeen = millis();
+            if (eventHandler) {
+                eventHandler->onDiceCharging(event.slot, event.value);
+            }
+            break;
+            
+        default:  // Taps are not reported
+            break;
+    }
+}
+
 void GoDiceBLEClient::update() {
+    decodePackets();
+    
     // Check for pending connection from scan callback
     if (g_pendingConn.valid) {
         g_pendingConn.valid = false;
@@ -2,7 +2,7 @@
  * GoDice BLE Client - ESP32 Implementation
  * 
  * Handles BLE Central mode connection to GoDice smart dice
- * Integrates with godiceapi.c for protocol handling
+ * Decodes notifications with the GoDice library (libraries/GoDice)
  * 
  * Features:
  * - Scan for nearby GoDice
@@ -19,7 +19,8 @@
 #include <BLEClient.h>
 #include <BLEScan.h>
 #include <BLEAdvertisedDevice.h>
-#include "godiceapi.h"
+#include <GoDice.h>
+#include "spsc_queue.h"
 
 // ==================== BLE SERVICE/CHARACTERISTIC UUIDS ====================
 
@@ -33,6 +34,8 @@
 #define MAX_GODICE_CONNECTIONS 2    // Support 2 dice simultaneously
 #define GODICE_SCAN_DURATION 30     // Scan duration in seconds (longer to find sleepy dice)
 #define GODICE_RECONNECT_DELAY 5000 // Reconnect attempt delay (ms)
+#define GODICE_MAX_PACKET_SIZE 20   // Longest notification kept (default ATT payload)
+#define GODICE_PACKET_QUEUE_SIZE 16 // Raw notifications waiting for update() (power of two)
 
 // ==================== DICE CONNECTION INFO ====================
 
@@ -54,6 +57,14 @@ struct GoDiceInfo {
     void* notifyCallback;            // DiceNotifyCallbacks pointer for BLE
 };
 
+// Notification bytes as received, decoded later by update()
+struct GoDiceRawPacket {
+    uint8_t slot;
+    uint8_t connection;              // Slot's connection count when received
+    uint8_t size;
+    uint8_t data[GODICE_MAX_PACKET_SIZE];
+};
+
 // ==================== CALLBACK INTERFACE ====================
 
 /**
@@ -93,9 +104,17 @@ public:
     
 private:
     BLEScan* scan;
-    godice_callbacks_t callbacks;
     bool scanning;
     
+    // Filled by the BLE task's notify callbacks, drained by update()
+    SpscQueue<GoDiceRawPacket, GODICE_PACKET_QUEUE_SIZE> packetQueue;
+    uint32_t oversizedPackets;
+    GoDiceDecoder<MAX_GODICE_CONNECTIONS> decoder;  // update() only
+    // Bumped by onConnect() in the BLE task; when update() sees a packet
+    // from a newer connection it resets the slot's decoder first
+    volatile uint8_t connectionCount[MAX_GODICE_CONNECTIONS];
+    uint8_t decodedConnection[MAX_GODICE_CONNECTIONS];  // update() only
+    
     // BLE callbacks
     class DiceClientCallbacks : public BLEClientCallbacks {
     public:
@@ -118,6 +137,9 @@ private:
     int findFreeSlot();
     void setupDiceCallbacks(int slot);
     void sendInitPacket(int slot);
+    void decodePackets();
+    void decodeRawPackets(const GoDiceRawPacket* raw, size_t count);
+    void dispatchEvent(const GoDiceEvent& event);
     
 public:
     int findSlotByAddress(String address);
@@ -228,7 +250,13 @@ public:
     );
     
     /**
-     * Call in loop() for connection monitoring
+     * Notifications lost because the queue was full or they were too long
+     */
+    uint32_t droppedPackets() { return packetQueue.droppedCount() + oversizedPackets; }
+    
+    /**
+     * Call in loop() for connection monitoring; also decodes queued
+     * notifications and calls the event handler for each event
      */
     void update();
 };
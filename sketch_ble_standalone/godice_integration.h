@@ -11,6 +11,11 @@
 // Standalone mode turn tracking
 int standaloneCurrentPlayer = 0;  // Track whose turn it is (0 to activePlayerCount-1)
 
+// Same default as godice_ble_client.h (not included by this sketch)
+#ifndef GODICE_RECONNECT_DELAY
+#define GODICE_RECONNECT_DELAY 5000 // Reconnect attempt delay (ms)
+#endif
+
 // ==================== Helper Functions ====================
 
 const char* getDiceColorName(uint8_t colorCode) {
@@ -25,26 +30,6 @@ const char* getDiceColorName(uint8_t colorCode) {
     }
 }
 
-// Convert accelerometer XYZ to dice face (1-6)
-int goDiceXyzToFace(int8_t x, int8_t y, int8_t z) {
-    int bestFace = 1;
-    int bestDistance = 999999;
-    
-    for (int face = 0; face < 6; face++) {
-        int dx = x - GODICE_D6_VECTORS[face][0];
-        int dy = y - GODICE_D6_VECTORS[face][1];
-        int dz = z - GODICE_D6_VECTORS[face][2];
-        int distance = dx*dx + dy*dy + dz*dz;
-        
-        if (distance < bestDistance) {
-            bestDistance = distance;
-            bestFace = face + 1;
-        }
-    }
-    
-    return bestFace;
-}
-
 // Send command to GoDice
 void sendGoDiceCommand(uint8_t cmd) {
     if (pGoDiceTxChar && goDiceConnected) {
@@ -72,104 +57,143 @@ void pulseGoDiceLED(uint8_t r, uint8_t g, uint8_t b, uint8_t count, uint8_t onTi
 
 // ==================== GoDice Notification Callback ====================
 
-static void goDiceNotifyCallback(BLERemoteCharacteristic* pChar, uint8_t* pData, size_t length, bool isNotify) {
-    if (length < 1) return;
+// A settled "S" is always taken. A tilt/move/fake stable whose face is
+// barely ahead of its neighbour (die leaning on a coin or the board edge)
+// is not committed: the die sends a true S once it settles, and an amber
+// pulse asks the player to re-roll if it never does. The SDK reports the
+// face and its margin over the runner-up (see godice_stable_info_t).
+static void handleGoDiceStable(const GoDiceEvent& event) {
+    isDiceRolling = false;
+    const godice_stable_info_t& info = event.stable;
     
-    uint8_t msgType = pData[0];
-    
-    // Debug logging
-    Serial.print("📥 GoDice [");
-    for (size_t i = 0; i < length; i++) {
-        if (pData[i] < 0x10) Serial.print("0");
-        Serial.print(pData[i], HEX);
-        if (i < length - 1) Serial.print(" ");
+    if (info.type != GODICE_STABLE && info.margin < DICE_MIN_MARGIN) {
+        diceLowConfidence++;
+        BLOG(GODICE_LOW_CONFIDENCE, event.key, info.number, (int)info.margin);
+        pulseGoDiceLED(255, 120, 0, 2, 10, 10);
+        return;
     }
-    Serial.print("] ");
     
-    switch (msgType) {
-        case GODICE_MSG_ROLLING:
+    rollCount++;
+    lastDiceValue = info.number;
+    BLOG(GODICE_STABLE, lastDiceValue, info.x, info.y, info.z);
+    processDiceRoll(lastDiceValue);
+}
+
+static void handleGoDiceEvent(const GoDiceEvent& event) {
+    switch (event.type) {
+        case GODICE_EVENT_ROLL:
             isDiceRolling = true;
             lastRollTime = millis();
-            Serial.println("🎲 ROLLING...");
+            BLOG(GODICE_ROLLING);
             break;
             
-        case GODICE_MSG_STABLE: {  // 0x53 'S' - format: [S][x][y][z]
-            if (length >= 4) {
-                isDiceRolling = false;
-                rollCount++;
-                
-                int8_t x = (int8_t)pData[1];
-                int8_t y = (int8_t)pData[2];
-                int8_t z = (int8_t)pData[3];
-                
-                lastDiceValue = goDiceXyzToFace(x, y, z);
-                Serial.printf("✅ STABLE: %d (xyz: %d,%d,%d)\n", lastDiceValue, x, y, z);
-                
-                // Process dice roll in game logic
-                processDiceRoll(lastDiceValue);
-            }
+        case GODICE_EVENT_STABLE:  // S, or FS / TS / MS
+            handleGoDiceStable(event);
             break;
-        }
             
-        case GODICE_MSG_FAKE_STABLE:  // 0x46 'F' - format: [F][S][x][y][z]
-        case GODICE_MSG_TILT_STABLE:  // 0x54 'T' - format: [T][S][x][y][z]
-        case GODICE_MSG_MOVE_STABLE: { // 0x4D 'M' - format: [M][S][x][y][z]
-            if (length >= 5) {
-                isDiceRolling = false;
-                rollCount++;
-                
-                int8_t x = (int8_t)pData[2];  // XYZ at offset 2,3,4
-                int8_t y = (int8_t)pData[3];
-                int8_t z = (int8_t)pData[4];
-                
-                lastDiceValue = goDiceXyzToFace(x, y, z);
-                Serial.printf("✅ STABLE: %d (xyz: %d,%d,%d)\n", lastDiceValue, x, y, z);
-                
-                // Process dice roll in game logic
-                processDiceRoll(lastDiceValue);
-            }
+        case GODICE_EVENT_CHARGE_LEVEL:
+            diceBattery = event.value;
+            Serial.printf("🔋 Battery: %d%%\n", diceBattery);
             break;
-        }
             
-        case GODICE_MSG_BATTERY:
-            if (length >= 4 && pData[1] == 'a' && pData[2] == 't') {
-                // "Bat" + level
-                diceBattery = pData[3];
-                Serial.printf("🔋 Battery: %d%%\n", diceBattery);
-            } else if (length >= 2) {
-                diceBattery = pData[1];
-                Serial.printf("🔋 Battery: %d%%\n", diceBattery);
-            }
+        case GODICE_EVENT_CHARGING:
+            Serial.printf("🔌 Charging: %s\n", event.value ? "yes" : "no");
             break;
             
-        case GODICE_MSG_COLOR:
-            if (length >= 4 && pData[1] == 'o' && pData[2] == 'l') {
-                // "Col" + color code
-                uint8_t colorCode = pData[3];
-                diceColorName = getDiceColorName(colorCode);
-                Serial.printf("🎨 Dice Color: %s (code=%d)\n", diceColorName.c_str(), colorCode);
-            } else if (length >= 2) {
-                uint8_t colorCode = pData[1];
-                diceColorName = getDiceColorName(colorCode);
-                Serial.printf("🎨 Dice Color: %s (code=%d)\n", diceColorName.c_str(), colorCode);
-            }
+        case GODICE_EVENT_COLOR:
+            diceColorName = getDiceColorName(event.value);
+            Serial.printf("🎨 Dice Color: %s (code=%d)\n", diceColorName.c_str(), event.value);
             break;
             
-        default:
-            Serial.printf("❓ Unknown: 0x%02X\n", msgType);
+        default:  // Taps are not used
             break;
     }
 }
 
+// Runs in the BLE task: only queue the bytes, the game task decodes them
+static void goDiceNotifyCallback(BLERemoteCharacteristic* pChar, uint8_t* pData, size_t length, bool isNotify) {
+    if (length < 1) return;
+    
+    // First 8 bytes, big-endian, into the binary log
+    uint32_t head[2] = {0, 0};
+    for (size_t i = 0; i < length && i < 8; i++) {
+        head[i / 4] |= (uint32_t)pData[i] << (24 - 8 * (i % 4));
+    }
+    BLOG(GODICE_NOTIFY, pData[0], length, head[0], head[1]);
+    
+    if (length > GODICE_NOTIFY_MAX) {
+        goDiceOversize++;
+        return;
+    }
+    GoDiceNotify raw;
+    raw.connection = goDiceConnection;
+    raw.size = length;
+    memcpy(raw.data, pData, length);
+    goDiceNotifyQueue.push(raw);
+    
+    // Let the game task process the roll right away
+    wakeGameTask();
+}
+
+static void decodeGoDiceBatch(const GoDiceNotify* raw, size_t count) {
+    GoDiceNotification notifications[GODICE_NOTIFY_QUEUE_SIZE];
+    for (size_t i = 0; i < count; i++) {
+        notifications[i] = {0, raw[i].data, raw[i].size};
+    }
+    
+    // Room for at least one notification's messages, so every call makes progress
+    GoDiceEvent events[2 * GODICE_NOTIFY_MAX];
+    static_assert(sizeof(events) / sizeof(events[0]) >= GODICE_NOTIFY_MAX + GODICE_MESSAGE_MAX - 1,
+                  "events must hold one notification's messages");
+    uint32_t now = millis();
+    size_t done = 0;
+    while (done < count) {
+        size_t consumed = 0;
+        size_t n = goDiceDecoder.decodeBatch(notifications + done, count - done, now,
+                                             events, sizeof(events) / sizeof(events[0]), &consumed);
+        for (size_t i = 0; i < n; i++) {
+            handleGoDiceEvent(events[i]);
+        }
+        done += consumed;
+    }
+}
+
+// Game task: decode what the notify callback queued, a batch at a time. A
+// notification may hold several messages or part of one; the handlers run
+// here, so they may write to the die.
+void decodeGoDiceNotifications() {
+    GoDiceNotify raw[GODICE_NOTIFY_QUEUE_SIZE];
+    size_t count = 0;
+    while (goDiceNotifyQueue.pop(raw[count])) {
+        GoDiceNotify& notify = raw[count];
+        if (notify.connection != goDiceDecodedConnection) {
+            // First bytes of a new connection: decode what came before,
+            // then drop any message the old one left unfinished
+            decodeGoDiceBatch(raw, count);
+            raw[0] = notify;
+            count = 0;
+            goDiceDecodedConnection = notify.connection;
+            goDiceDecoder.reset(0);
+        }
+        if (++count == GODICE_NOTIFY_QUEUE_SIZE) {
+            decodeGoDiceBatch(raw, count);
+            count = 0;
+        }
+    }
+    decodeGoDiceBatch(raw, count);
+}
+
 // ==================== GoDice Client Callbacks ====================
 
 class GoDiceClientCallbacks : public BLEClientCallbacks {
     void onConnect(BLEClient* pclient) override {
         Serial.println("✅ GoDice onConnect callback");
+        goDiceConnection++;  // The game task resets the decoder at this boundary
         goDiceConnected = true;
         
         // Connection success - green animation on dice itself
         pulseGoDiceLED(0, 255, 0, 3, 15, 10);  // 3 green pulses
+        wakeGameTask();
     }
 
     void onDisconnect(BLEClient* pclient) override {
@@ -178,8 +202,8 @@ class GoDiceClientCallbacks : public BLEClientCallbacks {
         isDiceRolling = false;
         lastDiceValue = 0;
         
-        // Disconnected - return to MODE_DISCONNECTED (blue corner LEDs)
-        currentConnectionMode = MODE_DISCONNECTED;
+        // Game task returns to MODE_DISCONNECTED (see handleGoDiceConnection)
+        wakeGameTask();
     }
 };
 
@@ -207,18 +231,19 @@ class GoDiceScanCallbacks : public BLEAdvertisedDeviceCallbacks {
             goDiceFoundType = advertisedDevice.getAddressType();
             
             pGoDiceScan->stop();
+            wakeGameTask();
         }
     }
 };
 
 // ==================== GoDice Connection ====================
 
-// Simple dice roll processor for standalone mode
+// Simple dice roll processor for standalone mode (game task)
 void processDiceRoll(int diceValue) {
   Serial.printf("\n🎲 Processing dice roll: %d\n", diceValue);
   
   // Update display with dice result
-  showDiceResult(diceValue);
+  postRenderEvent(RENDER_EVT_DICE_RESULT, -1, diceValue);
   
   // Get current player for this turn
   int playerId = standaloneCurrentPlayer;
@@ -235,8 +260,8 @@ void processDiceRoll(int diceValue) {
     }
   }
   
-  Serial.printf("  Current player: %d (%s)\n", playerId, 
-                profiles[displayState.selectedProfiles[playerId]].nickname);
+  // Nicknames live in the render core's display state, so only the index is logged
+  Serial.printf("  Current player: %d\n", playerId);
   
   // Store previous state for undo
   players[playerId].previousTile = players[playerId].currentTile;
@@ -304,18 +329,18 @@ void processDiceRoll(int diceValue) {
   
   // Show chance card on display if one was drawn
   if (chanceCardIndex >= 0) {
-    showChanceCard(chanceCardIndex, SCREEN_GAMEPLAY);
+    postRenderEvent(RENDER_EVT_CHANCE_CARD, -1, chanceCardIndex, SCREEN_GAMEPLAY);
   }
   
   // Check elimination
   if (newScore <= 0 && players[playerId].alive) {
     players[playerId].alive = false;
     Serial.println("  ⚠️ PLAYER ELIMINATED!");
-    animatePlayerElimination(playerId);
+    postRenderEvent(RENDER_EVT_ELIMINATION, playerId, 0, 0, players[playerId].color);
   }
   
   // Animate LED movement
-  animateMove(currentTile, newTile, players[playerId].color, playerId);
+  postRenderEvent(RENDER_EVT_MOVE, playerId, currentTile, newTile, players[playerId].color);
   
   // Start coin wait
   waitingForCoin = true;
@@ -338,8 +363,8 @@ void processDiceRoll(int diceValue) {
   
   if (alivePlayers == 1 && activePlayerCount > 1) {
     Serial.printf("\n🏆 WINNER: Player %d!\n", winnerId);
-    animateWinner(winnerId);
-    changeScreen(SCREEN_GAME_OVER);
+    postRenderEvent(RENDER_EVT_WINNER, winnerId, 0, 0, players[winnerId].color);
+    postRenderEvent(RENDER_EVT_SCREEN, -1, SCREEN_GAME_OVER);
   }
   
   Serial.println("✅ Dice roll processed\n");
@@ -447,7 +472,16 @@ void startGoDiceScan() {
 
 // ==================== GoDice Loop Handler ====================
 
+WheelTimer goDiceReconnectTimer("godice_reconnect", startGoDiceScan);
+
 void handleGoDiceConnection() {
+    // Dice dropped - return to MODE_DISCONNECTED (blue corner LEDs)
+    static bool wasConnected = false;
+    if (wasConnected && !goDiceConnected) {
+        currentConnectionMode = MODE_DISCONNECTED;
+    }
+    wasConnected = goDiceConnected;
+    
     // Handle connection after scan completes
     if (goDiceFoundFlag && goDiceFoundAddress != nullptr && !goDiceConnected) {
         goDiceFoundFlag = false;
@@ -464,9 +498,8 @@ void handleGoDiceConnection() {
             currentConnectionMode = MODE_DISCONNECTED;
             Serial.println("❌ Connection failed - will retry");
             
-            // Retry scan after 5 seconds
-            delay(5000);
-            startGoDiceScan();
+            // Retry scan after GODICE_RECONNECT_DELAY without blocking loop()
+            timers.arm(goDiceReconnectTimer, GODICE_RECONNECT_DELAY);
         }
     }
 }
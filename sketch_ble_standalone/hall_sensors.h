@@ -0,0 +1,183 @@
+/*
+ * Last Drop - Hall Sensor Access Layer
+ *
+ * Coin detection reads the 20 A3144 Hall sensors through the small
+ * HallSensorBus interface below instead of calling mcp.digitalRead() /
+ * digitalRead() directly. The firmware plugs in the real MCP23017 + GPIO
+ * backend (see McpHallBus in sketch_ble_standalone.ino); the host tests in
+ * test/ plug in a simulated board with scripted coins, bounce and I2C faults.
+ */
+
+#ifndef HALL_SENSORS_H
+#define HALL_SENSORS_H
+
+#include <stdint.h>
+
+#ifndef NUM_TILES
+#define NUM_TILES 20
+#endif
+
+// ==================== SENSOR WIRING ====================
+
+// MCP23017 Port B tiles (PB0-PB7 = MCP pins 8-15)
+const uint8_t MCP_PORTB_TILES[8] = {1, 20, 19, 18, 16, 14, 17, 15};
+
+// MCP23017 Port A tiles (PA0-PA7 = MCP pins 0-7)
+const uint8_t MCP_PORTA_TILES[8] = {2, 3, 4, 5, 13, 7, 8, 6};
+
+// Direct ESP32 GPIO tiles (4 tiles not on MCP)
+const uint8_t DIRECT_GPIO_PINS[4] = {17, 18, 8, 9};
+const uint8_t DIRECT_GPIO_TILES[4] = {9, 10, 11, 12};
+
+enum HallSource : uint8_t {
+  HALL_SOURCE_NONE = 0,
+  HALL_SOURCE_MCP,      // pin = MCP pin 0-15 (bit index in GPIOAB)
+  HALL_SOURCE_GPIO      // pin = ESP32 GPIO number
+};
+
+struct HallTileWiring {
+  HallSource source;
+  uint8_t pin;
+};
+
+// Resolve where a tile's sensor is wired (tile is 1-based)
+inline HallTileWiring hallWiringForTile(int tile) {
+  HallTileWiring wiring = {HALL_SOURCE_NONE, 0};
+  for (uint8_t j = 0; j < 8; j++) {
+    if (MCP_PORTB_TILES[j] == tile) {
+      wiring.source = HALL_SOURCE_MCP;
+      wiring.pin = j + 8;
+      return wiring;
+    }
+    if (MCP_PORTA_TILES[j] == tile) {
+      wiring.source = HALL_SOURCE_MCP;
+      wiring.pin = j;
+      return wiring;
+    }
+  }
+  for (uint8_t j = 0; j < 4; j++) {
+    if (DIRECT_GPIO_TILES[j] == tile) {
+      wiring.source = HALL_SOURCE_GPIO;
+      wiring.pin = DIRECT_GPIO_PINS[j];
+      return wiring;
+    }
+  }
+  return wiring;
+}
+
+// ==================== SENSOR BUS INTERFACE ====================
+
+class HallSensorBus {
+public:
+  virtual ~HallSensorBus() {}
+
+  // Read both MCP23017 ports in one I2C transaction.
+  // Bit N of gpioAB is MCP pin N (PA0-PA7 = bits 0-7, PB0-PB7 = bits 8-15).
+  // Returns false if the expander did not ACK or returned a short read.
+  virtual bool readExpander(uint16_t &gpioAB) = 0;
+
+  // Read a direct ESP32 GPIO (1 = HIGH, 0 = LOW)
+  virtual int readDirect(uint8_t pin) = 0;
+
+  // Block between debounce samples
+  virtual void waitMs(uint32_t ms) = 0;
+};
+
+// ==================== DEBOUNCE ====================
+
+// A tile reports a coin when at least `threshold` of `samples` reads are LOW
+// (A3144 is active-LOW with pull-up). Reads that fail on the bus never count
+// as LOW, so a NACKing expander cannot fake a coin.
+struct HallDebounceConfig {
+  uint8_t samples;
+  uint8_t threshold;
+  uint8_t sampleGapMs;
+};
+
+const HallDebounceConfig HALL_DEBOUNCE_DEFAULT = {5, 3, 2};
+
+struct HallStats {
+  uint32_t reads;        // Individual sensor samples taken
+  uint32_t busErrors;    // Expander reads that failed (NACK / short read)
+};
+
+// Single raw sample of one tile. Returns false on a bus error.
+inline bool hallSampleTile(HallSensorBus &bus, const HallTileWiring &wiring,
+                           bool &magnet, HallStats *stats = nullptr) {
+  if (stats) stats->reads++;
+  if (wiring.source == HALL_SOURCE_MCP) {
+    uint16_t gpioAB = 0xFFFF;
+    if (!bus.readExpander(gpioAB)) {
+      if (stats) stats->busErrors++;
+      return false;
+    }
+    magnet = ((gpioAB >> wiring.pin) & 1) == 0;
+    return true;
+  }
+  if (wiring.source == HALL_SOURCE_GPIO) {
+    magnet = bus.readDirect(wiring.pin) == 0;
+    return true;
+  }
+  return false;
+}
+
+// Debounced presence check for a single tile (1-based).
+// lowReadings (optional) receives how many samples read LOW.
+inline bool hallCoinPresent(HallSensorBus &bus, int tile, const HallDebounceConfig &cfg,
+                            int *lowReadings = nullptr, HallStats *stats = nullptr) {
+  HallTileWiring wiring = hallWiringForTile(tile);
+  int readings = 0;
+  if (wiring.source != HALL_SOURCE_NONE) {
+    for (uint8_t i = 0; i < cfg.samples; i++) {
+      bool magnet = false;
+      if (hallSampleTile(bus, wiring, magnet, stats) && magnet) {
+        readings++;
+      }
+      if (i + 1 < cfg.samples && cfg.sampleGapMs > 0) {
+        bus.waitMs(cfg.sampleGapMs);
+      }
+    }
+  }
+  if (lowReadings) *lowReadings = readings;
+  return wiring.source != HALL_SOURCE_NONE && readings >= cfg.threshold;
+}
+
+// Debounced scan of every tile. Each sample is one expander transaction
+// covering all 16 MCP tiles plus the 4 direct GPIOs, instead of one
+// transaction per tile per sample.
+// Returns a bitmask with bit (tile - 1) set when a coin is present.
+inline uint32_t hallScanTiles(HallSensorBus &bus, const HallDebounceConfig &cfg,
+                              HallStats *stats = nullptr) {
+  uint8_t lowCount[NUM_TILES] = {0};
+
+  for (uint8_t i = 0; i < cfg.samples; i++) {
+    uint16_t gpioAB = 0xFFFF;
+    bool expanderOk = bus.readExpander(gpioAB);
+    if (stats) {
+      stats->reads += NUM_TILES;
+      if (!expanderOk) stats->busErrors++;
+    }
+
+    if (expanderOk) {
+      for (uint8_t j = 0; j < 8; j++) {
+        if (((gpioAB >> j) & 1) == 0) lowCount[MCP_PORTA_TILES[j] - 1]++;
+        if (((gpioAB >> (j + 8)) & 1) == 0) lowCount[MCP_PORTB_TILES[j] - 1]++;
+      }
+    }
+    for (uint8_t j = 0; j < 4; j++) {
+      if (bus.readDirect(DIRECT_GPIO_PINS[j]) == 0) lowCount[DIRECT_GPIO_TILES[j] - 1]++;
+    }
+
+    if (i + 1 < cfg.samples && cfg.sampleGapMs > 0) {
+      bus.waitMs(cfg.sampleGapMs);
+    }
+  }
+
+  uint32_t mask = 0;
+  for (int t = 0; t < NUM_TILES; t++) {
+    if (lowCount[t] >= cfg.threshold) mask |= (1UL << t);
+  }
+  return mask;
+}
+
+#endif // HALL_SENSORS_H
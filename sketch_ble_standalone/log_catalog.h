@@ -0,0 +1,75 @@
+/*
+ * Last Drop - Binary Log Catalog
+ *
+ * Every message the binary log (binlog.h) can record: name, level and
+ * printf format. The board only stores the message id and its integer
+ * arguments; the format is applied when the log is decoded, on the host or
+ * by a BINLOG_TEXT build.
+ *
+ * Formats take only integer conversions (%d %u %X %c and their widths), at
+ * most LOG_MAX_ARGS of them. The argument count of each call is checked
+ * against its format at compile time.
+ *
+ * To add a message: append an X(...) line. Ids are positions in this list,
+ * so a decoder needs the catalog of the firmware that wrote the log.
+ */
+
+#ifndef LOG_CATALOG_H
+#define LOG_CATALOG_H
+
+#include <stdint.h>
+
+enum LogLevel : uint8_t {
+  LOG_LEVEL_DEBUG = 0,
+  LOG_LEVEL_INFO,
+  LOG_LEVEL_WARN,
+  LOG_LEVEL_ERROR
+};
+
+#define LOG_CATALOG(X) \
+  X(BINLOG_DROPPED,    LOG_LEVEL_WARN,  "Log ring full: %u records dropped") \
+  X(GODICE_NOTIFY,     LOG_LEVEL_DEBUG, "GoDice notify type 0x%02X, %u bytes: %08X %08X") \
+  X(GODICE_ROLLING,    LOG_LEVEL_INFO,  "GoDice rolling") \
+  X(GODICE_STABLE,     LOG_LEVEL_INFO,  "GoDice stable: %d (xyz: %d,%d,%d)") \
+  X(HALL_INVALID_TILE, LOG_LEVEL_WARN,  "[Hall] Invalid tile: %d") \
+  X(HALL_RESULT,       LOG_LEVEL_DEBUG, "[Hall] Tile %d (%c%d) result: %d/%d readings LOW, coin %d") \
+  X(CMD_RECEIVED,      LOG_LEVEL_INFO,  "Command received: id %d, %u bytes, binary %d") \
+  X(APP_SENT,          LOG_LEVEL_DEBUG, "Sent to app: %u bytes") \
+  X(GODICE_LOW_CONFIDENCE, LOG_LEVEL_WARN, "GoDice %c-stable face %d held back, margin %d")
+
+#define LOG_ID_ENTRY(name, level, format) LOG_##name,
+enum LogMsgId : uint16_t {
+  LOG_CATALOG(LOG_ID_ENTRY)
+  LOG_MSG_COUNT
+};
+#undef LOG_ID_ENTRY
+
+#define LOG_LEVEL_ENTRY(name, level, format) level,
+constexpr uint8_t LOG_LEVELS[LOG_MSG_COUNT] = {LOG_CATALOG(LOG_LEVEL_ENTRY)};
+#undef LOG_LEVEL_ENTRY
+
+#define LOG_FORMAT_ENTRY(name, level, format) format,
+constexpr const char *LOG_FORMATS[LOG_MSG_COUNT] = {LOG_CATALOG(LOG_FORMAT_ENTRY)};
+#undef LOG_FORMAT_ENTRY
+
+#define LOG_NAME_ENTRY(name, level, format) #name,
+constexpr const char *LOG_NAMES[LOG_MSG_COUNT] = {LOG_CATALOG(LOG_NAME_ENTRY)};
+#undef LOG_NAME_ENTRY
+
+#define LOG_MAX_ARGS 6
+
+// Conversions in a format ("%%" is a literal percent)
+constexpr int logFormatArgs(const char *f) {
+  int n = 0;
+  while (*f) {
+    if (*f++ != '%') continue;
+    if (*f == '%') {
+      f++;
+      continue;
+    }
+    n++;
+  }
+  return n;
+}
+
+#endif // LOG_CATALOG_H
@@ -0,0 +1,166 @@
+/*
+ * Last Drop - Per-Stage Loop Profiler
+ *
+ * PROFILE_SCOPE(profiler, stage) times the rest of the enclosing block with
+ * the CPU cycle counter and adds the sample to that stage's histogram. The
+ * `profile` BLE command reports p50 / p99 / max per stage from it.
+ *
+ * Histograms are fixed, log-scale and static: each power of two is split
+ * into PROFILE_SUB_BUCKETS linear buckets, so a percentile is exact to
+ * within 1 / PROFILE_SUB_BUCKETS of its value (25% by default) using
+ * PROFILE_BUCKETS counters per stage and no allocation.
+ *
+ * Define LOOP_PROFILER 0 to compile every scope out; LoopProfiler itself
+ * still builds so callers need no #ifs.
+ *
+ * Each stage must only be recorded from one task. Reading or resetting from
+ * another task may skew one sample, which is fine for diagnostics.
+ *
+ * Define PROFILE_CYCLES() before including this header to read the cycle
+ * counter (ESP.getCycleCount() on the board). This header must stay free of
+ * Arduino dependencies so it builds on the host.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+
+#ifndef LOOP_PROFILER
+#define LOOP_PROFILER 1
+#endif
+
+#ifndef PROFILE_MAX_STAGES
+#define PROFILE_MAX_STAGES 8
+#endif
+
+#define PROFILE_SUB_BITS 2
+#define PROFILE_SUB_BUCKETS (1 << PROFILE_SUB_BITS)
+// Values below PROFILE_SUB_BUCKETS get one bucket each, then
+// PROFILE_SUB_BUCKETS per octave up to 2^32
+#define PROFILE_BUCKETS ((32 - PROFILE_SUB_BITS + 1) * PROFILE_SUB_BUCKETS)
+
+struct ProfileStage {
+  const char *name;
+  uint32_t count;
+  uint32_t maxCycles;
+  uint64_t totalCycles;
+  uint32_t buckets[PROFILE_BUCKETS];
+};
+
+// Bucket for a sample (monotonic in cycles)
+inline int profileBucket(uint32_t cycles) {
+  if (cycles < PROFILE_SUB_BUCKETS) return (int)cycles;
+  int msb = 31 - __builtin_clz(cycles);
+  int sub = (cycles >> (msb - PROFILE_SUB_BITS)) & (PROFILE_SUB_BUCKETS - 1);
+  return (msb - PROFILE_SUB_BITS + 1) * PROFILE_SUB_BUCKETS + sub;
+}
+
+// Smallest sample that lands in a bucket
+inline uint32_t profileBucketLow(int bucket) {
+  if (bucket < PROFILE_SUB_BUCKETS) return (uint32_t)bucket;
+  int msb = bucket / PROFILE_SUB_BUCKETS + PROFILE_SUB_BITS - 1;
+  uint32_t sub = bucket & (PROFILE_SUB_BUCKETS - 1);
+  return (uint32_t)(PROFILE_SUB_BUCKETS + sub) << (msb - PROFILE_SUB_BITS);
+}
+
+// Largest sample that lands in a bucket
+inline uint32_t profileBucketHigh(int bucket) {
+  if (bucket >= PROFILE_BUCKETS - 1) return UINT32_MAX;
+  return profileBucketLow(bucket + 1) - 1;
+}
+
+class LoopProfiler {
+public:
+  LoopProfiler() : stageCount(0) {}
+
+  // Register a stage; ids are handed out in order from 0
+  int addStage(const char *name) {
+    if (stageCount >= PROFILE_MAX_STAGES) return -1;
+    ProfileStage &s = stages[stageCount];
+    s.name = name;
+    clear(s);
+    return stageCount++;
+  }
+
+  void record(int id, uint32_t cycles) {
+    if (id < 0 || id >= stageCount) return;
+    ProfileStage &s = stages[id];
+    s.count++;
+    s.totalCycles += cycles;
+    if (cycles > s.maxCycles) s.maxCycles = cycles;
+    s.buckets[profileBucket(cycles)]++;
+  }
+
+  // Upper bound of the bucket holding the given percentile (0-1000 permille),
+  // capped at the observed max. 0 if the stage has no samples.
+  uint32_t percentile(int id, uint32_t permille) const {
+    if (id < 0 || id >= stageCount) return 0;
+    const ProfileStage &s = stages[id];
+    if (s.count == 0) return 0;
+    uint64_t rank = ((uint64_t)s.count * permille + 999) / 1000;
+    if (rank == 0) rank = 1;
+    uint64_t seen = 0;
+    for (int b = 0; b < PROFILE_BUCKETS; b++) {
+      seen += s.buckets[b];
+      if (seen >= rank) {
+        uint32_t high = profileBucketHigh(b);
+        return high < s.maxCycles ? high : s.maxCycles;
+      }
+    }
+    return s.maxCycles;
+  }
+
+  void reset() {
+    for (int id = 0; id < stageCount; id++) {
+      clear(stages[id]);
+    }
+  }
+
+  int count() const { return stageCount; }
+  const ProfileStage &stage(int id) const { return stages[id]; }
+
+private:
+  ProfileStage stages[PROFILE_MAX_STAGES];
+  int stageCount;
+
+  static void clear(ProfileStage &s) {
+    s.count = 0;
+    s.maxCycles = 0;
+    s.totalCycles = 0;
+    for (int b = 0; b < PROFILE_BUCKETS; b++) {
+      s.buckets[b] = 0;
+    }
+  }
+};
+
+#if LOOP_PROFILER
+
+#ifndef PROFILE_CYCLES
+#error "Define PROFILE_CYCLES() before including profiler.h"
+#endif
+
+// Records the cycles between construction and the end of the scope
+class ProfileScope {
+public:
+  ProfileScope(LoopProfiler &profiler, int stage)
+    : profiler(profiler), stage(stage), start(PROFILE_CYCLES()) {}
+  ~ProfileScope() { profiler.record(stage, (uint32_t)(PROFILE_CYCLES() - start)); }
+
+private:
+  LoopProfiler &profiler;
+  int stage;
+  uint32_t start;
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(profiler, stage) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(profiler, stage)
+
+#else
+
+#define PROFILE_SCOPE(profiler, stage) do {} while (0)
+
+#endif // LOOP_PROFILER
+
+#endif // PROFILER_H
@@ -0,0 +1,115 @@
+/*
+ * Last Drop - Render State Shared Between Cores
+ *
+ * Game state is owned by the game task (core 0, next to the BLE stack). The
+ * LED strip and TFT are driven only by loop() on core 1. The two sides share
+ * exactly two things:
+ *
+ *  - RenderSnapshot: an immutable copy of everything the renderer draws,
+ *    published by the game task through a SeqLock. The renderer never takes
+ *    a lock; it retries the copy if a publish raced with it.
+ *  - RenderEvent: one-shot animations and screen changes (move, elimination,
+ *    winner, chance card, ...) posted through an SpscQueue.
+ */
+
+#ifndef RENDER_STATE_H
+#define RENDER_STATE_H
+
+#include <stdint.h>
+#include <atomic>
+#include <type_traits>
+
+#ifndef NUM_PLAYERS
+#define NUM_PLAYERS 4
+#endif
+
+// ==================== SEQLOCK ====================
+
+// Single-writer sequence lock. The counter is odd while a publish is in
+// progress; a reader that sees it change (or odd) simply copies again.
+template <typename T>
+class SeqLock {
+  static_assert(std::is_trivially_copyable<T>::value, "SeqLock payload must be trivially copyable");
+
+public:
+  SeqLock() : seq(0), data() {}
+
+  // Writer side (one task only)
+  void publish(const T &value) {
+    uint32_t s = seq.load(std::memory_order_relaxed);
+    seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    data = value;
+    seq.store(s + 2, std::memory_order_release);
+  }
+
+  // Reader side (any task, never blocks the writer)
+  void read(T &out) const {
+    for (;;) {
+      uint32_t before = seq.load(std::memory_order_acquire);
+      if (before & 1) continue;
+      out = data;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq.load(std::memory_order_relaxed) == before) return;
+    }
+  }
+
+  // Number of completed publishes
+  uint32_t version() const { return seq.load(std::memory_order_acquire) >> 1; }
+
+private:
+  std::atomic<uint32_t> seq;
+  T data;
+};
+
+// ==================== SNAPSHOT ====================
+
+struct RenderPlayer {
+  uint8_t tile;          // 1-20
+  bool alive;
+  bool coinPlaced;
+  int16_t score;
+  uint32_t color;        // NeoPixel color
+};
+
+struct RenderSnapshot {
+  RenderPlayer players[NUM_PLAYERS];
+  int8_t activePlayerCount;
+  int8_t currentPlayer;
+  int8_t expectedTile;
+  bool waitingForCoin;
+  uint32_t coinColor;        // Blink color for the expected tile
+  uint32_t coinWaitStartMs;
+  uint32_t coinTimeoutMs;
+  uint8_t connectionMode;    // ConnectionMode
+  bool idle;                 // Dim LEDs
+  bool goDiceConnected;
+};
+
+// ==================== EVENTS ====================
+
+enum RenderEventType : uint8_t {
+  RENDER_EVT_REFRESH = 0,    // Redraw players from the snapshot
+  RENDER_EVT_MOVE,           // player, from -> to, color
+  RENDER_EVT_ELIMINATION,    // player, color
+  RENDER_EVT_WINNER,         // player, color
+  RENDER_EVT_FLASH,          // whole strip in color for durationMs
+  RENDER_EVT_TILE_WARNING,   // tiles in tileMask in color for durationMs
+  RENDER_EVT_PLAYER_PREVIEW, // player's LED on tile 1 in color for durationMs
+  RENDER_EVT_STARTUP,        // Rainbow sweep
+  RENDER_EVT_DICE_RESULT,    // TFT: from = dice value
+  RENDER_EVT_CHANCE_CARD,    // TFT: from = card index, to = return screen
+  RENDER_EVT_SCREEN          // TFT: from = screen id
+};
+
+struct RenderEvent {
+  uint8_t type;
+  int8_t player;
+  uint8_t from;
+  uint8_t to;
+  uint16_t durationMs;
+  uint32_t color;
+  uint32_t tileMask;         // Bit (tile - 1)
+};
+
+#endif // RENDER_STATE_H
@@ -0,0 +1,172 @@
+/*
+ * Last Drop - Cooperative Deadline Scheduler
+ *
+ * Subsystems register periodic or one-shot tasks instead of polling their own
+ * millis() comparisons every pass of loop(). loop() calls runDue(), which runs
+ * whatever is due and returns how long it may sleep before the next deadline;
+ * BLE callbacks cut that sleep short when a command or dice event arrives.
+ *
+ * Deadlines are millis()-style uint32_t values compared wrap-safe. Per-task
+ * runtime is measured with the microsecond clock given to the constructor.
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+#ifndef SCHED_MAX_TASKS
+#define SCHED_MAX_TASKS 12
+#endif
+
+typedef void (*SchedTaskFn)();
+typedef uint32_t (*SchedClockFn)();
+
+const int SCHED_INVALID_TASK = -1;
+
+struct SchedTaskStats {
+  uint32_t runs;
+  uint64_t totalUs;
+  uint32_t maxUs;
+  uint32_t maxLateMs;    // Worst delay between deadline and actual start
+};
+
+struct SchedTask {
+  const char *name;
+  SchedTaskFn fn;
+  uint32_t periodMs;     // 0 = one-shot
+  uint32_t dueMs;
+  uint32_t armedAtMs;    // Start of the current period (for setPeriod)
+  bool armed;
+  SchedTaskStats stats;
+};
+
+// True once nowMs has reached dueMs (valid across millis() rollover)
+inline bool schedDue(uint32_t dueMs, uint32_t nowMs) {
+  return (int32_t)(nowMs - dueMs) >= 0;
+}
+
+class Scheduler {
+public:
+  Scheduler(SchedClockFn clockMs, SchedClockFn clockUs)
+    : clockMs(clockMs), clockUs(clockUs), taskCount(0), current(SCHED_INVALID_TASK) {}
+
+  // Periodic task; first run one period from now unless armed is false
+  int addPeriodic(const char *name, SchedTaskFn fn, uint32_t periodMs, bool armed = true) {
+    int id = add(name, fn, periodMs);
+    if (id != SCHED_INVALID_TASK && armed) runIn(id, periodMs);
+    return id;
+  }
+
+  // One-shot task; registered disarmed, schedule it with runIn()
+  int addOneShot(const char *name, SchedTaskFn fn) {
+    return add(name, fn, 0);
+  }
+
+  // (Re)arm a task to run delayMs from now. Periodic tasks continue from there.
+  void runIn(int id, uint32_t delayMs) {
+    if (!valid(id)) return;
+    uint32_t now = clockMs();
+    tasks[id].armedAtMs = now;
+    tasks[id].dueMs = now + delayMs;
+    tasks[id].armed = true;
+  }
+
+  void cancel(int id) {
+    if (valid(id)) tasks[id].armed = false;
+  }
+
+  // Change a periodic task's period. The next run is one new period after
+  // the start of the current one, so a task may retune itself while running.
+  void setPeriod(int id, uint32_t periodMs) {
+    if (!valid(id) || periodMs == 0) return;
+    SchedTask &t = tasks[id];
+    t.periodMs = periodMs;
+    if (t.armed) t.dueMs = t.armedAtMs + periodMs;
+  }
+
+  bool isArmed(int id) const {
+    return valid(id) && tasks[id].armed;
+  }
+
+  // Run every task whose deadline has passed, in registration order.
+  // Returns milliseconds until the next deadline, capped at maxSleepMs.
+  uint32_t runDue(uint32_t maxSleepMs) {
+    for (int id = 0; id < taskCount; id++) {
+      SchedTask &t = tasks[id];
+      uint32_t now = clockMs();
+      if (!t.armed || !schedDue(t.dueMs, now)) continue;
+
+      uint32_t late = now - t.dueMs;
+      if (late > t.stats.maxLateMs) t.stats.maxLateMs = late;
+
+      if (t.periodMs > 0) {
+        // Skip missed periods rather than running a burst to catch up
+        t.armedAtMs = now;
+        t.dueMs = now + t.periodMs;
+      } else {
+        t.armed = false;
+      }
+
+      current = id;
+      uint32_t startUs = clockUs();
+      t.fn();
+      uint32_t elapsedUs = clockUs() - startUs;
+      current = SCHED_INVALID_TASK;
+
+      t.stats.runs++;
+      t.stats.totalUs += elapsedUs;
+      if (elapsedUs > t.stats.maxUs) t.stats.maxUs = elapsedUs;
+    }
+    return msUntilNext(maxSleepMs);
+  }
+
+  // Milliseconds until the earliest armed deadline (0 if one is overdue)
+  uint32_t msUntilNext(uint32_t maxSleepMs) const {
+    uint32_t now = clockMs();
+    uint32_t sleep = maxSleepMs;
+    for (int id = 0; id < taskCount; id++) {
+      if (!tasks[id].armed) continue;
+      if (schedDue(tasks[id].dueMs, now)) return 0;
+      uint32_t wait = tasks[id].dueMs - now;
+      if (wait < sleep) sleep = wait;
+    }
+    return sleep;
+  }
+
+  // Task currently running inside runDue(), or SCHED_INVALID_TASK
+  int currentTask() const { return current; }
+
+  int count() const { return taskCount; }
+  const SchedTask &task(int id) const { return tasks[id]; }
+
+  void resetStats() {
+    for (int id = 0; id < taskCount; id++) {
+      tasks[id].stats = SchedTaskStats{0, 0, 0, 0};
+    }
+  }
+
+private:
+  SchedClockFn clockMs;
+  SchedClockFn clockUs;
+  SchedTask tasks[SCHED_MAX_TASKS];
+  int taskCount;
+  int current;
+
+  bool valid(int id) const { return id >= 0 && id < taskCount; }
+
+  int add(const char *name, SchedTaskFn fn, uint32_t periodMs) {
+    if (taskCount >= SCHED_MAX_TASKS || fn == nullptr) return SCHED_INVALID_TASK;
+    SchedTask &t = tasks[taskCount];
+    t.name = name;
+    t.fn = fn;
+    t.periodMs = periodMs;
+    t.dueMs = 0;
+    t.armedAtMs = 0;
+    t.armed = false;
+    t.stats = SchedTaskStats{0, 0, 0, 0};
+    return taskCount++;
+  }
+};
+
+#endif // SCHEDULER_H
@@ -32,7 +32,6 @@
 #include <Preferences.h>
 #include <ArduinoJson.h>
 #include <esp_task_wdt.h>
-#include <queue>
 
 // ==================== STANDALONE MODE FLAG ====================
 // Set to 1 for standalone operation with TFT display and GoDice
@@ -89,15 +88,8 @@ const int CORNER_LEDS[4] = {0, 33, 69, 101};  // Connection status indicators
 #define SCL_PIN 14
 #define MCP_ADDR 0x27
 
-// MCP23017 Port B tiles (PB0-PB7)
-const uint8_t MCP_PORTB_TILES[8] = {1, 20, 19, 18, 16, 14, 17, 15};
-
-// MCP23017 Port A tiles (PA0-PA7)
-const uint8_t MCP_PORTA_TILES[8] = {2, 3, 4, 5, 13, 7, 8, 6};
-
-// Direct ESP32 GPIO tiles (4 tiles not on MCP)
-const uint8_t DIRECT_GPIO_PINS[4] = {17, 18, 8, 9};
-const uint8_t DIRECT_GPIO_TILES[4] = {9, 10, 11, 12};
+// Tile → MCP port / GPIO wiring and debounce logic live in hall_sensors.h
+#include "hall_sensors.h"
 
 Adafruit_MCP23X17 mcp;
 
@@ -118,24 +110,9 @@ Adafruit_MCP23X17 mcp;
 #define GODICE_CMD_SET_LED     0x08
 #define GODICE_CMD_PULSE_LED   0x10
 
-// GoDice Protocol Messages
-#define GODICE_MSG_ROLLING     0x52  // 'R'
-#define GODICE_MSG_STABLE      0x53  // 'S'
-#define GODICE_MSG_FAKE_STABLE 0x46  // 'F'
-#define GODICE_MSG_TILT_STABLE 0x54  // 'T'
-#define GODICE_MSG_MOVE_STABLE 0x4D  // 'M'
-#define GODICE_MSG_BATTERY     0x42  // 'B'
-#define GODICE_MSG_COLOR       0x43  // 'C'
-
-// GoDice XYZ vectors for face detection
-const int8_t GODICE_D6_VECTORS[6][3] = {
-    { -64,  0,   0 },    // Face 1 UP (X negative)
-    {  0,   0,  64 },    // Face 2 UP (Z positive)
-    {  0,  64,   0 },    // Face 3 UP (Y positive)
-    {  0, -64,   0 },    // Face 4 UP (Y negative)
-    {  0,   0, -64 },    // Face 5 UP (Z negative)
-    {  64,  0,   0 }     // Face 6 UP (X positive)
-};
+// Tilt/move stables nearer the runner-up face than this are not committed
+// (see handleGoDiceStable); ~3000 is about 30° off flat on a D6
+#define DICE_MIN_MARGIN 3000
 
 // ==================== BOARD IDENTIFICATION ====================
 // IMPORTANT: Change these values for each board you manufacture
@@ -161,6 +138,11 @@ const bool TEST_MODE_1 = true;         // When PRODUCTION_MODE is false and this
 // Note: STANDALONE_BOARD is defined as macro above (line 41)
 // #define STANDALONE_BOARD 1
 
+// Per-stage loop profiler (`profile` command); 0 compiles every scope out
+#ifndef LOOP_PROFILER
+#define LOOP_PROFILER 1
+#endif
+
 // ==================== HALL SENSOR OPERATIONAL FLAGS ====================
 bool HALL_SENSOR_OPERATIONAL = false;   // Set to true to use real Hall sensors, false to use timer delay
 const unsigned long TURN_DELAY_MS = 5000;   // 5 seconds default turn delay when Hall sensors disabled (configurable via BLE)
@@ -276,9 +258,103 @@ const uint32_t TILE_COLORS[NUM_TILES] = {
 // Player colors (will be initialized in setup() with strip.Color())
 uint32_t PLAYER_COLORS[NUM_PLAYERS];
 
+// ==================== PROFILER ====================
+#define PROFILE_CYCLES() ESP.getCycleCount()
+#include "profiler.h"
+
+// Stage ids, registered in this order by initProfiler()
+enum ProfileStageId {
+  PROF_COMMANDS,       // processCommandQueue (one command)
+  PROF_COIN_CHECK,     // checkCoinPlacement
+  PROF_TILE_SCAN,      // scanAllTiles
+  PROF_GODICE,         // GoDice connection handling + queued rolls
+  PROF_RENDER_EVENT,   // One queued LED / TFT animation
+  PROF_DISPLAY,        // updateDisplay
+  PROF_LED_SHOW        // strip.show()
+};
+
+LoopProfiler loopProfiler;
+
+void initProfiler() {
+  loopProfiler.addStage("commands");
+  loopProfiler.addStage("coin_check");
+  loopProfiler.addStage("tile_scan");
+  loopProfiler.addStage("godice");
+  loopProfiler.addStage("render_event");
+  loopProfiler.addStage("display");
+  loopProfiler.addStage("led_show");
+}
+
+// NeoPixel strip whose show() is timed as its own stage
+class ProfiledStrip : public Adafruit_NeoPixel {
+public:
+  using Adafruit_NeoPixel::Adafruit_NeoPixel;
+  
+  void show() {
+    PROFILE_SCOPE(loopProfiler, PROF_LED_SHOW);
+    Adafruit_NeoPixel::show();
+  }
+};
+
+// ==================== BINARY LOG ====================
+// Hot-path messages are recorded as (id, timestamp, args) and written to
+// Serial in idle time; see binlog.h and log_catalog.h. Decode the "$B"
+// lines with test/binlog_decode, or build with BINLOG_TEXT 1 to format them
+// on the board instead.
+#ifndef BINLOG_TEXT
+#define BINLOG_TEXT 0
+#endif
+
+#define BINLOG_MICROS() micros()
+#include "binlog.h"
+
+#define BINLOG_SLOTS 128
+#define BINLOG_DRAIN_MAX 16         // Records per idle pass
+#define BINLOG_SERIAL_TX_BUFFER 1024  // Drain only what fits without blocking
+
+BinLog<BINLOG_SLOTS> binlog;
+
+#define BLOG(name, ...) binlog.log<LOG_##name>(__VA_ARGS__)
+
+// ==================== GAME SNAPSHOT ====================
+// The saved game is one CRC-checked blob in two alternating NVS slots
+// instead of 16 keys; see game_snapshot.h
+#include "game_snapshot.h"
+
+// ==================== GAME JOURNAL ====================
+// Saves append per-player records to the "journal" partition
+// (partitions.csv); the NVS snapshot is used only when the partition is
+// missing, and seeds the journal on first boot. See game_journal.h
+#include "game_journal.h"
+#include <esp_partition.h>
+
+#define JOURNAL_PARTITION_SUBTYPE 0x40
+#define JOURNAL_SECTOR_SIZE 4096
+
+// The journal's Flash interface over an esp_partition
+struct PartitionFlash {
+  const esp_partition_t* part = nullptr;
+
+  bool find() {
+    part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                    (esp_partition_subtype_t)JOURNAL_PARTITION_SUBTYPE, "journal");
+    return part != nullptr;
+  }
+  uint32_t size() { return part ? part->size : 0; }
+  uint32_t sectorSize() { return JOURNAL_SECTOR_SIZE; }
+  bool erase(uint32_t addr) { return esp_partition_erase_range(part, addr, JOURNAL_SECTOR_SIZE) == ESP_OK; }
+  bool write(uint32_t addr, const void* data, uint32_t len) {
+    return esp_partition_write(part, addr, data, len) == ESP_OK;
+  }
+  bool read(uint32_t addr, void* data, uint32_t len) { return esp_partition_read(part, addr, data, len) == ESP_OK; }
+};
+
 // ==================== GLOBAL OBJECTS ====================
-Adafruit_NeoPixel strip(NUM_LEDS, LED_PIN, NEO_GRB + NEO_KHZ800);
+ProfiledStrip strip(NUM_LEDS, LED_PIN, NEO_GRB + NEO_KHZ800);
 Preferences preferences;
+SnapshotStore<Preferences> snapshotStore(preferences);
+PartitionFlash journalFlash;
+GameJournal<PartitionFlash> journal(journalFlash);
 
 // Android App BLE (for non-standalone mode)
 BLEServer *pServer = NULL;
@@ -304,6 +380,24 @@ int diceBattery = -1;
 String diceColorName = "Unknown";
 unsigned long lastRollTime = 0;
 unsigned long rollCount = 0;
+unsigned long diceLowConfidence = 0;  // Tilted stables held back
+
+#include <GoDice.h>
+GoDiceDecoder<1> goDiceDecoder;  // Notify bytes -> events (game task only)
+
+#define GODICE_NOTIFY_MAX 20         // Longest notification kept (default ATT payload)
+#define GODICE_NOTIFY_QUEUE_SIZE 16  // Notifications waiting for the game task (power of two)
+
+// Notification bytes as received, decoded on the game task
+struct GoDiceNotify {
+  uint8_t connection;  // goDiceConnection when received
+  uint8_t size;
+  uint8_t data[GODICE_NOTIFY_MAX];
+};
+
+volatile uint8_t goDiceConnection = 0;  // Bumped by onConnect
+uint8_t goDiceDecodedConnection = 0;    // Game task: connection the decoder's state belongs to
+unsigned long goDiceOversize = 0;       // Notifications longer than GODICE_NOTIFY_MAX
 
 // ==================== GAME STATE ====================
 struct PlayerState {
@@ -328,7 +422,6 @@ const unsigned long COIN_TIMEOUT = 60000; // 60 seconds (increased for winner an
 
 // Security: Pairing state
 bool isPaired = false;
-unsigned long pairTimeout = 0;
 const unsigned long PAIR_TIMEOUT_MS = 30000;  // 30 seconds to enter password
 
 // Board Settings (customizable from Android)
@@ -343,9 +436,8 @@ enum ConnectionMode {
   MODE_READY            // Player LED blink (ready for game)
 };
 ConnectionMode currentConnectionMode = MODE_DISCONNECTED;
-unsigned long lastConnectionLEDUpdate = 0;
 const unsigned long CONNECTION_LED_INTERVAL = 500;  // 500ms blink/pulse
-int connectionLEDStep = 0;
+int connectionLEDStep = 0;  // Render core only (reset when the mode changes)
 
 // Undo state tracking
 struct UndoState {
@@ -357,26 +449,34 @@ struct UndoState {
   int chanceCardNumber;
 } lastMove;
 
+// ==================== SHARED RENDER STATE ====================
+// Declared before the LED and display code that reads renderView
+#include "spsc_queue.h"
+#include "render_state.h"
+
+SeqLock<RenderSnapshot> renderSnapshot;
+SpscQueue<RenderEvent, 16> renderEvents;  // Game task -> render loop
+SpscQueue<GoDiceNotify, GODICE_NOTIFY_QUEUE_SIZE> goDiceNotifyQueue;  // GoDice notify (BLE task) -> game task
+RenderSnapshot renderView;                // Render core's copy of the snapshot
+bool ledsIdle = false;                    // Game-owned, rendered as brightness
+
 // ==================== LED CONTROL ====================
+// Render core only
 bool blinkState = false;  // For coin waiting animation
 bool connectionBlinkState = false;  // For connection status animation
-unsigned long lastBlinkTime = 0;
 const unsigned long BLINK_INTERVAL = 500;
 
 // Forward declarations for LED rendering functions
 void renderPlayers();
 void renderBackground();
 int getPlayerLED(int tile, int playerId);
-void animatePlayerElimination(int playerId);
-void animateWinner(int winnerId);
+void animatePlayerElimination(int playerId, uint32_t playerColor);
+void animateWinner(int winnerId, uint32_t winnerColor);
 
+// Paced by the conn_leds render task (CONNECTION_LED_INTERVAL); draws the
+// mode from the render snapshot, the game task owns the mode itself
 void updateConnectionStatusLEDs() {
-  if (millis() - lastConnectionLEDUpdate < CONNECTION_LED_INTERVAL) {
-    return;
-  }
-  lastConnectionLEDUpdate = millis();
-  
-  switch (currentConnectionMode) {
+  switch (renderView.connectionMode) {
     case MODE_DISCONNECTED:
       // Light blue blink on corner LEDs (0, 36, 70, 104)
       if (connectionBlinkState) {
@@ -418,9 +518,7 @@ void updateConnectionStatusLEDs() {
           }
           connectionLEDStep++;
         } else {
-          // Completed success animation, switch to READY mode
-          currentConnectionMode = MODE_READY;
-          connectionLEDStep = 0;
+          // Completed; the game task's connected_anim timer switches to READY
           strip.clear();
         }
         strip.show();
@@ -431,7 +529,7 @@ void updateConnectionStatusLEDs() {
       // Show player positions only if game is active AND coins are placed
       bool gameActive = false;
       for (int i = 0; i < NUM_PLAYERS; i++) {
-        if (players[i].coinPlaced) {
+        if (renderView.players[i].coinPlaced) {
           gameActive = true;
           break;
         }
@@ -443,11 +541,11 @@ void updateConnectionStatusLEDs() {
       } else {
         // Pre-game: Show all active players on tile 1 with their configured colors
         strip.clear();
-        for (int i = 0; i < activePlayerCount; i++) {
-          if (players[i].alive) {
+        for (int i = 0; i < renderView.activePlayerCount; i++) {
+          if (renderView.players[i].alive) {
             int ledIndex = getPlayerLED(1, i);  // All players start on tile 1
             if (ledIndex >= 0) {
-              strip.setPixelColor(ledIndex, players[i].color);
+              strip.setPixelColor(ledIndex, renderView.players[i].color);
             }
           }
         }
@@ -457,39 +555,255 @@ void updateConnectionStatusLEDs() {
   }
 }
 
-unsigned long lastScanTime = 0;
 const unsigned long SCAN_INTERVAL = 5000;
 
 // ==================== COMMAND QUEUE ====================
-std::queue<String> commandQueue;
+// BLE onWrite (producer) -> game task (consumer), fixed slots, no heap
+#include "command_ring.h"
+#include "command_table.h"
+#include "wire_protocol.h"
+
+#define CMD_RING_SLOTS 8
+#define CMD_SLOT_SIZE 512  // Largest ATT attribute value; the MTU is negotiated up to fit
+
+CommandRing<CMD_RING_SLOTS, CMD_SLOT_SIZE> commandRing;
 bool processingCommand = false;
+uint32_t reportedCommandDrops = 0;  // Drops already reported to the app
+
+// Each game pass dispatches commands until this much time is spent (at
+// least one command), then lets timers and tasks run before continuing
+#ifndef COMMAND_BUDGET_US
+#define COMMAND_BUDGET_US 4000
+#endif
+uint32_t commandBudgetUs = COMMAND_BUDGET_US;  // Runtime configurable via config
+uint32_t commandDrainsCutShort = 0;            // Passes that left commands queued
+
+// Binary event encoding agreed at pairing (0 = JSON); see wire_protocol.h
+uint8_t wireVersion = 0;
+#define WIRE_EVENT_BUF 128
+#define WIRE_STR_(x) #x
+#define WIRE_STR(x) WIRE_STR_(x)
+#define WIRE_VERSION_STR WIRE_STR(WIRE_VERSION)
+
+// Per-command latency: wait = enqueue -> dispatch, run = dispatch -> done
+struct CommandStats {
+  uint32_t count;
+  uint64_t totalRunUs;
+  uint32_t maxRunUs;
+  uint32_t maxWaitUs;
+};
+
+// Indexed by CommandId; the extra last slot counts unknown or unparsable commands
+const int NUM_COMMAND_STATS = CMD_COUNT + 1;
+CommandStats commandStats[NUM_COMMAND_STATS];
+
+// NVS writes are coalesced: handlers request a save, one write happens
+// SAVE_COALESCE_MS after the first request
+const unsigned long SAVE_COALESCE_MS = 250;
+
+// ==================== COMMAND ARGUMENTS ====================
+// Typed args, their parsers and dispatchCommand() live in command_layer.h
+// so the host tests and fuzzer run the same code; BoardCommands (below the
+// handlers) connects it to the game
+#include "command_layer.h"
+
+// Request id of the command being dispatched, echoed on whatever it sends,
+// and of the command that started the current coin wait, echoed on the
+// wait's deferred events (see REQUEST IDS in command_layer.h)
+RequestTag activeRequest = NO_REQUEST;
+RequestTag coinWaitRequest = NO_REQUEST;
+
+// Sends inside its scope carry the given request's id
+struct RequestScope {
+  RequestTag saved;
+  explicit RequestScope(const RequestTag& request) : saved(activeRequest) { activeRequest = request; }
+  ~RequestScope() { activeRequest = saved; }
+};
+
+// ==================== NOTIFY FRAMING ====================
+// Messages longer than one notification (MTU - 3) are split into fragments
+// instead of being truncated by the stack; see ble_framing.h
+#include "ble_framing.h"
+#include <atomic>
+
+std::atomic<uint16_t> peerMtu(ATT_DEFAULT_MTU);  // Updated by the MTU exchange
+std::atomic<bool> linkCongested(false);          // ESP_GATTS_CONGEST_EVT
+uint8_t notifySeq = 0;
+esp_gatt_if_t txGattsIf = ESP_GATT_IF_NONE;      // From ESP_GATTS_CONNECT_EVT
+uint16_t txConnId = 0;
+BLE2902* pTxCccd = nullptr;                      // Client's notification subscription
+
+#define NOTIFY_RETRY_MS 16          // Offer a refused fragment again at least this often
+#define NOTIFY_GIVE_UP_MS 500       // Drop a message whose link stays congested this long
+#define NOTIFY_BACKLOG_BYTES 4096   // Messages waiting behind a congested link
+
+NotifySender<NOTIFY_BACKLOG_BYTES> notifySender(NOTIFY_GIVE_UP_MS);  // Game task only
+uint32_t notifyMessagesDropped = 0;  // Before framing (tx arena overflow)
+
+// ==================== STATE LOG ====================
+// Sequenced field-level record of the state the app mirrors; the app acks
+// seqs and gets deltas, and a reconnect with a known (seq, checksum) skips
+// the full sync_state. See state_log.h.
+#include "state_log.h"
+static_assert(NUM_PLAYERS == STATE_MAX_PLAYERS, "state_log.h is sized for NUM_PLAYERS");
+
+#define STATE_LOG_ENTRIES 64
+#define STATE_LOG_COMMITS 32
+#define STATE_DELTA_MAX 12  // More changed fields than this: send a snapshot
+
+StateLog<STATE_LOG_ENTRIES, STATE_LOG_COMMITS> stateLog;
+bool stateSyncEnabled = false;  // App has sent state_ack / resync this session
+// Committed state from before the connect-time reset, restored if the
+// app's resync proves it still has it
+SyncedState parkedState;
+uint32_t parkedSeq = 0;
+bool parkedStateValid = false;
 
 // ==================== HEARTBEAT ====================
-unsigned long lastHeartbeatTime = 0;
 const unsigned long HEARTBEAT_INTERVAL = 5000;  // 5 seconds
 
 // ==================== ACTIVITY TRACKING ====================
 unsigned long lastActivityTime = 0;
 const unsigned long IDLE_TIMEOUT = 300000;  // 5 minutes
 
+// ==================== SCHEDULER ====================
+#include "scheduler.h"
+
+uint32_t schedClockMs() { return millis(); }
+uint32_t schedClockUs() { return micros(); }
+Scheduler scheduler(schedClockMs, schedClockUs);
+
+const unsigned long COIN_CHECK_INTERVAL = 20;  // Hall sensor poll while waiting for coin
+const unsigned long LOOP_MAX_SLEEP_MS = 1000;  // Longest idle sleep (keeps watchdog fed)
+const unsigned long STATE_REQUEST_DELAY = 500;  // Let Android finish connecting first
+
+// Game task (core 0) and render loop (core 1) each run their own scheduler
+Scheduler renderScheduler(schedClockMs, schedClockUs);
+
+int coinCheckTask = SCHED_INVALID_TASK;
+int coinBlinkTask = SCHED_INVALID_TASK;
+
+// ==================== TIMERS ====================
+// Timers are also armed from BLE callbacks (GoDice rolls, chance cards)
+portMUX_TYPE timerWheelMux = portMUX_INITIALIZER_UNLOCKED;
+#define TIMER_WHEEL_LOCK() portENTER_CRITICAL(&timerWheelMux)
+#define TIMER_WHEEL_UNLOCK() portEXIT_CRITICAL(&timerWheelMux)
+#include "timer_wheel.h"
+
+TimerWheel timers(schedClockMs);        // Game task
+TimerWheel renderTimers(schedClockMs);  // Render loop (chance card dismiss)
+
+void onCoinTimeout();
+void onTurnDelayElapsed();
+void onHeartbeat();
+void onPairTimeout();
+void onConnectedAnimationDone();
+void requestStateSync();
+void saveGameState();
+void checkIdleTimeout();
+
+WheelTimer coinTimeoutTimer("coin_timeout", onCoinTimeout);
+WheelTimer turnDelayTimer("turn_delay", onTurnDelayElapsed);
+WheelTimer heartbeatTimer("heartbeat", onHeartbeat);
+WheelTimer pairTimer("pair_timeout", onPairTimeout);
+WheelTimer connectedTimer("connected_anim", onConnectedAnimationDone);
+WheelTimer stateRequestTimer("state_request", requestStateSync);
+WheelTimer saveTimer("state_save", saveGameState);
+WheelTimer idleTimer("idle", checkIdleTimeout);
+
+// ==================== CORE SPLIT ====================
+// Game state is only mutated by the game task on core 0 (next to the BLE
+// stack). The LED strip and TFT are only driven by loop() on core 1, which
+// draws from the published RenderSnapshot and plays posted RenderEvents, so
+// a slow animation or screen redraw never delays a command or dice roll.
+// The shared snapshot and queues are declared above the LED section.
+
+#define GAME_TASK_CORE 0
+#define GAME_TASK_STACK 8192
+#define GAME_TASK_PRIORITY 1
+
+TaskHandle_t gameTaskHandle = NULL;
+TaskHandle_t renderTaskHandle = NULL;
+
+// Cut the game task's sleep short when an event arrives (safe from BLE callbacks)
+void wakeGameTask() {
+  if (gameTaskHandle != NULL) {
+    xTaskNotifyGive(gameTaskHandle);
+  }
+}
+
+void wakeRenderLoop() {
+  if (renderTaskHandle != NULL) {
+    xTaskNotifyGive(renderTaskHandle);
+  }
+}
+
+// ==================== TX ARENA ====================
+// Responses are serialized straight into one preallocated buffer and
+// fragmented into another, then handed to the stack; see tx_arena.h
+#ifndef TX_ALLOC_COUNTER
+#define TX_ALLOC_COUNTER 0  // 1: count the game task's C++ heap allocations (profiling builds)
+#endif
+
+#if TX_ALLOC_COUNTER
+#include <new>
+
+uint32_t gameTaskHeapAllocs = 0;
+
+// Replaces the global allocator only to count; TxArena reports how many
+// happened while a message was being built and sent
+void* operator new(size_t size) {
+  if (gameTaskHandle != NULL && xTaskGetCurrentTaskHandle() == gameTaskHandle) {
+    gameTaskHeapAllocs++;
+  }
+  void* p = malloc(size);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept {
+  free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  free(p);
+}
+
+#define TX_HEAP_ALLOCS() gameTaskHeapAllocs
+#endif
+
+#include "tx_arena.h"
+
+#define TX_MESSAGE_SIZE 2048  // Largest response (status_report) with headroom
+
+TxArena<TX_MESSAGE_SIZE, CMD_SLOT_SIZE> txArena;  // Fragments: payload at our MTU
+
 // ==================== HELPER FUNCTIONS (Forward Declarations) ====================
 bool isTrustedDevice(BLEAddress address);
 void sendBLEResponse(const char* json);
-void sendBLEResponse(String json);
+void sendBLEJson(const JsonDocument& doc);
 void sendErrorResponse(const char* message);
+void sendBLEFrame(WireWriter& frame);
+void notifyApp(const uint8_t* data, size_t len);
+void onGattsEvent(esp_gatts_cb_event_t event, esp_gatt_if_t gattsIf, esp_ble_gatts_cb_param_t* param);
 void loadGameState();
 void startupAnimation();
 void resetIdleTimer();
 void validateGameState();
-void handleUndo(JsonDocument& doc);
+void handleUndo();
 void handleReset();
-void handleVictory(JsonDocument& doc);
 void sendStatus();
+void sendTaskStats(bool reset);
+void sendProfile(bool reset);
 void animateMove(int fromTile, int toTile, uint32_t color, int playerId);
 void setTileColor(int tile, uint32_t color);
 void renderBackground();
 void renderPlayers();
 void saveGameState();
+void requestSaveGameState();
+void captureGameSnapshot(GameSnapshot& snap);
+void applyGameSnapshot(const GameSnapshot& snap);
+bool migrateLegacyGameState();
 void sendRollResponse(int playerId, int fromTile, int toTile, const TileDefinition& tile, int scoreChange, int oldScore, int newScore, int chanceCard, const char* chanceDesc, bool alive, bool waitForCoin);
 void sendUndoResponse(int playerId, int fromTile, int toTile, int score, bool alive);
 void sendResetResponse();
@@ -500,49 +814,80 @@ const char* getTileTypeName(TileType type);
 // GoDice mode function (only used when STANDALONE_BOARD == true)
 void processDiceRoll(int diceValue);
 
+// Command ring (BLE onWrite -> game task)
+CommandPushResult handleBLECommand(const uint8_t* data, size_t len);
+void reportCommandBackpressure();
+void drainBinlog();
+void drainCommandRing();
+void recordCommandStats(CommandId id, uint32_t waitUs, uint32_t runUs);
+
+// Command handlers (called through BoardCommands)
+void handleRoll(const RollArgs& args);
+void handlePair(const PairArgs& args);
+void handleConfig(const ConfigArgs& args);
+void handleSyncState(const SyncStateArgs& args);
+void handleUpdateSettings(const UpdateSettingsArgs& args);
+void handleVictory(const VictoryArgs& args);
+void handleUnpair();
+void handleStateAck(const StateAckArgs& args);
+void handleResync(const ResyncArgs& args);
+
+// State log (app sync)
+void captureSyncedState(SyncedState& s);
+void restoreSyncedState(const SyncedState& s);
+bool commitGameState();
+void publishStateChanges();
+void sendStateDelta();
+void sendStateSnapshot();
+
+// Core split (game task -> render loop)
+void enterConnectedMode();
+void publishRenderSnapshot();
+void postRenderEvent(uint8_t type, int8_t player = -1, uint8_t from = 0, uint8_t to = 0,
+                     uint32_t color = 0, uint16_t durationMs = 0, uint32_t tileMask = 0);
+void playRenderEvent(const RenderEvent &evt);
+void appendTaskStats(JsonArray &tasksArray, Scheduler &sched, const char* core);
+
 // ==================== BLE CALLBACKS ====================
 class MyServerCallbacks: public BLEServerCallbacks {
+    // Session setup/teardown runs on the game task (see gameLoop)
     void onConnect(BLEServer* pServer) {
       deviceConnected = true;
       Serial.println("✓ BLE Client Connected");
       Serial.print("Connection time: ");
       Serial.println(millis());
-      
-      // Clear any old game state from previous session
-      for (int i = 0; i < NUM_PLAYERS; i++) {
-        players[i].currentTile = 1;
-        players[i].score = 10;
-        players[i].alive = true;
-        players[i].coinPlaced = false;  // Critical: ensure no ghost coins
-        players[i].color = PLAYER_COLORS[i];
-      }
-      lastMove.hasUndo = false;
-      Serial.println("✓ Game state reset for new session");
-      
-      // Send ready message
-      sendBLEResponse("{\"event\":\"ready\",\"message\":\"ESP32 Test Mode Ready\",\"firmware\":\"v2.0-testmode\"}");
-      
-      // Request game state sync from Android (in case of reconnection during active game)
-      delay(500);  // Wait for Android to be ready
-      sendBLEResponse("{\"event\":\"request_state\",\"message\":\"Requesting game state sync\"}");
-      Serial.println("📤 Requesting game state from Android...");
+      wakeGameTask();
     };
 
     void onDisconnect(BLEServer* pServer) {
       deviceConnected = false;
+      peerMtu = ATT_DEFAULT_MTU;
+      linkCongested = false;
       Serial.println("✗ BLE Client Disconnected");
-      waitingForCoin = false;
-      expectedTile = -1;
+      wakeGameTask();
+    }
+
+    void onMtuChanged(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) {
+      peerMtu = param->mtu.mtu;
     }
 };
 
+// Bluedroid task: the controller's notification buffers filled up / drained
+void onGattsEvent(esp_gatts_cb_event_t event, esp_gatt_if_t gattsIf, esp_ble_gatts_cb_param_t* param) {
+  if (event == ESP_GATTS_CONGEST_EVT) {
+    linkCongested = param->congest.congested;
+    if (!linkCongested) wakeGameTask();  // Resume the notify backlog
+  } else if (event == ESP_GATTS_CONNECT_EVT) {
+    txGattsIf = gattsIf;  // Where notifyApp() sends
+    txConnId = param->connect.conn_id;
+  }
+}
+
 class MyCallbacks: public BLECharacteristicCallbacks {
+    // Bluedroid task: copy straight into a ring slot, logging happens on the game task
     void onWrite(BLECharacteristic *pCharacteristic) {
-      String rxValue = pCharacteristic->getValue().c_str();
-      if (rxValue.length() > 0) {
-        Serial.println("📨 Received BLE Command:");
-        Serial.println(rxValue);
-        handleBLECommand(rxValue.c_str());
+      if (handleBLECommand(pCharacteristic->getData(), pCharacteristic->getLength()) != CMD_PUSH_EMPTY) {
+        wakeGameTask();
       }
     }
 };
@@ -557,6 +902,8 @@ class MyCallbacks: public BLECharacteristicCallbacks {
 
 // ==================== SETUP ====================
 void setup() {
+  initProfiler();
+  Serial.setTxBufferSize(BINLOG_SERIAL_TX_BUFFER);
   Serial.begin(115200);
   Serial.println("\n========================================");
   Serial.println("Last Drop ESP32 Test Mode Firmware v2.0");
@@ -704,6 +1051,9 @@ void setup() {
   // Show startup animation on LEDs
   startupAnimation();
 
+  // Register timed tasks and timers; loop() sleeps between their deadlines
+  initScheduler();
+
   Serial.println("✓ System Ready - Waiting for BLE connection...\n");
 }
 
@@ -761,6 +1111,8 @@ void initBLE() {
 
   // Android mode: Init as BLE server
   BLEDevice::init(boardNickname.c_str());  // Use custom nickname (defaults to BOARD_UNIQUE_ID)
+  BLEDevice::setMTU(CMD_SLOT_SIZE + 3);     // Whole command fits one ATT write (3-byte header)
+  BLEDevice::setCustomGattsHandler(onGattsEvent);
   
   Serial.print("ESP32 MAC Address: ");
   Serial.println(BLEDevice::getAddress().toString().c_str());
@@ -792,7 +1144,8 @@ void initBLE() {
                         CHARACTERISTIC_UUID_TX,
                         BLECharacteristic::PROPERTY_NOTIFY
                       );
-  pTxCharacteristic->addDescriptor(new BLE2902());
+  pTxCccd = new BLE2902();
+  pTxCharacteristic->addDescriptor(pTxCccd);
 
   BLECharacteristic *pRxCharacteristic = pService->createCharacteristic(
                                            CHARACTERISTIC_UUID_RX,
@@ -824,69 +1177,114 @@ void initBLE() {
 }
 
 // ==================== BLE COMMAND HANDLER ====================
-void handleBLECommand(const char* jsonStr) {
+// Bluedroid task: no Serial here. The ring counts full and oversize drops,
+// and reportCommandBackpressure() sends them from the game task.
+CommandPushResult handleBLECommand(const uint8_t* data, size_t len) {
   // Queue command for sequential processing
-  commandQueue.push(String(jsonStr));
+  return commandRing.push(data, len, micros());
+}
+
+// Tell the app about commands the ring had to drop since the last report
+void reportCommandBackpressure() {
+  uint32_t drops = commandRing.droppedCount() + commandRing.oversizeCount();
+  if (drops == reportedCommandDrops) return;
+  reportedCommandDrops = drops;
+  
+  StaticJsonDocument<192> doc;
+  doc["event"] = "queue_full";
+  doc["dropped"] = commandRing.droppedCount();
+  doc["oversize"] = commandRing.oversizeCount();
+  doc["capacity"] = commandRing.capacity();
+  doc["maxCommandBytes"] = commandRing.slotSize();
+  
+  sendBLEJson(doc);
 }
 
 // ==================== COMMAND QUEUE PROCESSOR ====================
+// Binds command_layer.h's dispatch to the game's handlers
+struct BoardCommands {
+  bool paired() { return !PAIRING_REQUIRED || isPaired; }
+  void received(CommandId id, uint32_t len, bool binary, const RequestTag& request) {
+    BLOG(CMD_RECEIVED, id, len, binary);
+    activeRequest = request;
+    // Keeps GAME responses in order: an open coin wait's later events must
+    // not be attributed to a request the app has seen superseded
+    if (id < CMD_COUNT && COMMAND_CATEGORIES[id] == CMD_CAT_GAME) coinWaitRequest = NO_REQUEST;
+  }
+  void handleRoll(const RollArgs& args) { ::handleRoll(args); }
+  void handleUndo() { ::handleUndo(); }
+  void handleReset() { ::handleReset(); }
+  void handlePair(const PairArgs& args) { ::handlePair(args); }
+  void handleUnpair() { ::handleUnpair(); }
+  void handleConfig(const ConfigArgs& args) { ::handleConfig(args); }
+  void handleSyncState(const SyncStateArgs& args) { ::handleSyncState(args); }
+  void handleUpdateSettings(const UpdateSettingsArgs& args) { ::handleUpdateSettings(args); }
+  void sendStatus() { ::sendStatus(); }
+  void sendTaskStats(bool reset) { ::sendTaskStats(reset); }
+  void sendProfile(bool reset) { ::sendProfile(reset); }
+  void handleVictory(const VictoryArgs& args) { ::handleVictory(args); }
+  void handleStateAck(const StateAckArgs& args) { ::handleStateAck(args); }
+  void handleResync(const ResyncArgs& args) { ::handleResync(args); }
+};
+
+BoardCommands boardCommands;
+
 void processCommandQueue() {
-  if (processingCommand || commandQueue.empty()) return;
+  if (processingCommand) return;
+  uint32_t cmdLen = 0;
+  uint32_t enqueuedUs = 0;
+  char* cmdStr = commandRing.front(cmdLen, &enqueuedUs);
+  if (cmdStr == nullptr) return;
+  PROFILE_SCOPE(loopProfiler, PROF_COMMANDS);
+  uint32_t startUs = micros();
   
   processingCommand = true;
-  String cmdStr = commandQueue.front();
-  commandQueue.pop();
+  CommandId id = CMD_UNKNOWN;
+  const char* argError = dispatchCommand(boardCommands, cmdStr, cmdLen, id);
   
-  StaticJsonDocument<512> doc;
-  DeserializationError error = deserializeJson(doc, cmdStr);
-
-  if (error) {
-    Serial.print("❌ JSON Parse Error: ");
-    Serial.println(error.c_str());
-    sendErrorResponse("Invalid JSON format");
-    processingCommand = false;
-    return;
-  }
-
-  const char* command = doc["command"];
-  
-  if (strcmp(command, "roll") == 0) {
-    handleRoll(doc);
-  } else if (strcmp(command, "undo") == 0) {
-    handleUndo(doc);
-  } else if (strcmp(command, "reset") == 0) {
-    handleReset();
-  } else if (strcmp(command, "pair") == 0) {
-    handlePair(doc);
-  } else if (strcmp(command, "unpair") == 0) {
-    handleUnpair();
-  } else if (strcmp(command, "config") == 0) {
-    handleConfig(doc);
-  } else if (strcmp(command, "sync_state") == 0) {
-    handleSyncState(doc);
-  } else if (strcmp(command, "update_settings") == 0) {
-    handleUpdateSettings(doc);
-  } else if (strcmp(command, "status") == 0) {
-    sendStatus();
-  } else if (strcmp(command, "victory") == 0) {
-    handleVictory(doc);
-  } else {
-    sendErrorResponse("Unknown command");
+  if (argError != nullptr) {
+    Serial.printf("  ⚠️ %s\n", argError);
+    sendErrorResponse(argError);
   }
+  activeRequest = NO_REQUEST;
   
+  recordCommandStats(id, startUs - enqueuedUs, micros() - startUs);
+  commandRing.pop();
   processingCommand = false;
 }
 
+void recordCommandStats(CommandId id, uint32_t waitUs, uint32_t runUs) {
+  CommandStats &stats = commandStats[id < CMD_COUNT ? id : CMD_COUNT];
+  stats.count++;
+  stats.totalRunUs += runUs;
+  if (runUs > stats.maxRunUs) stats.maxRunUs = runUs;
+  if (waitUs > stats.maxWaitUs) stats.maxWaitUs = waitUs;
+}
+
+// Dispatch queued commands until the budget is spent (always at least one);
+// the rest wait for the next pass so timers and coin checks are not starved
+void drainCommandRing() {
+  uint32_t startUs = micros();
+  while (!commandRing.empty()) {
+    processCommandQueue();
+    if (micros() - startUs >= commandBudgetUs) {
+      if (!commandRing.empty()) commandDrainsCutShort++;
+      break;
+    }
+  }
+}
+
 // ==================== HANDLE PAIRING ====================
-void handlePair(JsonDocument& doc) {
+void handlePair(const PairArgs& args) {
   Serial.println("\n🔐 Processing PAIR command...");
   resetIdleTimer();
   
-  const char* password = doc["password"];
+  const char* password = args.password;
   
   if (!PAIRING_REQUIRED) {
     // Pairing disabled - auto-accept
     isPaired = true;
+    wireVersion = min(args.wireVersion, (uint8_t)WIRE_VERSION);
     sendPairResponse(true, "Pairing not required");
     Serial.println("✓ Pairing not required - auto-paired");
     return;
@@ -901,34 +1299,22 @@ void handlePair(JsonDocument& doc) {
   // Validate against custom board password
   if (strcmp(password, boardPassword.c_str()) == 0) {
     isPaired = true;
-    pairTimeout = 0;
+    wireVersion = min(args.wireVersion, (uint8_t)WIRE_VERSION);
+    timers.cancel(pairTimer);
     Serial.println("✓ Password correct - device paired");
     
     // Visual feedback: Quick green flash on all LEDs
-    for (int i = 0; i < NUM_LEDS; i++) {
-      strip.setPixelColor(i, strip.Color(0, 255, 0));
-    }
-    strip.show();
-    delay(500);
-    strip.clear();
-    strip.show();
+    postRenderEvent(RENDER_EVT_FLASH, -1, 0, 0, strip.Color(0, 255, 0), 500);
     
     // Switch to connected mode (initialization lap)
-    currentConnectionMode = MODE_CONNECTED;
-    connectionLEDStep = 0;
+    enterConnectedMode();
     
     sendPairResponse(true, "Paired successfully");
   } else {
     Serial.println("✗ Incorrect password");
     
     // Visual feedback: Quick red flash on all LEDs
-    for (int i = 0; i < NUM_LEDS; i++) {
-      strip.setPixelColor(i, strip.Color(255, 0, 0));
-    }
-    strip.show();
-    delay(500);
-    strip.clear();
-    strip.show();
+    postRenderEvent(RENDER_EVT_FLASH, -1, 0, 0, strip.Color(255, 0, 0), 500);
     
     sendPairResponse(false, "Incorrect password");
   }
@@ -939,24 +1325,17 @@ void handleUnpair() {
   resetIdleTimer();
   
   isPaired = false;
-  pairTimeout = 0;
+  wireVersion = 0;
+  timers.cancel(pairTimer);
   
   // Visual feedback: Yellow flash
-  for (int i = 0; i < NUM_LEDS; i++) {
-    strip.setPixelColor(i, strip.Color(255, 255, 0));
-  }
-  strip.show();
-  delay(500);
-  strip.clear();
-  strip.show();
+  postRenderEvent(RENDER_EVT_FLASH, -1, 0, 0, strip.Color(255, 255, 0), 500);
   
   StaticJsonDocument<128> response;
   response["event"] = "unpaired";
   response["message"] = "Device unpaired";
   
-  String output;
-  serializeJson(response, output);
-  sendBLEResponse(output);
+  sendBLEJson(response);
   Serial.println("✓ Device unpaired");
 }
 
@@ -967,73 +1346,60 @@ void sendPairResponse(bool success, const char* message) {
   response["boardId"] = BOARD_UNIQUE_ID;
   response["version"] = BOARD_VERSION;
   response["pairingRequired"] = PAIRING_REQUIRED;
+  response["wire"] = success ? wireVersion : WIRE_VERSION;  // Agreed, or what we offer
   
-  String output;
-  serializeJson(response, output);
-  sendBLEResponse(output);
+  sendBLEJson(response);
 }
 
 // ==================== HANDLE CONFIG ====================
-void handleConfig(JsonDocument& doc) {
+void handleConfig(const ConfigArgs& args) {
   Serial.println("\n⚙️ Processing CONFIG command...");
   resetIdleTimer();  // Reset idle timer on activity
   
-  int playerCount = doc["playerCount"];
-  JsonArray colorsArray = doc["colors"];
-  
-  if (playerCount < 2 || playerCount > NUM_PLAYERS) {
-    Serial.printf("  ⚠️ Invalid player count: %d (must be 2-4)\n", playerCount);
-    sendErrorResponse("Invalid player count");
-    return;
-  }
-  
-  activePlayerCount = playerCount;
+  activePlayerCount = args.playerCount;
   Serial.printf("  Active Players: %d\n", activePlayerCount);
   
-  // Update player colors from hex strings
-  for (int i = 0; i < activePlayerCount; i++) {
-    if (i < colorsArray.size()) {
-      const char* colorHex = colorsArray[i];
-      // Convert hex string to uint32_t (format: "RRGGBB")
-      uint32_t hexValue = (uint32_t)strtol(colorHex, NULL, 16);
-      
-      // Extract R, G, B components
-      uint8_t r = (hexValue >> 16) & 0xFF;
-      uint8_t g = (hexValue >> 8) & 0xFF;
-      uint8_t b = hexValue & 0xFF;
-      
-      // Use NeoPixel's Color() function for proper GRB format
-      uint32_t color = strip.Color(r, g, b);
-      players[i].color = color;
-      
-      Serial.printf("  Player %d color: #%s → R=%d G=%d B=%d → 0x%08X\n", 
-                    i, colorHex, r, g, b, color);
-      
-      // Test: Light up player's LED immediately to verify color
-      int testLed = getPlayerLED(1, i);  // Show on tile 1
-      if (testLed >= 0) {
-        strip.setPixelColor(testLed, color);
-        strip.show();
-        delay(300);  // Brief flash to verify
-        Serial.printf("  → Test LED %d lit with configured color\n", testLed);
-      }
+  // Update player colors (0xRRGGBB from the app)
+  for (int i = 0; i < args.colorCount; i++) {
+    uint32_t hexValue = args.colors[i];
+    
+    // Extract R, G, B components
+    uint8_t r = (hexValue >> 16) & 0xFF;
+    uint8_t g = (hexValue >> 8) & 0xFF;
+    uint8_t b = hexValue & 0xFF;
+    
+    // Use NeoPixel's Color() function for proper GRB format
+    uint32_t color = strip.Color(r, g, b);
+    players[i].color = color;
+    
+    Serial.printf("  Player %d color: #%06X → R=%d G=%d B=%d → 0x%08X\n", 
+                  i, hexValue, r, g, b, color);
+    
+    // Test: Light up player's LED immediately to verify color
+    int testLed = getPlayerLED(1, i);  // Show on tile 1
+    if (testLed >= 0) {
+      postRenderEvent(RENDER_EVT_PLAYER_PREVIEW, i, 0, 0, color, 300);  // Brief flash to verify
+      Serial.printf("  → Test LED %d queued with configured color\n", testLed);
     }
   }
   
-  // Check for Hall sensor mode configuration
-  if (doc.containsKey("hallSensorMode")) {
-    HALL_SENSOR_OPERATIONAL = doc["hallSensorMode"];
+  // Hall sensor mode configuration
+  if (args.hasHallSensorMode) {
+    HALL_SENSOR_OPERATIONAL = args.hallSensorMode;
     Serial.printf("  Hall Sensor Mode: %s\n", 
                   HALL_SENSOR_OPERATIONAL ? "ENABLED" : "DISABLED");
   }
   
-  // Check for turn delay configuration (in seconds)
-  if (doc.containsKey("turnDelaySeconds")) {
-    int delaySeconds = doc["turnDelaySeconds"];
-    if (delaySeconds >= 1 && delaySeconds <= 300) {  // 1s to 5 minutes
-      currentTurnDelayMs = delaySeconds * 1000;
-      Serial.printf("  Turn Delay: %d seconds\n", delaySeconds);
-    }
+  // Turn delay configuration (in seconds)
+  if (args.hasTurnDelay) {
+    currentTurnDelayMs = args.turnDelaySeconds * 1000;
+    Serial.printf("  Turn Delay: %d seconds\n", args.turnDelaySeconds);
+  }
+  
+  // Command dispatch budget (microseconds per game pass)
+  if (args.hasCommandBudget) {
+    commandBudgetUs = args.commandBudgetUs;
+    Serial.printf("  Command Budget: %u us\n", commandBudgetUs);
   }
   
   // Turn off LEDs for inactive players
@@ -1048,66 +1414,50 @@ void handleConfig(JsonDocument& doc) {
   response["playerCount"] = activePlayerCount;
   response["hallSensorMode"] = HALL_SENSOR_OPERATIONAL;
   response["turnDelaySeconds"] = currentTurnDelayMs / 1000;
+  response["commandBudgetUs"] = commandBudgetUs;
   
-  String output;
-  serializeJson(response, output);
-  pTxCharacteristic->setValue(output.c_str());
-  pTxCharacteristic->notify();
+  sendBLEJson(response);
   
   Serial.println("✓ Config applied\n");
 }
 
 // ==================== HANDLE STATE SYNC ====================
-void handleSyncState(JsonDocument& doc) {
+void handleSyncState(const SyncStateArgs& args) {
   Serial.println("\n🔄 Processing STATE SYNC command...");
   resetIdleTimer();
   
-  if (!doc.containsKey("gameActive") || !doc["gameActive"]) {
+  if (!args.gameActive) {
     Serial.println("  No active game - skipping state sync");
     return;
   }
   
-  // Sync player count and colors
-  int playerCount = doc["playerCount"];
-  JsonArray colorsArray = doc["colors"];
-  JsonArray positionsArray = doc["positions"];
-  JsonArray scoresArray = doc["scores"];
-  JsonArray aliveArray = doc["alive"];
-  
-  if (playerCount < 2 || playerCount > NUM_PLAYERS) {
-    Serial.printf("  ⚠️ Invalid player count: %d\n", playerCount);
-    return;
-  }
-  
-  activePlayerCount = playerCount;
+  activePlayerCount = args.playerCount;
   Serial.printf("  Active Players: %d\n", activePlayerCount);
   
   // Restore each player's state
   for (int i = 0; i < activePlayerCount; i++) {
     // Update color
-    if (i < colorsArray.size()) {
-      const char* colorHex = colorsArray[i];
-      uint32_t color = (uint32_t)strtol(colorHex, NULL, 16);
-      players[i].color = color;
-      Serial.printf("  Player %d color: #%s\n", i, colorHex);
+    if (i < args.colorCount) {
+      players[i].color = args.colors[i];
+      Serial.printf("  Player %d color: #%06X\n", i, args.colors[i]);
     }
     
     // Update position
-    if (i < positionsArray.size()) {
-      players[i].currentTile = positionsArray[i];
+    if (i < args.positionCount) {
+      players[i].currentTile = args.positions[i];
       Serial.printf("  Player %d position: Tile %d\n", i, players[i].currentTile);
     }
     
     // Update score
-    if (i < scoresArray.size()) {
-      players[i].score = scoresArray[i];
+    if (i < args.scoreCount) {
+      players[i].score = args.scores[i];
       Serial.printf("  Player %d score: %d\n", i, players[i].score);
     }
     
     // Update alive status
-    if (i < aliveArray.size()) {
-      players[i].alive = aliveArray[i];
-      players[i].coinPlaced = aliveArray[i];  // If alive, coin is placed
+    if (i < args.aliveCount) {
+      players[i].alive = args.alive[i];
+      players[i].coinPlaced = args.alive[i];  // If alive, coin is placed
       Serial.printf("  Player %d alive: %s\n", i, players[i].alive ? "Yes" : "No");
     }
   }
@@ -1120,109 +1470,73 @@ void handleSyncState(JsonDocument& doc) {
   
   // Render restored state immediately
   currentConnectionMode = MODE_READY;
-  renderPlayers();
+  timers.cancel(connectedTimer);
+  postRenderEvent(RENDER_EVT_REFRESH);
+  
+  // The app now holds exactly this state: it is the new delta base
+  parkedStateValid = false;
+  commitGameState();
+  stateLog.ack(stateLog.seq());
   
   // Send confirmation
   StaticJsonDocument<256> response;
   response["event"] = "sync_complete";
   response["message"] = "Game state restored";
+  response["seq"] = stateLog.seq();
+  response["checksum"] = stateLog.checksum();
   
-  String output;
-  serializeJson(response, output);
-  pTxCharacteristic->setValue(output.c_str());
-  pTxCharacteristic->notify();
+  sendBLEJson(response);
   
   Serial.println("✓ Game state synchronized\n");
 }
 
 // ==================== HANDLE UPDATE SETTINGS ====================
-void handleUpdateSettings(JsonDocument& doc) {
+void handleUpdateSettings(const UpdateSettingsArgs& args) {
   Serial.println("\n⚙️ Processing UPDATE_SETTINGS command...");
   resetIdleTimer();
   
-  // Security: Only allow settings update when paired
-  if (PAIRING_REQUIRED && !isPaired) {
-    Serial.println("  🔒 SECURITY: Settings update rejected - device not paired");
-    sendErrorResponse("Device not paired - pairing required");
-    return;
+  // Pairing and field lengths were checked before dispatch
+  if (args.password != nullptr) {
+    boardPassword = String(args.password);
+    preferences.putString("password", boardPassword);
+    Serial.printf("  ✓ Password updated: %s\n", boardPassword.c_str());
   }
   
-  bool updated = false;
-  
-  // Update password if provided
-  if (doc.containsKey("password")) {
-    const char* newPassword = doc["password"];
-    if (strlen(newPassword) >= 6) {  // Minimum 6 characters
-      boardPassword = String(newPassword);
-      preferences.putString("password", boardPassword);
-      Serial.printf("  ✓ Password updated: %s\n", boardPassword.c_str());
-      updated = true;
-    } else {
-      Serial.println("  ⚠️ Password too short (min 6 chars)");
-      sendErrorResponse("Password must be at least 6 characters");
-      return;
-    }
+  if (args.nickname != nullptr) {
+    boardNickname = String(args.nickname);
+    preferences.putString("nickname", boardNickname);
+    Serial.printf("  ✓ Nickname updated: %s\n", boardNickname.c_str());
+    // BLE device name is set in setup(), so this applies on next boot
   }
   
-  // Update nickname if provided
-  if (doc.containsKey("nickname")) {
-    const char* newNickname = doc["nickname"];
-    if (strlen(newNickname) > 0 && strlen(newNickname) <= 30) {
-      boardNickname = String(newNickname);
-      preferences.putString("nickname", boardNickname);
-      Serial.printf("  ✓ Nickname updated: %s\n", boardNickname.c_str());
-      
-      // Update BLE device name (requires restart to take effect)
-      // Note: BLE device name is set in setup(), will apply on next boot
-      updated = true;
-    } else {
-      Serial.println("  ⚠️ Invalid nickname (1-30 chars)");
-      sendErrorResponse("Nickname must be 1-30 characters");
-      return;
-    }
-  }
+  // Send confirmation with new settings
+  StaticJsonDocument<512> response;
+  response["event"] = "settings_updated";
+  response["password"] = boardPassword;
+  response["nickname"] = boardNickname;
+  response["restartRequired"] = args.nickname != nullptr;  // Nickname needs restart
   
-  if (updated) {
-    // Send confirmation with new settings
-    StaticJsonDocument<512> response;
-    response["event"] = "settings_updated";
-    response["password"] = boardPassword;
-    response["nickname"] = boardNickname;
-    response["restartRequired"] = doc.containsKey("nickname");  // Nickname needs restart
-    
-    String output;
-    serializeJson(response, output);
-    pTxCharacteristic->setValue(output.c_str());
-    pTxCharacteristic->notify();
-    
-    Serial.println("✓ Settings updated successfully");
-    if (doc.containsKey("nickname")) {
-      Serial.println("  ⚠️ Board restart required for nickname to take effect in BLE advertising");
-    }
-  } else {
-    sendErrorResponse("No valid settings provided");
+  sendBLEJson(response);
+  
+  Serial.println("✓ Settings updated successfully");
+  if (args.nickname != nullptr) {
+    Serial.println("  ⚠️ Board restart required for nickname to take effect in BLE advertising");
   }
   
   Serial.println();
 }
 
 // ==================== HANDLE DICE ROLL ====================
-void handleRoll(JsonDocument& doc) {
+void handleRoll(const RollArgs& args) {
   Serial.println("\n🎲 Processing Dice Roll...");
   resetIdleTimer();  // Reset idle timer on activity
   validateGameState();  // Validate before processing
   
-  // Security check: Require pairing before accepting roll commands
-  if (PAIRING_REQUIRED && !isPaired) {
-    Serial.println("  🔒 SECURITY: Roll rejected - device not paired");
-    sendErrorResponse("Device not paired - pairing required");
-    return;
-  }
-  
-  int playerId = doc["playerId"];
-  int diceValue = doc["diceValue"];
+  // Pairing and value ranges were checked before dispatch
+  int playerId = args.playerId;
+  int diceValue = args.diceValue;
   
-  if (playerId < 0 || playerId >= activePlayerCount) {
+  if (playerId >= activePlayerCount) {
     Serial.printf("  ⚠️ Invalid player ID: %d (active players: %d)\n", playerId, activePlayerCount);
     sendErrorResponse("Invalid player ID");
     return;
@@ -1380,13 +1694,10 @@ void handleRoll(JsonDocument& doc) {
     eliminationEvent["event"] = "player_eliminated";
     eliminationEvent["playerId"] = playerId;
     
-    String eliminationOutput;
-    serializeJson(eliminationEvent, eliminationOutput);
-    pTxCharacteristic->setValue(eliminationOutput.c_str());
-    pTxCharacteristic->notify();
+    sendBLEJson(eliminationEvent);
     
     // Trigger elimination animation
-    animatePlayerElimination(playerId);
+    postRenderEvent(RENDER_EVT_ELIMINATION, playerId, 0, 0, players[playerId].color);
     
     // Check if there's a winner (only 1 player alive)
     int alivePlayers = 0;
@@ -1406,13 +1717,10 @@ void handleRoll(JsonDocument& doc) {
       winnerEvent["event"] = "winner_declared";
       winnerEvent["winnerId"] = lastAliveId;
       
-      String winnerOutput;
-      serializeJson(winnerEvent, winnerOutput);
-      pTxCharacteristic->setValue(winnerOutput.c_str());
-      pTxCharacteristic->notify();
+      sendBLEJson(winnerEvent);
       
       // Trigger winner animation
-      animateWinner(lastAliveId);
+      postRenderEvent(RENDER_EVT_WINNER, lastAliveId, 0, 0, players[lastAliveId].color);
     }
   }
 
@@ -1427,10 +1735,10 @@ void handleRoll(JsonDocument& doc) {
   // Animate movement
   currentPlayer = playerId;
   expectedTile = newTile;
-  animateMove(currentTile, newTile, players[playerId].color, playerId);
+  postRenderEvent(RENDER_EVT_MOVE, playerId, currentTile, newTile, players[playerId].color);
   
   // Restore all player LEDs after animation
-  renderPlayers();
+  postRenderEvent(RENDER_EVT_REFRESH);
 
   const bool skipCoinWait = (!PRODUCTION_MODE && TEST_MODE_1);
 
@@ -1440,7 +1748,7 @@ void handleRoll(JsonDocument& doc) {
     waitingForCoin = false;
     currentPlayer = -1;
     expectedTile = -1;
-    saveGameState();
+    requestSaveGameState();
 
     sendRollResponse(playerId, currentTile, newTile, tile, scoreChange, oldScore, newScore,
                      chanceCardNumber, chanceCardDesc, players[playerId].alive, false);
@@ -1455,7 +1763,8 @@ void handleRoll(JsonDocument& doc) {
     
     waitingForCoin = true;
     coinWaitStartTime = millis();
-    saveGameState();
+    coinWaitRequest = activeRequest;
+    requestSaveGameState();
 
     sendRollResponse(playerId, currentTile, newTile, tile, scoreChange, oldScore, newScore,
                      chanceCardNumber, chanceCardDesc, players[playerId].alive, true);
@@ -1469,7 +1778,8 @@ void handleRoll(JsonDocument& doc) {
     
     waitingForCoin = true;  // Still set flag for timing logic
     coinWaitStartTime = millis();
-    saveGameState();
+    coinWaitRequest = activeRequest;
+    requestSaveGameState();
 
     sendRollResponse(playerId, currentTile, newTile, tile, scoreChange, oldScore, newScore,
                      chanceCardNumber, chanceCardDesc, players[playerId].alive, false);
@@ -1482,6 +1792,27 @@ void handleRoll(JsonDocument& doc) {
 void sendRollResponse(int playerId, int fromTile, int toTile, const TileDefinition& tile,
                       int scoreChange, int oldScore, int newScore, int chanceCard, 
                       const char* chanceDesc, bool alive, bool waitForCoin) {
+  if (wireVersion > 0) {
+    uint8_t buf[WIRE_EVENT_BUF];
+    WireWriter frame(buf, sizeof(buf));
+    frame.begin(WIRE_EVT_ROLL_PROCESSED, wireVersion);
+    frame.putInt(WIRE_TAG_PLAYER_ID, playerId);
+    frame.putInt(WIRE_TAG_FROM, fromTile);
+    frame.putInt(WIRE_TAG_TO, toTile);
+    frame.putInt(WIRE_TAG_TILE_TYPE, tile.type);
+    frame.putInt(WIRE_TAG_SCORE_OLD, oldScore);
+    frame.putInt(WIRE_TAG_SCORE_NEW, newScore);
+    frame.putInt(WIRE_TAG_SCORE_CHANGE, scoreChange);
+    frame.putBool(WIRE_TAG_ALIVE, alive);
+    frame.putBool(WIRE_TAG_WAIT_COIN, waitForCoin);
+    if (tile.type == TYPE_CHANCE && chanceCard > 0) {
+      frame.putInt(WIRE_TAG_CHANCE_CARD, chanceCard);
+      frame.putString(WIRE_TAG_CHANCE_DESC, chanceDesc);
+    }
+    sendBLEFrame(frame);
+    return;
+  }
+  
   StaticJsonDocument<768> doc;
   
   doc["event"] = "roll_processed";
@@ -1512,13 +1843,11 @@ void sendRollResponse(int playerId, int fromTile, int toTile, const TileDefiniti
   doc["waiting"]["tile"] = toTile;
   doc["waiting"]["blinking"] = waitForCoin;
   
-  String response;
-  serializeJson(doc, response);
-  sendBLEResponse(response.c_str());
+  sendBLEJson(doc);
 }
 
 // ==================== HANDLE UNDO ====================
-void handleUndo(JsonDocument& doc) {
+void handleUndo() {
   Serial.println("\n↩️  Processing Undo...");
   
   if (!lastMove.hasUndo) {
@@ -1546,20 +1875,21 @@ void handleUndo(JsonDocument& doc) {
   // Animate reverse movement
   currentPlayer = playerId;
   expectedTile = toTile;
-  animateMove(fromTile, toTile, players[playerId].color, playerId);
+  postRenderEvent(RENDER_EVT_MOVE, playerId, fromTile, toTile, players[playerId].color);
   
   // Restore all player LEDs after animation
-  renderPlayers();
+  postRenderEvent(RENDER_EVT_REFRESH);
   
   // Start waiting for coin at old position
   waitingForCoin = true;
   coinWaitStartTime = millis();
+  coinWaitRequest = activeRequest;
   
   // Clear undo
   lastMove.hasUndo = false;
   
   // Save state
-  saveGameState();
+  requestSaveGameState();
 
   // Send undo response
   sendUndoResponse(playerId, fromTile, toTile, players[playerId].score, players[playerId].alive);
@@ -1569,6 +1899,19 @@ void handleUndo(JsonDocument& doc) {
 
 // ==================== SEND UNDO RESPONSE ====================
 void sendUndoResponse(int playerId, int fromTile, int toTile, int score, bool alive) {
+  if (wireVersion > 0) {
+    uint8_t buf[WIRE_EVENT_BUF];
+    WireWriter frame(buf, sizeof(buf));
+    frame.begin(WIRE_EVT_UNDO_COMPLETE, wireVersion);
+    frame.putInt(WIRE_TAG_PLAYER_ID, playerId);
+    frame.putInt(WIRE_TAG_FROM, fromTile);
+    frame.putInt(WIRE_TAG_TO, toTile);
+    frame.putInt(WIRE_TAG_SCORE, score);
+    frame.putBool(WIRE_TAG_ALIVE, alive);
+    sendBLEFrame(frame);
+    return;
+  }
+  
   StaticJsonDocument<512> doc;
   
   doc["event"] = "undo_complete";
@@ -1585,19 +1928,17 @@ void sendUndoResponse(int playerId, int fromTile, int toTile, int score, bool al
   doc["waiting"]["blinking"] = true;
   doc["waiting"]["message"] = "Place coin at original position";
   
-  String response;
-  serializeJson(doc, response);
-  sendBLEResponse(response.c_str());
+  sendBLEJson(doc);
 }
 
 // ==================== HANDLE VICTORY ====================
-void handleVictory(JsonDocument& doc) {
+void handleVictory(const VictoryArgs& args) {
   Serial.println("\n🏆 Processing Victory Command...");
   resetIdleTimer();
   
-  int winnerId = doc["winnerId"] | 0;
-  const char* winnerColor = doc["winnerColor"];
-  const char* winnerName = doc["winnerName"];
+  int winnerId = args.winnerId;
+  const char* winnerColor = args.winnerColor;
+  const char* winnerName = args.winnerName;
   
   Serial.printf("  Winner ID: %d\n", winnerId);
   Serial.printf("  Winner Color: %s\n", winnerColor ? winnerColor : "default");
@@ -1613,8 +1954,8 @@ void handleVictory(JsonDocument& doc) {
     Serial.printf("  Updated winner color to: 0x%06X\n", players[winnerId].color);
   }
   
-  // Trigger the winner animation
-  animateWinner(winnerId);
+  // Trigger the winner animation (plays on the render core)
+  postRenderEvent(RENDER_EVT_WINNER, winnerId, 0, 0, players[winnerId].color);
   
   // Send victory acknowledgment
   StaticJsonDocument<256> response;
@@ -1623,12 +1964,9 @@ void handleVictory(JsonDocument& doc) {
   response["winnerName"] = winnerName ? winnerName : "Player";
   response["success"] = true;
   
-  String output;
-  serializeJson(response, output);
-  pTxCharacteristic->setValue(output.c_str());
-  pTxCharacteristic->notify();
+  sendBLEJson(response);
   
-  Serial.println("✓ Victory animation complete\n");
+  Serial.println("✓ Victory animation started\n");
 }
 
 // ==================== HANDLE RESET ====================
@@ -1664,15 +2002,11 @@ void handleReset() {
   waitingForCoin = false;
   lastMove.hasUndo = false;
   
-  // Play startup animation (same as first boot)
-  startupAnimation();
-  
-  // Redraw background
-  renderBackground();
-  renderBackground();
+  // Play startup animation (same as first boot), ends on a blank board
+  postRenderEvent(RENDER_EVT_STARTUP);
   
   // Save state
-  saveGameState();
+  requestSaveGameState();
 
   // Send reset response
   sendResetResponse();
@@ -1699,14 +2033,12 @@ void sendResetResponse() {
   doc["board"]["cleared"] = true;
   doc["leds"]["background"] = true;
   
-  String response;
-  serializeJson(doc, response);
-  sendBLEResponse(response.c_str());
+  sendBLEJson(doc);
 }
 
 // ==================== SEND STATUS ====================
 void sendStatus() {
-  StaticJsonDocument<1024> doc;
+  StaticJsonDocument<3072> doc;
   
   doc["event"] = "status_report";
   doc["connected"] = deviceConnected;
@@ -1725,85 +2057,194 @@ void sendStatus() {
     player["coinPlaced"] = players[i].coinPlaced;
   }
   
-  String response;
-  serializeJson(doc, response);
-  sendBLEResponse(response.c_str());
+  doc["wire"] = wireVersion;  // Binary event version in use, 0 = JSON
+  
+  JsonObject state = doc.createNestedObject("state");
+  state["seq"] = stateLog.seq();
+  state["acked"] = stateLog.ackedSeq();
+  state["checksum"] = stateLog.checksum();
+  state["sync"] = stateSyncEnabled;
+  
+  JsonObject link = doc.createNestedObject("link");
+  link["mtu"] = (uint16_t)peerMtu;
+  link["fragmentsSent"] = notifySender.fragmentsSent();
+  link["congestionWaits"] = notifySender.refusals();
+  link["dropped"] = notifyMessagesDropped + notifySender.dropped();
+  link["backlog"] = notifySender.backlogBytes();
+  
+  JsonObject tx = doc.createNestedObject("tx");
+  tx["messages"] = txArena.messages();
+  tx["bytes"] = txArena.bytes();
+  tx["highWater"] = txArena.highWater();
+  tx["capacity"] = txArena.capacity();
+  tx["overflows"] = txArena.overflows();
+  tx["heapAllocs"] = txArena.heapAllocs();  // Game-task allocations while sending (TX_ALLOC_COUNTER builds); 0 expected
+  
+  JsonObject persist = doc.createNestedObject("snapshot");
+  persist["seq"] = snapshotStore.seq();
+  persist["writes"] = snapshotStore.writes();
+  persist["skipped"] = snapshotStore.skipped();  // Unchanged, not written
+  persist["failures"] = snapshotStore.failures();
+  persist["rejected"] = snapshotStore.rejected();  // Slots that failed their CRC at boot
+  
+  JsonObject journalStats = doc.createNestedObject("journal");
+  journalStats["open"] = journal.isOpen();
+  journalStats["sectors"] = journal.sectors();
+  journalStats["head"] = journal.headSector();
+  journalStats["generation"] = journal.headGeneration();
+  journalStats["used"] = journal.headUsed();
+  journalStats["records"] = journal.appended();
+  journalStats["commits"] = journal.commits();
+  journalStats["bytes"] = journal.bytes();
+  journalStats["compactions"] = journal.compactions();
+  journalStats["replayed"] = journal.replayed();  // Records applied at boot
+  journalStats["torn"] = journal.torn();
+  journalStats["failures"] = journal.failures();
+  
+  JsonObject queue = doc.createNestedObject("commandQueue");
+  queue["depth"] = commandRing.size();
+  queue["highWater"] = commandRing.highWater();
+  queue["capacity"] = commandRing.capacity();
+  queue["dropped"] = commandRing.droppedCount();
+  queue["oversize"] = commandRing.oversizeCount();
+  queue["budgetUs"] = commandBudgetUs;
+  queue["cutShort"] = commandDrainsCutShort;
+  
+  JsonArray commandsArray = doc.createNestedArray("commands");
+  for (int i = 0; i < NUM_COMMAND_STATS; i++) {
+    const CommandStats &stats = commandStats[i];
+    if (stats.count == 0) continue;
+    JsonObject cmd = commandsArray.createNestedObject();
+    cmd["name"] = i < CMD_COUNT ? COMMAND_NAMES[i] : "other";
+    cmd["count"] = stats.count;
+    cmd["avgUs"] = (uint32_t)(stats.totalRunUs / stats.count);
+    cmd["maxUs"] = stats.maxRunUs;
+    cmd["maxWaitUs"] = stats.maxWaitUs;
+  }
+  
+  sendBLEJson(doc);
+}
+
+void appendTaskStats(JsonArray &tasksArray, Scheduler &sched, const char* core) {
+  for (int i = 0; i < sched.count(); i++) {
+    const SchedTask &t = sched.task(i);
+    JsonObject task = tasksArray.createNestedObject();
+    task["name"] = t.name;
+    task["core"] = core;
+    task["armed"] = t.armed;
+    task["runs"] = t.stats.runs;
+    task["avgUs"] = t.stats.runs > 0 ? (uint32_t)(t.stats.totalUs / t.stats.runs) : 0;
+    task["maxUs"] = t.stats.maxUs;
+    task["maxLateMs"] = t.stats.maxLateMs;
+  }
+}
+
+// Per-task runtime from the game and render schedulers
+void sendTaskStats(bool reset) {
+  StaticJsonDocument<1536> doc;
+  
+  doc["event"] = "task_stats";
+  doc["uptime"] = millis();
+  doc["renderDropped"] = renderEvents.droppedCount();
+  doc["diceDropped"] = goDiceNotifyQueue.droppedCount() + goDiceOversize;
+  doc["diceLowConfidence"] = diceLowConfidence;
+  JsonObject diceStream = doc.createNestedObject("diceStream");
+  diceStream["messages"] = goDiceDecoder.messageCount();
+  diceStream["malformed"] = goDiceDecoder.malformedBytes();
+  diceStream["badPayloads"] = goDiceDecoder.badPayloadCount();
+  diceStream["stale"] = goDiceDecoder.staleBytes();
+  
+  JsonArray tasksArray = doc.createNestedArray("tasks");
+  appendTaskStats(tasksArray, scheduler, "game");
+  appendTaskStats(tasksArray, renderScheduler, "render");
+  
+  sendBLEJson(doc);
+  
+  if (reset) {
+    scheduler.resetStats();
+    renderScheduler.resetStats();  // Counters only; a racing update just skews one sample
+  }
+}
+
+// Per-stage latency from the loop profiler (cycle counts reported in us)
+void sendProfile(bool reset) {
+  StaticJsonDocument<1536> doc;
+  uint32_t cyclesPerUs = getCpuFrequencyMhz();
+  
+  doc["event"] = "profile";
+  doc["enabled"] = (bool)LOOP_PROFILER;
+  doc["cpuMhz"] = cyclesPerUs;
+  
+  JsonArray stagesArray = doc.createNestedArray("stages");
+  for (int i = 0; i < loopProfiler.count(); i++) {
+    const ProfileStage &s = loopProfiler.stage(i);
+    JsonObject stage = stagesArray.createNestedObject();
+    stage["name"] = s.name;
+    stage["count"] = s.count;
+    stage["p50Us"] = loopProfiler.percentile(i, 500) / cyclesPerUs;
+    stage["p99Us"] = loopProfiler.percentile(i, 990) / cyclesPerUs;
+    stage["maxUs"] = s.maxCycles / cyclesPerUs;
+    stage["avgUs"] = s.count > 0 ? (uint32_t)(s.totalCycles / s.count / cyclesPerUs) : 0;
+  }
+  
+  sendBLEJson(doc);
+  
+  if (reset) {
+    loopProfiler.reset();
+  }
 }
 
 // ==================== COIN DETECTION ====================
+
+// Real board backend for hall_sensors.h: MCP23017 over I2C + direct GPIOs
+class McpHallBus : public HallSensorBus {
+public:
+  bool readExpander(uint16_t &gpioAB) override {
+    // Read GPIOA (0x12) and GPIOB (0x13) back-to-back (IOCON.BANK = 0)
+    Wire.beginTransmission(MCP_ADDR);
+    Wire.write(0x12);
+    if (Wire.endTransmission(false) != 0) return false;  // NACK
+    if (Wire.requestFrom((uint8_t)MCP_ADDR, (uint8_t)2) != 2) return false;
+    uint8_t portA = Wire.read();
+    uint8_t portB = Wire.read();
+    gpioAB = ((uint16_t)portB << 8) | portA;
+    return true;
+  }
+
+  int readDirect(uint8_t pin) override {
+    return digitalRead(pin);
+  }
+
+  void waitMs(uint32_t ms) override {
+    delay(ms);
+  }
+};
+
+McpHallBus hallBus;
+HallDebounceConfig hallDebounce = HALL_DEBOUNCE_DEFAULT;
+HallStats hallStats = {0, 0};
+
 bool isCoinPresent(int tile) {
   if (tile < 1 || tile > NUM_TILES) {
-    Serial.printf("[Hall] Invalid tile: %d\n", tile);
+    BLOG(HALL_INVALID_TILE, tile);
     return false;
   }
   
   // Hall sensor reads LOW when magnet is near (active LOW with pull-up)
   int readings = 0;
-  String sensorType = "";
-  int sensorPin = -1;
-  
-  for (int i = 0; i < 5; i++) {
-    bool detected = false;
-    
-    // Check MCP Port B tiles (1, 20, 19, 18, 16, 14, 17, 15)
-    for (uint8_t j = 0; j < 8; j++) {
-      if (MCP_PORTB_TILES[j] == tile) {
-        bool state = (mcp.digitalRead(j + 8) == LOW);
-        detected = state;
-        sensorType = "MCP_PORTB";
-        sensorPin = j;
-        if (i == 0) {  // Log first reading only
-          Serial.printf("[Hall] Tile %d → MCP PB%d: %s\n", tile, j, state ? "LOW (magnet)" : "HIGH (no magnet)");
-        }
-        break;
-      }
-    }
-    
-    // Check MCP Port A tiles (2, 3, 4, 5, 13, 7, 8, 6)
-    if (!detected && sensorType == "") {
-      for (uint8_t j = 0; j < 8; j++) {
-        if (MCP_PORTA_TILES[j] == tile) {
-          bool state = (mcp.digitalRead(j) == LOW);
-          detected = state;
-          sensorType = "MCP_PORTA";
-          sensorPin = j;
-          if (i == 0) {  // Log first reading only
-            Serial.printf("[Hall] Tile %d → MCP PA%d: %s\n", tile, j, state ? "LOW (magnet)" : "HIGH (no magnet)");
-          }
-          break;
-        }
-      }
-    }
-    
-    // Check direct ESP32 GPIO tiles (9, 10, 11, 12)
-    if (!detected && sensorType == "") {
-      for (uint8_t j = 0; j < 4; j++) {
-        if (DIRECT_GPIO_TILES[j] == tile) {
-          bool state = (digitalRead(DIRECT_GPIO_PINS[j]) == LOW);
-          detected = state;
-          sensorType = "ESP32_GPIO";
-          sensorPin = DIRECT_GPIO_PINS[j];
-          if (i == 0) {  // Log first reading only
-            Serial.printf("[Hall] Tile %d → GPIO%d: %s\n", tile, DIRECT_GPIO_PINS[j], state ? "LOW (magnet)" : "HIGH (no magnet)");
-          }
-          break;
-        }
-      }
-    }
-    
-    if (detected) readings++;
-    delay(2);
-  }
+  bool coinPresent = hallCoinPresent(hallBus, tile, hallDebounce, &readings, &hallStats);
   
-  bool coinPresent = (readings >= 3);
-  Serial.printf("[Hall] Tile %d result: %d/5 readings LOW → %s\n", 
-                tile, readings, coinPresent ? "COIN DETECTED" : "NO COIN");
+  HallTileWiring wiring = hallWiringForTile(tile);
+  BLOG(HALL_RESULT, tile, wiring.source == HALL_SOURCE_MCP ? 'M' : 'G', wiring.pin,
+       readings, hallDebounce.samples, coinPresent);
   
   return coinPresent;
 }
 
 void checkCoinPlacement() {
   if (!waitingForCoin || currentPlayer < 0 || expectedTile < 1) return;
+  PROFILE_SCOPE(loopProfiler, PROF_COIN_CHECK);
+  RequestScope turn(coinWaitRequest);  // Confirms the roll / undo that started the wait
   
   unsigned long elapsed = millis() - coinWaitStartTime;
   
@@ -1818,10 +2259,9 @@ void checkCoinPlacement() {
       waitingForCoin = false;
       
       // Stop blinking, show solid color
-      setTileColor(expectedTile, PLAYER_COLORS[currentPlayer]);
-      strip.show();
+      postRenderEvent(RENDER_EVT_REFRESH);
       
-      saveGameState();
+      requestSaveGameState();
       
       // Send coin placed confirmation
       sendCoinPlacedResponse(currentPlayer, expectedTile, true, "Hall sensor detected magnet");
@@ -1841,10 +2281,9 @@ void checkCoinPlacement() {
       waitingForCoin = false;
       
       // Stop blinking, show solid color
-      setTileColor(expectedTile, PLAYER_COLORS[currentPlayer]);
-      strip.show();
+      postRenderEvent(RENDER_EVT_REFRESH);
       
-      saveGameState();
+      requestSaveGameState();
       
       // Send coin placed confirmation
       sendCoinPlacedResponse(currentPlayer, expectedTile, false, 
@@ -1857,6 +2296,19 @@ void checkCoinPlacement() {
 }
 
 void sendCoinPlacedResponse(int playerId, int tile, bool hallVerified, const char* message) {
+  if (wireVersion > 0) {
+    uint8_t buf[WIRE_EVENT_BUF];
+    WireWriter frame(buf, sizeof(buf));
+    frame.begin(WIRE_EVT_COIN_PLACED, wireVersion);
+    frame.putInt(WIRE_TAG_PLAYER_ID, playerId);
+    frame.putInt(WIRE_TAG_TILE, tile);
+    frame.putBool(WIRE_TAG_VERIFIED, hallVerified);
+    frame.putInt(WIRE_TAG_SCORE, players[playerId].score);
+    frame.putBool(WIRE_TAG_ALIVE, players[playerId].alive);
+    sendBLEFrame(frame);
+    return;
+  }
+  
   StaticJsonDocument<384> doc;
   
   doc["event"] = "coin_placed";
@@ -1869,15 +2321,14 @@ void sendCoinPlacedResponse(int playerId, int tile, bool hallVerified, const cha
   doc["player"]["score"] = players[playerId].score;
   doc["player"]["alive"] = players[playerId].alive;
   
-  String response;
-  serializeJson(doc, response);
-  sendBLEResponse(response.c_str());
+  sendBLEJson(doc);
 }
 
 void checkCoinTimeout() {
   if (!waitingForCoin) return;
   
   if (millis() - coinWaitStartTime > COIN_TIMEOUT) {
+    RequestScope turn(coinWaitRequest);
     Serial.println("\n⏱️  Coin placement timeout!");
     Serial.printf("  Player %d, Tile %d\n", currentPlayer, expectedTile);
     
@@ -1885,7 +2336,7 @@ void checkCoinTimeout() {
     
     sendTimeoutResponse(currentPlayer, expectedTile);
     
-    renderPlayers();
+    postRenderEvent(RENDER_EVT_REFRESH);
     
     currentPlayer = -1;
     expectedTile = -1;
@@ -1893,6 +2344,17 @@ void checkCoinTimeout() {
 }
 
 void sendTimeoutResponse(int playerId, int tile) {
+  if (wireVersion > 0) {
+    uint8_t buf[WIRE_EVENT_BUF];
+    WireWriter frame(buf, sizeof(buf));
+    frame.begin(WIRE_EVT_COIN_TIMEOUT, wireVersion);
+    frame.putInt(WIRE_TAG_PLAYER_ID, playerId);
+    frame.putInt(WIRE_TAG_TILE, tile);
+    frame.putInt(WIRE_TAG_TIMEOUT_S, COIN_TIMEOUT / 1000);
+    sendBLEFrame(frame);
+    return;
+  }
+  
   StaticJsonDocument<256> doc;
   
   doc["event"] = "coin_timeout";
@@ -1901,9 +2363,7 @@ void sendTimeoutResponse(int playerId, int tile) {
   doc["timeout"] = COIN_TIMEOUT / 1000;
   doc["message"] = "Coin placement timed out";
   
-  String response;
-  serializeJson(doc, response);
-  sendBLEResponse(response.c_str());
+  sendBLEJson(doc);
 }
 
 // ==================== MISPLACEMENT DETECTION ====================
@@ -1912,14 +2372,23 @@ void scanAllTiles() {
   if (!PRODUCTION_MODE && TEST_MODE_1) return;
 
   if (waitingForCoin) return;
+  PROFILE_SCOPE(loopProfiler, PROF_TILE_SCAN);
   
   bool foundMisplacement = false;
+  uint32_t warningMask = 0;
+  uint32_t unexpectedMask = 0;
+  uint32_t missingMask = 0;
+  uint8_t missingPlayers[NUM_TILES];
+  uint8_t missingCount = 0;
   StaticJsonDocument<1024> doc;
   doc["event"] = "misplacement_scan";
   JsonArray errors = doc.createNestedArray("errors");
   
+  // One debounced pass over all sensors instead of isCoinPresent() per tile
+  uint32_t coinMask = hallScanTiles(hallBus, hallDebounce, &hallStats);
+  
   for (int tile = 1; tile <= NUM_TILES; tile++) {
-    bool coinPresent = isCoinPresent(tile);
+    bool coinPresent = (coinMask >> (tile - 1)) & 1;
     bool shouldBePresent = false;
     int expectedPlayer = -1;
     
@@ -1939,12 +2408,13 @@ void scanAllTiles() {
       error["tileName"] = BOARD[tile-1].name;
       error["issue"] = "unexpected_coin";
       error["message"] = "Coin found where none should be";
+      unexpectedMask |= 1UL << (tile - 1);
       
       Serial.printf("⚠️  Misplacement: Unexpected coin at Tile %d (%s)\n", 
                     tile, BOARD[tile-1].name);
       
       // Flash red warning
-      setTileColor(tile, 0xFF0000);
+      warningMask |= 1UL << (tile - 1);
     } else if (!coinPresent && shouldBePresent) {
       foundMisplacement = true;
       JsonObject error = errors.createNestedObject();
@@ -1953,24 +2423,33 @@ void scanAllTiles() {
       error["playerId"] = expectedPlayer;
       error["issue"] = "missing_coin";
       error["message"] = "Expected coin not found";
+      missingMask |= 1UL << (tile - 1);
+      missingPlayers[missingCount++] = expectedPlayer;
       
       Serial.printf("⚠️  Misplacement: Missing coin at Tile %d (%s) for Player %d\n", 
                     tile, BOARD[tile-1].name, expectedPlayer);
       
       // Flash red warning
-      setTileColor(tile, 0xFF0000);
+      warningMask |= 1UL << (tile - 1);
     }
   }
   
   if (foundMisplacement) {
-    strip.show();
+    // Red for 500ms, then the renderer restores the normal view
+    postRenderEvent(RENDER_EVT_TILE_WARNING, -1, 0, 0, 0xFF0000, 500, warningMask);
     
-    String response;
-    serializeJson(doc, response);
-    sendBLEResponse(response.c_str());
+    if (wireVersion > 0) {
+      uint8_t buf[WIRE_EVENT_BUF];
+      WireWriter frame(buf, sizeof(buf));
+      frame.begin(WIRE_EVT_MISPLACEMENT_SCAN, wireVersion);
+      frame.putInt(WIRE_TAG_UNEXPECTED_MASK, unexpectedMask);
+      frame.putInt(WIRE_TAG_MISSING_MASK, missingMask);
+      frame.putBytes(WIRE_TAG_MISSING_PLAYERS, missingPlayers, missingCount);
+      sendBLEFrame(frame);
+      return;
+    }
     
-    delay(500);
-    renderPlayers(); // Restore normal view
+    sendBLEJson(doc);
   }
 }
 
@@ -2032,15 +2511,16 @@ void renderBackground() {
   strip.show();
 }
 
+// Draws the render snapshot (render core only)
 void renderPlayers() {
   renderBackground();  // Clear all LEDs first
   
   // Light up ALL active/alive players' LEDs on their current tiles
-  for (int i = 0; i < activePlayerCount; i++) {
-    if (players[i].alive) {
-      int ledIndex = getPlayerLED(players[i].currentTile, i);
+  for (int i = 0; i < renderView.activePlayerCount; i++) {
+    if (renderView.players[i].alive) {
+      int ledIndex = getPlayerLED(renderView.players[i].tile, i);
       if (ledIndex >= 0) {
-        strip.setPixelColor(ledIndex, players[i].color);
+        strip.setPixelColor(ledIndex, renderView.players[i].color);
       }
     }
   }
@@ -2049,11 +2529,9 @@ void renderPlayers() {
 }
 
 // ==================== PLAYER ELIMINATION ANIMATION ====================
-void animatePlayerElimination(int playerId) {
+void animatePlayerElimination(int playerId, uint32_t playerColor) {
   Serial.printf("💀 Animating elimination for Player %d...\n", playerId);
   
-  uint32_t playerColor = players[playerId].color;
-  
   // Blink the player's LED in all 20 tiles (1 LED per tile) 3 times
   for (int blink = 0; blink < 3; blink++) {
     // Turn ON all player LEDs across board
@@ -2090,11 +2568,9 @@ void animatePlayerElimination(int playerId) {
 }
 
 // ==================== WINNER CELEBRATION ANIMATION ====================
-void animateWinner(int winnerId) {
+void animateWinner(int winnerId, uint32_t winnerColor) {
   Serial.printf("🏆 WINNER ANIMATION for Player %d!\n", winnerId);
   
-  uint32_t winnerColor = players[winnerId].color;
-  
   // Phase 1: Flash winner color across entire board (3 times)
   for (int flash = 0; flash < 3; flash++) {
     // All LEDs in winner color
@@ -2198,25 +2674,92 @@ void startupAnimation() {
 
 void sendBLEResponse(const char* json) {
   if (deviceConnected && pTxCharacteristic != nullptr) {
-    pTxCharacteristic->setValue((uint8_t*)json, strlen(json));
-    pTxCharacteristic->notify();
-    Serial.print("📤 Sent: ");
-    Serial.println(json);
+    size_t len = strlen(json);
+    notifyApp((const uint8_t*)json, len);
+    BLOG(APP_SENT, len);
   }
 }
 
-void sendBLEResponse(String json) {
-  sendBLEResponse(json.c_str());
+// Serialized in place in the tx arena: no String, no copy before the stack
+void sendBLEJson(const JsonDocument& doc) {
+  char* buf = txArena.begin();
+  if (buf == nullptr) {
+    Serial.println("❌ Tx arena busy - response dropped");
+    return;
+  }
+  size_t len = serializeJson(doc, buf, txArena.capacity());
+  if (len + 1 < txArena.capacity()) {
+    len = appendRequestId(buf, len, txArena.capacity(), activeRequest);
+  }
+  if (txArena.fits(len)) {
+    sendBLEResponse(buf);
+  } else {
+    notifyMessagesDropped++;
+    Serial.println("❌ Response larger than the tx arena - dropped");
+  }
+  txArena.end();
 }
 
-void sendErrorResponse(const char* message) {
-  StaticJsonDocument<256> doc;
-  doc["event"] = "error";
-  doc["message"] = message;
-  
-  String response;
-  serializeJson(doc, response);
-  sendBLEResponse(response);
+// Offers one notification payload to the app; false if the controller is
+// congested or refuses it
+static bool sendNotifyFragment(const uint8_t* fragment, uint32_t len) {
+  return !linkCongested &&
+         esp_ble_gatts_send_indicate(txGattsIf, txConnId, pTxCharacteristic->getHandle(),
+                                     len, (uint8_t*)fragment, false) == ESP_OK;
+}
+
+// One message to the app, fragmented to the negotiated MTU. Never waits:
+// while the controller reports congestion (or a notify fails) the refused
+// fragment and everything after it wait in notifySender's backlog, and
+// pumpNotifications() resumes from that fragment on a later game-task pass,
+// so nothing is truncated, skipped or reordered.
+// Fragments are sent from the arena with esp_ble_gatts_send_indicate()
+// rather than setValue() + notify(), which would copy each one into the
+// characteristic's std::string value first.
+void notifyApp(const uint8_t* data, size_t len) {
+  if (pTxCccd == nullptr || !pTxCccd->getNotifications()) return;  // App not subscribed
+  uint32_t payload = notifyPayloadSize(peerMtu);
+  if (payload > txArena.fragmentCapacity()) payload = txArena.fragmentCapacity();
+  
+  NotifyResult result = notifySender.send(data, len, payload, notifySeq++, txArena.fragment(), millis(),
+                                          sendNotifyFragment);
+  if (result == NOTIFY_UNFRAMEABLE) {
+    Serial.printf("❌ Message of %u bytes cannot be framed - dropped\n", (unsigned)len);
+  } else if (result == NOTIFY_BACKLOG_FULL) {
+    Serial.println("❌ Link congested and notify backlog full - message dropped");
+  }
+}
+
+// Game task, every pass: send what waited for a congested link
+void pumpNotifications() {
+  if (!deviceConnected) {
+    notifySender.reset();
+    return;
+  }
+  if (!notifySender.idle()) {
+    notifySender.pump(txArena.fragment(), millis(), sendNotifyFragment);
+  }
+}
+
+// Binary event (wire_protocol.h), only sent after it was negotiated
+void sendBLEFrame(WireWriter& frame) {
+  appendRequestId(frame, activeRequest);
+  if (!frame.ok()) {
+    Serial.println("❌ Binary event overflowed its buffer - dropped");
+    return;
+  }
+  if (deviceConnected && pTxCharacteristic != nullptr) {
+    notifyApp(frame.data(), frame.size());
+    BLOG(APP_SENT, frame.size());
+  }
+}
+
+void sendErrorResponse(const char* message) {
+  StaticJsonDocument<256> doc;
+  doc["event"] = "error";
+  doc["message"] = message;
+  
+  sendBLEJson(doc);
 }
 
 const char* getTileTypeName(TileType type) {
@@ -2234,28 +2777,126 @@ const char* getTileTypeName(TileType type) {
 }
 
 // ==================== PERSISTENCE ====================
+// Coalesce bursts (roll + coin + sync) into one journal commit
+void requestSaveGameState() {
+  if (!timers.isPending(saveTimer)) {
+    timers.arm(saveTimer, SAVE_COALESCE_MS);
+  }
+}
+
+void captureGameSnapshot(GameSnapshot& snap) {
+  memset(&snap, 0, sizeof(snap));
+  for (int i = 0; i < NUM_PLAYERS; i++) {
+    snap.players[i].tile = (uint8_t)players[i].currentTile;
+    snap.players[i].score = (int16_t)players[i].score;
+    snap.players[i].flags = (players[i].alive ? SNAPSHOT_ALIVE : 0) |
+                            (players[i].coinPlaced ? SNAPSHOT_COIN : 0);
+  }
+}
+
+void applyGameSnapshot(const GameSnapshot& snap) {
+  for (int i = 0; i < NUM_PLAYERS; i++) {
+    players[i].currentTile = snap.players[i].tile;
+    players[i].score = snap.players[i].score;
+    players[i].alive = (snap.players[i].flags & SNAPSHOT_ALIVE) != 0;
+    players[i].coinPlaced = (snap.players[i].flags & SNAPSHOT_COIN) != 0;
+  }
+}
+
+// saveTimer callback; writes the current state, not the state at request time.
+// Everything changed since the last save goes to the journal as one group.
 void saveGameState() {
+  GameSnapshot snap;
+  captureGameSnapshot(snap);
+  if (journal.isOpen()) {
+    journal.record(snap);
+    if (!journal.commit()) {
+      Serial.println("❌ Journal write failed - records kept for the next save");
+    }
+    return;
+  }
+  if (!snapshotStore.save(snap)) {
+    Serial.println("❌ Game snapshot write failed - previous snapshot kept");
+  }
+}
+
+// Firmware before the snapshot saved one key per field; read them once,
+// with the old clamping, and replace them with a snapshot
+bool migrateLegacyGameState() {
+  if (!preferences.isKey("p0_tile")) return false;
   for (int i = 0; i < NUM_PLAYERS; i++) {
-    String prefix = "p" + String(i) + "_";
-    preferences.putInt((prefix + "tile").c_str(), players[i].currentTile);
-    preferences.putInt((prefix + "score").c_str(), players[i].score);
-    preferences.putBool((prefix + "alive").c_str(), players[i].alive);
-    preferences.putBool((prefix + "coin").c_str(), players[i].coinPlaced);
+    char key[12];
+    snprintf(key, sizeof(key), "p%d_tile", i);
+    players[i].currentTile = preferences.getInt(key, 1);
+    preferences.remove(key);
+    snprintf(key, sizeof(key), "p%d_score", i);
+    players[i].score = preferences.getInt(key, 10);
+    preferences.remove(key);
+    snprintf(key, sizeof(key), "p%d_alive", i);
+    players[i].alive = preferences.getBool(key, true);
+    preferences.remove(key);
+    snprintf(key, sizeof(key), "p%d_coin", i);
+    players[i].coinPlaced = preferences.getBool(key, false);
+    preferences.remove(key);
   }
+  validateGameState();
+  saveGameState();
+  Serial.println("✓ Migrated per-field game state to a snapshot");
+  return true;
 }
 
 void loadGameState() {
   for (int i = 0; i < NUM_PLAYERS; i++) {
-    String prefix = "p" + String(i) + "_";
-    players[i].currentTile = preferences.getInt((prefix + "tile").c_str(), 1);
-    players[i].score = preferences.getInt((prefix + "score").c_str(), 10);
-    players[i].alive = preferences.getBool((prefix + "alive").c_str(), true);
-    players[i].coinPlaced = preferences.getBool((prefix + "coin").c_str(), false);
+    players[i].currentTile = 1;
+    players[i].score = 10;
+    players[i].alive = true;
+    players[i].coinPlaced = false;
     players[i].color = PLAYER_COLORS[i];
   }
   
-  // Validate loaded state
-  validateGameState();
+  // Journal first: base snapshot of the newest sector plus its committed
+  // records, CRC-checked like the NVS snapshot
+  GameSnapshot snap;
+  bool journalReady = journalFlash.find() && journal.begin();
+  if (journalReady) {
+    uint32_t t0 = micros();
+    SnapshotLoadResult result = journal.recover(snap);
+    if (result == SNAPSHOT_LOADED) {
+      applyGameSnapshot(snap);
+      Serial.printf("✓ Game journal replayed: sector %u, %u records (%u torn) in %lu us\n",
+                    journal.headSector(), journal.replayed(), journal.torn(), micros() - t0);
+      return;
+    }
+    if (result == SNAPSHOT_CORRUPT) {
+      Serial.println("⚠️  No journal sector passed its CRC - falling back to NVS");
+    }
+  } else {
+    Serial.println("⚠️  No journal partition - saving snapshots to NVS");
+  }
+
+  // A snapshot that loads passed its CRC: applied as saved, no clamping
+  switch (snapshotStore.load(snap)) {
+    case SNAPSHOT_LOADED:
+      applyGameSnapshot(snap);
+      Serial.printf("✓ Game snapshot #%u loaded (slot %c)\n", snap.seq, snapshotStore.slot() ? 'B' : 'A');
+      break;
+    case SNAPSHOT_CORRUPT:
+      Serial.println("⚠️  No game snapshot passed its CRC - starting fresh");
+      break;
+    case SNAPSHOT_EMPTY:
+      migrateLegacyGameState();
+      break;
+  }
+
+  // Open the journal with whatever NVS held; saves go there from now on
+  if (journalReady) {
+    captureGameSnapshot(snap);
+    if (journal.start(snap)) {
+      Serial.printf("✓ Game journal started (%u sectors)\n", journal.sectors());
+    } else {
+      Serial.println("❌ Journal start failed - saving snapshots to NVS");
+    }
+  }
 }
 
 // ==================== STATE VALIDATION ====================
@@ -2282,6 +2923,19 @@ void validateGameState() {
 // ==================== HEARTBEAT ====================
 void sendHeartbeat() {
   if (!waitingForCoin) return;
+  RequestScope turn(coinWaitRequest);
+  
+  if (wireVersion > 0) {
+    uint8_t buf[WIRE_EVENT_BUF];
+    WireWriter frame(buf, sizeof(buf));
+    frame.begin(WIRE_EVT_HEARTBEAT, wireVersion);
+    frame.putInt(WIRE_TAG_PLAYER_ID, currentPlayer);
+    frame.putInt(WIRE_TAG_TILE, expectedTile);
+    frame.putInt(WIRE_TAG_ELAPSED_S, (millis() - coinWaitStartTime) / 1000);
+    frame.putInt(WIRE_TAG_REMAINING_S, (COIN_TIMEOUT - (millis() - coinWaitStartTime)) / 1000);
+    sendBLEFrame(frame);
+    return;
+  }
   
   StaticJsonDocument<256> doc;
   doc["event"] = "heartbeat";
@@ -2291,49 +2945,526 @@ void sendHeartbeat() {
   doc["waiting"]["elapsed"] = (millis() - coinWaitStartTime) / 1000;
   doc["waiting"]["remaining"] = (COIN_TIMEOUT - (millis() - coinWaitStartTime)) / 1000;
   
-  String json;
-  serializeJson(doc, json);
-  sendBLEResponse(json.c_str());
+  sendBLEJson(doc);
 }
 
 // ==================== ACTIVITY MANAGEMENT ====================
 void resetIdleTimer() {
   lastActivityTime = millis();
-  strip.setBrightness(100);  // Full brightness
+  ledsIdle = false;  // Render core restores full brightness
+  timers.arm(idleTimer, IDLE_TIMEOUT);
 }
 
+// Idle timer callback, re-armed by every resetIdleTimer()
 void checkIdleTimeout() {
-  if (millis() - lastActivityTime > IDLE_TIMEOUT) {
-    // Dim LEDs to 20% brightness when idle
-    strip.setBrightness(20);
-    strip.show();
+  if (millis() - lastActivityTime >= IDLE_TIMEOUT) {
+    // Render core dims LEDs to 20% brightness
+    ledsIdle = true;
   }
 }
 
-// ==================== MAIN LOOP ====================
-void loop() {
-  // Reset watchdog timer
-  esp_task_wdt_reset();
+// ==================== SCHEDULED TASKS ====================
+
+// Hall sensor poll, armed only while waiting for a coin in Hall mode
+void coinCheckTaskFn() {
+  checkCoinPlacement();
+}
+
+// Expected-tile blink; speeds up (and turns red) as the coin timeout nears
+// (render core, armed while the snapshot shows a coin wait)
+void coinBlinkTaskFn() {
+  if (renderView.expectedTile < 1) return;
   
-#if STANDALONE_BOARD
-  // Standalone mode: Handle GoDice connection
-  handleGoDiceConnection();
+  unsigned long elapsed = millis() - renderView.coinWaitStartMs;
+  unsigned long remaining = renderView.coinTimeoutMs - elapsed;
+  unsigned long blinkInterval = BLINK_INTERVAL;
+  uint32_t blinkColor = renderView.coinColor;
   
-  // Update TFT display (touch handling and animations)
-  updateDisplay();
+  // Last 10 seconds: flash faster
+  if (remaining < 10000 && remaining > 5000) {
+    blinkInterval = 250;  // 250ms blink (was 500ms)
+  }
+  // Last 5 seconds: very fast flash with RED warning
+  else if (remaining < 5000) {
+    blinkInterval = 100;  // 100ms blink
+    blinkColor = 0xFF0000;  // RED warning
+  }
+  renderScheduler.setPeriod(coinBlinkTask, blinkInterval);
   
-  // Update connection status LEDs (blue blink until dice connects)
-  if (!goDiceConnected && !waitingForCoin && displayState.currentScreen == SCREEN_DICE_CONNECT) {
+  blinkState = !blinkState;
+  if (blinkState) {
+    setTileColor(renderView.expectedTile, blinkColor);
+  } else {
+    setTileColor(renderView.expectedTile, 0x000000);
+  }
+  strip.show();
+}
+
+void connectionLEDTaskFn() {
+#if STANDALONE_BOARD
+  // Blue blink until dice connects
+  if (!renderView.goDiceConnected && !renderView.waitingForCoin &&
+      displayState.currentScreen == SCREEN_DICE_CONNECT) {
     updateConnectionStatusLEDs();
   }
+#else
+  if (!renderView.waitingForCoin) {
+    updateConnectionStatusLEDs();
+  }
+#endif
+}
+
+#if STANDALONE_BOARD
+// Touch handling and screen animations
+void displayTaskFn() {
+  PROFILE_SCOPE(loopProfiler, PROF_DISPLAY);
+  updateDisplay();
+}
+#endif
+
+// ==================== TIMER CALLBACKS ====================
+
+// Coin timeout; re-arms itself if the wait was restarted after arming
+void onCoinTimeout() {
+  if (!waitingForCoin) return;
   
-  // If dice connected, update display
-  if (goDiceConnected && displayState.currentScreen == SCREEN_DICE_CONNECT) {
-    drawDiceConnectScreen("Connected!", true);
-    delay(1000);
-    changeScreen(SCREEN_GAMEPLAY);
+  unsigned long elapsed = millis() - coinWaitStartTime;
+  if (elapsed <= COIN_TIMEOUT) {
+    timers.arm(coinTimeoutTimer, COIN_TIMEOUT - elapsed + 1);
+    return;
+  }
+  checkCoinTimeout();
+}
+
+// Timer delay mode: auto-confirm the coin once currentTurnDelayMs has passed
+void onTurnDelayElapsed() {
+  if (!waitingForCoin) return;
+  
+  unsigned long elapsed = millis() - coinWaitStartTime;
+  if (elapsed < currentTurnDelayMs) {
+    timers.arm(turnDelayTimer, currentTurnDelayMs - elapsed);
+    return;
+  }
+  checkCoinPlacement();
+}
+
+void onHeartbeat() {
+  sendHeartbeat();
+  if (waitingForCoin) {
+    timers.arm(heartbeatTimer, HEARTBEAT_INTERVAL);
+  }
+}
+
+void onPairTimeout() {
+  if (PAIRING_REQUIRED && !isPaired) {
+    Serial.println("[SECURITY] Pairing timeout - resetting");
+    // Could disconnect here if desired
+  }
+}
+
+// Initialization lap: corner LEDs flash green 3 times, then READY
+void enterConnectedMode() {
+  currentConnectionMode = MODE_CONNECTED;
+  timers.arm(connectedTimer, 6 * CONNECTION_LED_INTERVAL);
+}
+
+void onConnectedAnimationDone() {
+  if (currentConnectionMode == MODE_CONNECTED) {
     currentConnectionMode = MODE_READY;
-    Serial.println("✅ GoDice connected - starting game!");
+  }
+}
+
+// Request game state sync from Android (in case of reconnection during active game)
+// The seq / checksum let an app that still holds this state answer with
+// resync instead of a full sync_state
+void requestStateSync() {
+  if (!deviceConnected) return;
+  StaticJsonDocument<192> doc;
+  doc["event"] = "request_state";
+  doc["message"] = "Requesting game state sync";
+  doc["seq"] = parkedStateValid ? parkedSeq : stateLog.seq();
+  doc["checksum"] = parkedStateValid ? stateChecksum(parkedState) : stateLog.checksum();
+  sendBLEJson(doc);
+  Serial.println("📤 Requesting game state from Android...");
+}
+
+// ==================== STATE LOG SYNC ====================
+
+void captureSyncedState(SyncedState& s) {
+  memset(&s, 0, sizeof(s));
+  s.playerCount = (uint8_t)activePlayerCount;
+  for (int i = 0; i < NUM_PLAYERS; i++) {
+    s.colors[i] = players[i].color & 0xFFFFFF;
+    s.tiles[i] = (uint8_t)players[i].currentTile;
+    s.scores[i] = (int16_t)players[i].score;
+    s.alive[i] = players[i].alive;
+  }
+}
+
+void restoreSyncedState(const SyncedState& s) {
+  activePlayerCount = s.playerCount;
+  for (int i = 0; i < NUM_PLAYERS; i++) {
+    players[i].color = s.colors[i];
+    players[i].currentTile = s.tiles[i];
+    players[i].score = s.scores[i];
+    players[i].alive = s.alive[i];
+    players[i].coinPlaced = i < activePlayerCount && s.alive[i];  // As in sync_state
+  }
+}
+
+// True if the game state changed since the last commit
+bool commitGameState() {
+  SyncedState s;
+  captureSyncedState(s);
+  return stateLog.commit(s);
+}
+
+// Game task, once per pass: log what changed and push it to an app that
+// takes deltas. Held back while a parked state waits for the app's resync.
+void publishStateChanges() {
+  if (!commitGameState()) return;
+  if (stateSyncEnabled && deviceConnected && !parkedStateValid) {
+    sendStateDelta();
+  }
+}
+
+// Everything since the app's last ack, one entry per field; a snapshot when
+// the base fell out of the log or the delta would not be smaller
+void sendStateDelta() {
+  StateChange changes[STATE_DELTA_MAX];
+  int count = stateLog.deltaSince(stateLog.ackedSeq(), changes, STATE_DELTA_MAX);
+  if (count < 0) {
+    sendStateSnapshot();
+    return;
+  }
+  if (count == 0) return;
+  
+  if (wireVersion > 0) {
+    uint8_t buf[128];
+    WireWriter frame(buf, sizeof(buf));
+    frame.begin(WIRE_EVT_STATE_DELTA, wireVersion);
+    frame.putInt(WIRE_TAG_SEQ, (int32_t)stateLog.seq());
+    frame.putInt(WIRE_TAG_BASE_SEQ, (int32_t)stateLog.ackedSeq());
+    frame.putInt(WIRE_TAG_CHECKSUM, (int32_t)stateLog.checksum());
+    for (int i = 0; i < count; i++) {
+      frame.putInt(WIRE_TAG_STATE_FIELD, changes[i].field);
+      frame.putInt(WIRE_TAG_STATE_VALUE, changes[i].value);
+    }
+    if (frame.ok()) {
+      sendBLEFrame(frame);
+      return;
+    }
+  }
+  
+  StaticJsonDocument<640> doc;
+  doc["event"] = "state_delta";
+  doc["seq"] = stateLog.seq();
+  doc["base"] = stateLog.ackedSeq();
+  doc["checksum"] = stateLog.checksum();
+  JsonArray list = doc.createNestedArray("changes");
+  for (int i = 0; i < count; i++) {
+    JsonArray change = list.createNestedArray();
+    change.add(changes[i].field);
+    change.add(changes[i].value);
+  }
+  sendBLEJson(doc);
+}
+
+// Whole mirrored state, in the same shape as the sync_state command
+void sendStateSnapshot() {
+  const SyncedState& s = stateLog.state();
+  StaticJsonDocument<640> doc;
+  doc["event"] = "state_snapshot";
+  doc["seq"] = stateLog.seq();
+  doc["checksum"] = stateLog.checksum();
+  doc["playerCount"] = s.playerCount;
+  JsonArray colors = doc.createNestedArray("colors");
+  JsonArray positions = doc.createNestedArray("positions");
+  JsonArray scores = doc.createNestedArray("scores");
+  JsonArray alive = doc.createNestedArray("alive");
+  for (int i = 0; i < s.playerCount && i < NUM_PLAYERS; i++) {
+    char hex[7];
+    snprintf(hex, sizeof(hex), "%06X", (unsigned)s.colors[i]);
+    colors.add(hex);
+    positions.add(s.tiles[i]);
+    scores.add(s.scores[i]);
+    alive.add(s.alive[i]);
+  }
+  sendBLEJson(doc);
+  Serial.printf("📤 State snapshot sent (seq %u)\n", stateLog.seq());
+}
+
+// ==================== HANDLE STATE ACK / RESYNC ====================
+
+void handleStateAck(const StateAckArgs& args) {
+  stateSyncEnabled = true;
+  uint32_t expected;
+  if (args.hasChecksum && stateLog.checksumAt(args.seq, expected) && expected != args.checksum) {
+    // Same seq, different state: the app diverged, start it over
+    Serial.printf("⚠️ State checksum mismatch at seq %u - sending snapshot\n", args.seq);
+    stateLog.resetAck();
+    sendStateSnapshot();
+    return;
+  }
+  stateLog.ack(args.seq);
+}
+
+void handleResync(const ResyncArgs& args) {
+  Serial.printf("\n🔁 Processing RESYNC from seq %u...\n", args.seq);
+  resetIdleTimer();
+  stateSyncEnabled = true;
+  
+  uint32_t expected;
+  if (!stateLog.checksumAt(args.seq, expected) || expected != args.checksum) {
+    // Unknown or diverged: the app falls back to a full sync_state
+    parkedStateValid = false;
+    stateLog.resetAck();
+    StaticJsonDocument<128> response;
+    response["event"] = "resync_required";
+    response["seq"] = stateLog.seq();
+    sendBLEJson(response);
+    Serial.println("  Seq not in log or checksum differs - full sync required");
+    return;
+  }
+  
+  if (parkedStateValid) {
+    // Undo the connect-time reset
+    restoreSyncedState(parkedState);
+    parkedStateValid = false;
+    currentConnectionMode = MODE_READY;
+    timers.cancel(connectedTimer);
+    timers.cancel(stateRequestTimer);
+    postRenderEvent(RENDER_EVT_REFRESH);
+    requestSaveGameState();
+  }
+  commitGameState();
+  stateLog.ack(args.seq);
+  
+  if (stateLog.checksum() == args.checksum) {
+    stateLog.ack(stateLog.seq());
+    StaticJsonDocument<128> response;
+    response["event"] = "resync_ok";
+    response["seq"] = stateLog.seq();
+    response["checksum"] = stateLog.checksum();
+    sendBLEJson(response);
+    Serial.println("✓ App state matches - full sync skipped\n");
+  } else {
+    sendStateDelta();
+    Serial.println("✓ App state behind - delta sent\n");
+  }
+}
+
+// ==================== RENDER SNAPSHOT / EVENTS ====================
+
+// Game task: publish what the renderer draws. Skipped when nothing changed
+// so the render loop is only woken for real updates.
+void publishRenderSnapshot() {
+  static RenderSnapshot lastPublished;
+  RenderSnapshot snap;
+  memset(&snap, 0, sizeof(snap));  // Padding too, so memcmp below is exact
+  
+  for (int i = 0; i < NUM_PLAYERS; i++) {
+    snap.players[i].tile = players[i].currentTile;
+    snap.players[i].alive = players[i].alive;
+    snap.players[i].coinPlaced = players[i].coinPlaced;
+    snap.players[i].score = players[i].score;
+    snap.players[i].color = players[i].color;
+  }
+  snap.activePlayerCount = activePlayerCount;
+  snap.currentPlayer = currentPlayer;
+  snap.expectedTile = expectedTile;
+  snap.waitingForCoin = waitingForCoin;
+  snap.coinColor = (currentPlayer >= 0 && currentPlayer < NUM_PLAYERS) ? PLAYER_COLORS[currentPlayer] : 0;
+  snap.coinWaitStartMs = coinWaitStartTime;
+  snap.coinTimeoutMs = COIN_TIMEOUT;
+  snap.connectionMode = currentConnectionMode;
+  snap.idle = ledsIdle;
+  snap.goDiceConnected = goDiceConnected;
+  
+  if (memcmp(&snap, &lastPublished, sizeof(snap)) == 0) return;
+  memcpy(&lastPublished, &snap, sizeof(snap));
+  renderSnapshot.publish(snap);
+  wakeRenderLoop();
+}
+
+// Game task: queue an animation / screen change for the render loop. The
+// snapshot is published first so the event never runs against older state.
+void postRenderEvent(uint8_t type, int8_t player, uint8_t from, uint8_t to,
+                     uint32_t color, uint16_t durationMs, uint32_t tileMask) {
+  publishRenderSnapshot();
+  
+  RenderEvent evt = {type, player, from, to, durationMs, color, tileMask};
+  if (!renderEvents.push(evt)) {
+    Serial.printf("⚠️ Render queue full - dropped event %d\n", type);
+  }
+  wakeRenderLoop();
+}
+
+// Render loop: play one queued event
+void playRenderEvent(const RenderEvent &evt) {
+  PROFILE_SCOPE(loopProfiler, PROF_RENDER_EVENT);
+  
+  switch (evt.type) {
+    case RENDER_EVT_REFRESH:
+      renderPlayers();
+      break;
+      
+    case RENDER_EVT_MOVE:
+      animateMove(evt.from, evt.to, evt.color, evt.player);
+      break;
+      
+    case RENDER_EVT_ELIMINATION:
+      animatePlayerElimination(evt.player, evt.color);
+      break;
+      
+    case RENDER_EVT_WINNER:
+      animateWinner(evt.player, evt.color);
+      break;
+      
+    case RENDER_EVT_FLASH:
+      for (int i = 0; i < NUM_LEDS; i++) {
+        strip.setPixelColor(i, evt.color);
+      }
+      strip.show();
+      delay(evt.durationMs);
+      strip.clear();
+      strip.show();
+      break;
+      
+    case RENDER_EVT_TILE_WARNING:
+      for (int tile = 1; tile <= NUM_TILES; tile++) {
+        if ((evt.tileMask >> (tile - 1)) & 1) {
+          setTileColor(tile, evt.color);
+        }
+      }
+      strip.show();
+      delay(evt.durationMs);
+      renderPlayers();  // Restore normal view
+      break;
+      
+    case RENDER_EVT_PLAYER_PREVIEW: {
+      int ledIndex = getPlayerLED(1, evt.player);
+      if (ledIndex >= 0) {
+        strip.setPixelColor(ledIndex, evt.color);
+        strip.show();
+        delay(evt.durationMs);
+      }
+      break;
+    }
+      
+    case RENDER_EVT_STARTUP:
+      startupAnimation();
+      break;
+      
+#if STANDALONE_BOARD
+    case RENDER_EVT_DICE_RESULT:
+      showDiceResult(evt.from);
+      break;
+      
+    case RENDER_EVT_CHANCE_CARD:
+      showChanceCard(evt.from, (ScreenID)evt.to);
+      break;
+      
+    case RENDER_EVT_SCREEN:
+      changeScreen((ScreenID)evt.from);
+      break;
+#endif
+  }
+}
+
+// Render loop: follow snapshot state that has no event of its own
+void applyRenderView() {
+  static bool dimmed = false;
+  static uint8_t lastMode = MODE_DISCONNECTED;
+  
+  if (renderView.idle != dimmed) {
+    dimmed = renderView.idle;
+    strip.setBrightness(dimmed ? 20 : 100);  // Dim LEDs to 20% when idle
+    strip.show();
+  }
+  
+  if (renderView.connectionMode != lastMode) {
+    lastMode = renderView.connectionMode;
+    connectionLEDStep = 0;
+  }
+  
+  if (renderView.waitingForCoin && !renderScheduler.isArmed(coinBlinkTask)) {
+    renderScheduler.runIn(coinBlinkTask, 0);
+  } else if (!renderView.waitingForCoin && renderScheduler.isArmed(coinBlinkTask)) {
+    renderScheduler.cancel(coinBlinkTask);
+  }
+}
+
+void gameTask(void *param);
+
+void initScheduler() {
+  renderTaskHandle = xTaskGetCurrentTaskHandle();
+  
+  // Game task (core 0)
+  coinCheckTask = scheduler.addPeriodic("coin_check", coinCheckTaskFn, COIN_CHECK_INTERVAL, false);
+  scheduler.addPeriodic("tile_scan", scanAllTiles, SCAN_INTERVAL);
+  timers.arm(idleTimer, IDLE_TIMEOUT);
+  
+  // Render loop (core 1)
+  coinBlinkTask = renderScheduler.addPeriodic("coin_blink", coinBlinkTaskFn, BLINK_INTERVAL, false);
+  renderScheduler.addPeriodic("conn_leds", connectionLEDTaskFn, CONNECTION_LED_INTERVAL);
+#if STANDALONE_BOARD
+  renderScheduler.addPeriodic("display", displayTaskFn, FRAME_DELAY_MS);
+#endif
+  
+  Serial.printf("✓ Scheduler: %d game + %d render tasks registered\n",
+                scheduler.count(), renderScheduler.count());
+  
+  publishRenderSnapshot();
+  xTaskCreatePinnedToCore(gameTask, "game", GAME_TASK_STACK, NULL,
+                          GAME_TASK_PRIORITY, &gameTaskHandle, GAME_TASK_CORE);
+  Serial.printf("✓ Game task on core %d, render loop on core %d\n",
+                GAME_TASK_CORE, xPortGetCoreID());
+}
+
+// Arm the coin-wait tasks and timers when a wait starts (or restarts),
+// disarm them when it ends
+void syncCoinWaitTasks() {
+  static bool coinTasksArmed = false;
+  static unsigned long armedWaitStart = 0;
+  
+  if (waitingForCoin && (!coinTasksArmed || coinWaitStartTime != armedWaitStart)) {
+    unsigned long elapsed = millis() - coinWaitStartTime;
+    timers.arm(coinTimeoutTimer, elapsed < COIN_TIMEOUT ? COIN_TIMEOUT - elapsed + 1 : 0);
+    if (HALL_SENSOR_OPERATIONAL) {
+      scheduler.runIn(coinCheckTask, 0);
+    } else {
+      timers.arm(turnDelayTimer, elapsed < currentTurnDelayMs ? currentTurnDelayMs - elapsed : 0);
+    }
+    if (!coinTasksArmed) {
+      timers.arm(heartbeatTimer, HEARTBEAT_INTERVAL);
+    }
+    coinTasksArmed = true;
+    armedWaitStart = coinWaitStartTime;
+  } else if (!waitingForCoin && coinTasksArmed) {
+    scheduler.cancel(coinCheckTask);
+    timers.cancel(coinTimeoutTimer);
+    timers.cancel(turnDelayTimer);
+    timers.cancel(heartbeatTimer);
+    coinTasksArmed = false;
+  }
+}
+
+// ==================== GAME TASK (core 0) ====================
+void gameLoop() {
+  // Reset watchdog timer
+  esp_task_wdt_reset();
+  
+#if STANDALONE_BOARD
+  {
+    PROFILE_SCOPE(loopProfiler, PROF_GODICE);
+    
+    // Standalone mode: Handle GoDice connection
+    handleGoDiceConnection();
+    
+    // Notifications queued by the GoDice notify callback; rolls are
+    // processed as they decode
+    decodeGoDiceNotifications();
   }
 #else
   // Android mode: BLE connection handling
@@ -2341,97 +3472,138 @@ void loop() {
     delay(500);
     pServer->startAdvertising();
     isPaired = false;  // Reset pairing on disconnect
-    pairTimeout = 0;
+    wireVersion = 0;   // Next session starts in JSON
+    stateSyncEnabled = false;
+    stateLog.resetAck();
+    timers.cancel(pairTimer);
+    timers.cancel(connectedTimer);
+    timers.cancel(stateRequestTimer);
+    waitingForCoin = false;
+    expectedTile = -1;
     currentConnectionMode = MODE_DISCONNECTED;
-    connectionLEDStep = 0;
     Serial.println("[BLE] Disconnected - pairing reset");
     oldDeviceConnected = deviceConnected;
   }
   
   if (deviceConnected && !oldDeviceConnected) {
+    // Park the last committed state: an app that resyncs to it gets it back
+    // instead of this reset
+    parkedState = stateLog.state();
+    parkedSeq = stateLog.seq();
+    parkedStateValid = true;
+    
+    // Clear any old game state from previous session
+    for (int i = 0; i < NUM_PLAYERS; i++) {
+      players[i].currentTile = 1;
+      players[i].score = 10;
+      players[i].alive = true;
+      players[i].coinPlaced = false;  // Critical: ensure no ghost coins
+      players[i].color = PLAYER_COLORS[i];
+    }
+    lastMove.hasUndo = false;
+    Serial.println("✓ Game state reset for new session");
+    
+    // Send ready message
+    sendBLEResponse("{\"event\":\"ready\",\"message\":\"ESP32 Test Mode Ready\",\"firmware\":\"v2.0-testmode\",\"wire\":" WIRE_VERSION_STR ",\"frag\":1,\"ids\":1}");
+    timers.arm(stateRequestTimer, STATE_REQUEST_DELAY);
+    
     if (PAIRING_REQUIRED) {
       currentConnectionMode = MODE_PAIRING;
+      timers.arm(pairTimer, PAIR_TIMEOUT_MS);
     } else {
-      currentConnectionMode = MODE_CONNECTED;
+      enterConnectedMode();
     }
-    connectionLEDStep = 0;
     Serial.println("[BLE] Connected - entering pairing/connected mode");
     oldDeviceConnected = deviceConnected;
   }
   
-  // Check pairing timeout
-  if (PAIRING_REQUIRED && !isPaired && pairTimeout > 0) {
-    if (millis() > pairTimeout) {
-      Serial.println("[SECURITY] Pairing timeout - resetting");
-      pairTimeout = 0;
-      // Could disconnect here if desired
-    }
-  }
-  
-  // Process command queue
-  processCommandQueue();
+  // Process queued commands within the per-pass budget
+  drainCommandRing();
+  reportCommandBackpressure();
+#endif
   
-  // Update connection status LEDs if not waiting for coin
-  if (!waitingForCoin) {
-    updateConnectionStatusLEDs();
+  syncCoinWaitTasks();
+  
+  // Fire expired timers and due tasks, then sleep until the next
+  // deadline or a BLE wake-up
+  timers.advance();
+  scheduler.runDue(LOOP_MAX_SLEEP_MS);
+  syncCoinWaitTasks();
+  publishStateChanges();
+  publishRenderSnapshot();
+  pumpNotifications();
+  uint32_t sleepMs = min(scheduler.msUntilNext(LOOP_MAX_SLEEP_MS),
+                         timers.msUntilNext(LOOP_MAX_SLEEP_MS));
+  if (!notifySender.idle()) {
+    sleepMs = min(sleepMs, (uint32_t)NOTIFY_RETRY_MS);  // Or sooner, when congestion clears
+  }
+  if (sleepMs > 0 && commandRing.empty()) {
+    drainBinlog();
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleepMs));
   }
+}
+
+// Game task, idle time only: write queued log records, stopping as soon as
+// the next line would not fit in the Serial TX buffer
+void drainBinlog() {
+  uint32_t dropped = binlog.takeDropped();
+  if (dropped > 0) BLOG(BINLOG_DROPPED, dropped);
+  
+  char line[128];
+  LogRecord rec;
+  for (int i = 0; i < BINLOG_DRAIN_MAX; i++) {
+    if (Serial.availableForWrite() < (int)sizeof(line)) return;
+    if (!binlog.pop(rec)) return;
+#if BINLOG_TEXT
+    int n = snprintf(line, sizeof(line), "[%lu.%03lu] ", (unsigned long)(rec.timestampUs / 1000000),
+                     (unsigned long)(rec.timestampUs / 1000 % 1000));
+    formatLogRecord(rec, line + n, sizeof(line) - n);
+#else
+    encodeLogLine(rec, line, sizeof(line));
 #endif
-  
-  // Enhanced blinking animation with timeout warnings
-  if (waitingForCoin && expectedTile >= 1) {
-    unsigned long elapsed = millis() - coinWaitStartTime;
-    unsigned long remaining = COIN_TIMEOUT - elapsed;
-    unsigned long blinkInterval = BLINK_INTERVAL;
-    uint32_t blinkColor = PLAYER_COLORS[currentPlayer];
-    
-    // Last 10 seconds: flash faster
-    if (remaining < 10000 && remaining > 5000) {
-      blinkInterval = 250;  // 250ms blink (was 500ms)
-    }
-    // Last 5 seconds: very fast flash with RED warning
-    else if (remaining < 5000) {
-      blinkInterval = 100;  // 100ms blink
-      blinkColor = 0xFF0000;  // RED warning
-    }
-    
-    if (millis() - lastBlinkTime > blinkInterval) {
-      blinkState = !blinkState;
-      lastBlinkTime = millis();
-      
-      if (blinkState) {
-        setTileColor(expectedTile, blinkColor);
-      } else {
-        setTileColor(expectedTile, 0x000000);
-      }
-      strip.show();
-    }
+    Serial.println(line);
   }
-  
-  // Check for coin placement
-  checkCoinPlacement();
-  
-  // Check for timeout
-  checkCoinTimeout();
-  
-  // Send heartbeat every 5 seconds when waiting
-  if (waitingForCoin && millis() - lastHeartbeatTime > HEARTBEAT_INTERVAL) {
-    sendHeartbeat();
-    lastHeartbeatTime = millis();
+}
+
+void gameTask(void *param) {
+  esp_task_wdt_add(NULL);
+  for (;;) {
+    gameLoop();
   }
+}
+
+// ==================== RENDER LOOP (core 1) ====================
+void loop() {
+  // Reset watchdog timer
+  esp_task_wdt_reset();
   
-  // Periodic misplacement scan
-  if (millis() - lastScanTime > SCAN_INTERVAL) {
-    scanAllTiles();
-    lastScanTime = millis();
+  // Play queued animations, each against the latest snapshot
+  RenderEvent evt;
+  while (renderEvents.pop(evt)) {
+    renderSnapshot.read(renderView);
+    playRenderEvent(evt);
+    esp_task_wdt_reset();
   }
-  
-  // Check idle timeout for power saving
-  checkIdleTimeout();
+  renderSnapshot.read(renderView);
+  applyRenderView();
   
 #if STANDALONE_BOARD
-  // Small delay to prevent display flicker
-  delay(5);
-#else
-  delay(10);
+  // If dice connected, update display
+  if (renderView.goDiceConnected && displayState.currentScreen == SCREEN_DICE_CONNECT) {
+    drawDiceConnectScreen("Connected!", true);
+    delay(1000);
+    changeScreen(SCREEN_GAMEPLAY);
+    Serial.println("✅ GoDice connected - starting game!");
+  }
 #endif
+  
+  // Chance card dismiss, blink / connection LEDs, touch; sleep until the
+  // next frame or a wake-up from the game task
+  renderTimers.advance();
+  renderScheduler.runDue(LOOP_MAX_SLEEP_MS);
+  uint32_t sleepMs = min(renderScheduler.msUntilNext(LOOP_MAX_SLEEP_MS),
+                         renderTimers.msUntilNext(LOOP_MAX_SLEEP_MS));
+  if (sleepMs > 0 && renderEvents.empty()) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sleepMs));
+  }
 }
@@ -0,0 +1,225 @@
+/*
+ * Last Drop - Sequenced Game State Log
+ *
+ * Tracks the part of the game state the app mirrors (the same fields as the
+ * sync_state command) as a log of field-level changes. Every commit() that
+ * changes something gets the next sequence number, so the board can send
+ * just the fields changed since the last sequence the app acknowledged, and
+ * a reconnecting app can say "I have seq N, checksum C" instead of
+ * re-sending everything.
+ *
+ * A field is (kind << 2) | player. deltaSince() coalesces the log into at
+ * most one change per field and returns -1 when the base has fallen out of
+ * the log (or is unknown); the caller then sends a full snapshot instead.
+ *
+ * stateChecksum() is FNV-1a over a canonical encoding of the active players
+ * (see the function), cheap enough for both sides to run after every change.
+ */
+
+#ifndef STATE_LOG_H
+#define STATE_LOG_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define STATE_MAX_PLAYERS 4
+#define STATE_FIELD_COUNT (1 + 4 * STATE_MAX_PLAYERS)  // Player count + 4 kinds per player
+
+struct SyncedState {
+  uint8_t playerCount;
+  uint32_t colors[STATE_MAX_PLAYERS];  // 0xRRGGBB
+  uint8_t tiles[STATE_MAX_PLAYERS];
+  int16_t scores[STATE_MAX_PLAYERS];
+  bool alive[STATE_MAX_PLAYERS];
+};
+
+enum StateFieldKind : uint8_t {
+  SF_PLAYER_COUNT = 0,
+  SF_COLOR,
+  SF_TILE,
+  SF_SCORE,
+  SF_ALIVE
+};
+
+struct StateChange {
+  uint8_t field;
+  int32_t value;
+};
+
+inline uint8_t stateField(uint8_t kind, uint8_t player) {
+  return (uint8_t)((kind << 2) | (player & 3));
+}
+
+// The STATE_FIELD_COUNT valid field ids, in a fixed order
+inline uint8_t stateFieldAt(int i) {
+  if (i == 0) return stateField(SF_PLAYER_COUNT, 0);
+  i--;
+  return stateField((uint8_t)(SF_COLOR + i / STATE_MAX_PLAYERS), (uint8_t)(i % STATE_MAX_PLAYERS));
+}
+
+inline int32_t getStateField(const SyncedState &s, uint8_t field) {
+  uint8_t p = field & 3;
+  switch (field >> 2) {
+    case SF_PLAYER_COUNT: return s.playerCount;
+    case SF_COLOR: return (int32_t)s.colors[p];
+    case SF_TILE: return s.tiles[p];
+    case SF_SCORE: return s.scores[p];
+    case SF_ALIVE: return s.alive[p] ? 1 : 0;
+  }
+  return 0;
+}
+
+// False for an unknown field id
+inline bool setStateField(SyncedState &s, uint8_t field, int32_t value) {
+  uint8_t p = field & 3;
+  switch (field >> 2) {
+    case SF_PLAYER_COUNT:
+      if (p != 0) return false;
+      s.playerCount = (uint8_t)value;
+      return true;
+    case SF_COLOR: s.colors[p] = (uint32_t)value & 0xFFFFFF; return true;
+    case SF_TILE: s.tiles[p] = (uint8_t)value; return true;
+    case SF_SCORE: s.scores[p] = (int16_t)value; return true;
+    case SF_ALIVE: s.alive[p] = value != 0; return true;
+  }
+  return false;
+}
+
+// FNV-1a over: playerCount, then per active player color (3 bytes, R G B),
+// tile, score (int16 little-endian), alive (0/1)
+inline uint32_t stateChecksum(const SyncedState &s) {
+  uint32_t h = 2166136261u;
+  uint8_t bytes[7];
+  h = (h ^ s.playerCount) * 16777619u;
+  int count = s.playerCount < STATE_MAX_PLAYERS ? s.playerCount : STATE_MAX_PLAYERS;
+  for (int p = 0; p < count; p++) {
+    bytes[0] = (uint8_t)(s.colors[p] >> 16);
+    bytes[1] = (uint8_t)(s.colors[p] >> 8);
+    bytes[2] = (uint8_t)s.colors[p];
+    bytes[3] = s.tiles[p];
+    bytes[4] = (uint8_t)((uint16_t)s.scores[p] & 0xFF);
+    bytes[5] = (uint8_t)((uint16_t)s.scores[p] >> 8);
+    bytes[6] = s.alive[p] ? 1 : 0;
+    for (int i = 0; i < 7; i++) {
+      h = (h ^ bytes[i]) * 16777619u;
+    }
+  }
+  return h;
+}
+
+// ENTRIES field changes and COMMITS (seq, checksum) records are kept; both
+// must be powers of two
+template <uint32_t ENTRIES, uint32_t COMMITS>
+class StateLog {
+  static_assert(ENTRIES > 0 && (ENTRIES & (ENTRIES - 1)) == 0, "StateLog entries must be a power of two");
+  static_assert(COMMITS > 0 && (COMMITS & (COMMITS - 1)) == 0, "StateLog commits must be a power of two");
+
+public:
+  StateLog() : currentSeq(0), floorSeq(0), acked(0), entryCount(0), commitCount(0) {
+    memset(&current, 0, sizeof(current));
+    currentSum = stateChecksum(current);
+    recordCommit();
+  }
+
+  // Log every field that differs from the last commit; true if any did
+  bool commit(const SyncedState &s) {
+    bool changed = false;
+    for (int i = 0; i < STATE_FIELD_COUNT; i++) {
+      uint8_t field = stateFieldAt(i);
+      int32_t value = getStateField(s, field);
+      if (value == getStateField(current, field)) continue;
+      if (!changed) currentSeq++;
+      changed = true;
+      setStateField(current, field, value);
+      Entry &e = entries[entryCount & (ENTRIES - 1)];
+      if (entryCount >= ENTRIES && e.seq > floorSeq) floorSeq = e.seq;  // Overwritten
+      e.seq = currentSeq;
+      e.change.field = field;
+      e.change.value = value;
+      entryCount++;
+    }
+    if (changed) {
+      currentSum = stateChecksum(current);
+      recordCommit();
+    }
+    return changed;
+  }
+
+  // Changes that bring a peer at `base` up to seq(), one per field, or -1
+  // if base is not in the log or more than max fields changed
+  int deltaSince(uint32_t base, StateChange *out, int max) const {
+    if (base > currentSeq || base < floorSeq) return -1;
+    int n = 0;
+    uint32_t first = entryCount > ENTRIES ? entryCount - ENTRIES : 0;
+    for (uint32_t i = first; i < entryCount; i++) {
+      const Entry &e = entries[i & (ENTRIES - 1)];
+      if (e.seq <= base) continue;
+      int j = 0;
+      while (j < n && out[j].field != e.change.field) j++;
+      if (j == n) {
+        if (n >= max) return -1;
+        n++;
+      }
+      out[j] = e.change;  // Later entries overwrite earlier ones
+    }
+    return n;
+  }
+
+  // Checksum of the state at an earlier seq, if it is still recorded
+  bool checksumAt(uint32_t seq, uint32_t &sum) const {
+    uint32_t first = commitCount > COMMITS ? commitCount - COMMITS : 0;
+    for (uint32_t i = first; i < commitCount; i++) {
+      const Commit &c = commits[i & (COMMITS - 1)];
+      if (c.seq == seq) {
+        sum = c.checksum;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // The peer has everything up to seq (ignored if it goes backwards or
+  // claims a future seq)
+  void ack(uint32_t seq) {
+    if (seq <= currentSeq && seq >= acked) acked = seq;
+  }
+
+  // Forget the peer's position, e.g. for a new session
+  void resetAck() { acked = 0; }
+
+  uint32_t seq() const { return currentSeq; }
+  uint32_t ackedSeq() const { return acked; }
+  uint32_t checksum() const { return currentSum; }
+  uint32_t oldestBase() const { return floorSeq; }
+  const SyncedState &state() const { return current; }
+
+private:
+  struct Entry {
+    uint32_t seq;
+    StateChange change;
+  };
+
+  struct Commit {
+    uint32_t seq;
+    uint32_t checksum;
+  };
+
+  SyncedState current;
+  uint32_t currentSum;
+  uint32_t currentSeq;
+  uint32_t floorSeq;  // Oldest base deltaSince() can still serve
+  uint32_t acked;
+  Entry entries[ENTRIES];
+  uint32_t entryCount;
+  Commit commits[COMMITS];
+  uint32_t commitCount;
+
+  void recordCommit() {
+    Commit &c = commits[commitCount & (COMMITS - 1)];
+    c.seq = currentSeq;
+    c.checksum = currentSum;
+    commitCount++;
+  }
+};
+
+#endif // STATE_LOG_H
@@ -0,0 +1,113 @@
+/*
+ * Command path throughput benchmark on the host board (command_host.h):
+ * BLE write into the ring, dispatchCommand(), handler, response through the
+ * tx arena and fragmenter into the mock characteristic.
+ *
+ * Binary commands in a session-weighted mix (mostly roll and status) are
+ * written in bursts of a ring's worth and drained, at a few MTUs. Reports
+ * commands/sec, p50 / p99 latency of one dispatch (ring front to pop), and
+ * notifications and bytes out per command. Host numbers only rank changes;
+ * the ESP32 is slower in absolute terms.
+ *
+ * JSON commands are measured only when ArduinoJson is installed.
+ *
+ * Usage: bench_commands [commands]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "command_host.h"
+
+typedef std::chrono::steady_clock Clock;
+
+struct Command {
+  uint8_t bytes[64];
+  uint32_t len;
+};
+
+static Command makeCommand(CommandId id, std::mt19937 &rng) {
+  Command c;
+  WireWriter frame(c.bytes, sizeof(c.bytes));
+  frame.begin(id);
+  if (id == CMD_ROLL) {
+    frame.putInt(WIRE_TAG_PLAYER_ID, (int32_t)(rng() % NUM_PLAYERS));
+    frame.putInt(WIRE_TAG_DICE_VALUE, (int32_t)(1 + rng() % 6));
+  } else if (id == CMD_STATE_ACK) {
+    frame.putInt(WIRE_TAG_SEQ, (int32_t)(rng() % 100));
+  }
+  c.len = frame.size();
+  return c;
+}
+
+static std::vector<Command> sessionMix(int count, bool binaryReplies) {
+  static const struct {
+    CommandId id;
+    int weight;
+  } MIX[] = {
+    {CMD_ROLL, 50}, {CMD_STATUS, 20}, {CMD_STATE_ACK, 15}, {CMD_UNDO, 5},
+    {CMD_PROFILE, 5}, {CMD_TASK_STATS, 5}
+  };
+  std::vector<CommandId> ids;
+  for (const auto &m : MIX) {
+    for (int i = 0; i < m.weight; i++) ids.push_back(m.id);
+  }
+  std::mt19937 rng(binaryReplies ? 7 : 8);
+  std::vector<Command> commands;
+  for (int i = 0; i < count; i++) commands.push_back(makeCommand(ids[rng() % ids.size()], rng));
+  return commands;
+}
+
+static void run(const std::vector<Command> &commands, uint16_t mtu, bool binaryReplies) {
+  HostBoard board;
+  board.mtu = mtu;
+  board.pairingRequired = false;
+  board.wireVersion = binaryReplies ? WIRE_VERSION : 0;
+  board.characteristic.keep = false;
+
+  std::vector<double> latencyNs;
+  latencyNs.reserve(commands.size());
+  auto start = Clock::now();
+  size_t next = 0;
+  while (next < commands.size()) {
+    while (next < commands.size() &&
+           board.write(commands[next].bytes, commands[next].len) == CMD_PUSH_OK) {
+      next++;
+    }
+    uint32_t len = 0;
+    char *cmd;
+    while ((cmd = board.ring.front(len)) != nullptr) {
+      auto t0 = Clock::now();
+      CommandId id = CMD_UNKNOWN;
+      const char *error = dispatchCommand(board, cmd, len, id);
+      if (error != nullptr) board.sendError(error);
+      board.ring.pop();
+      latencyNs.push_back(std::chrono::duration<double, std::nano>(Clock::now() - t0).count());
+    }
+  }
+  double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  std::sort(latencyNs.begin(), latencyNs.end());
+  double n = (double)commands.size();
+  printf("  mtu %3u %-6s  %9.0f cmd/s   p50 %6.0f ns   p99 %6.0f ns   %5.2f notifies/cmd   %6.1f bytes/cmd%s\n",
+         mtu, binaryReplies ? "binary" : "json", n / seconds,
+         latencyNs[latencyNs.size() / 2], latencyNs[latencyNs.size() * 99 / 100],
+         board.characteristic.notifyCount / n, board.characteristic.byteCount / n,
+         board.errorsSent ? "  (errors!)" : "");
+}
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? atoi(argv[1]) : 200000;
+  if (count <= 0) count = 1;
+
+  printf("Command path, %d binary commands per run, ring %u x %u bytes\n", count, HOST_RING_SLOTS, HOST_SLOT_SIZE);
+  const uint16_t mtus[] = {23, 185, 517};
+  for (int binaryReplies = 0; binaryReplies < 2; binaryReplies++) {
+    std::vector<Command> commands = sessionMix(count, binaryReplies != 0);
+    for (uint16_t mtu : mtus) run(commands, mtu, binaryReplies != 0);
+  }
+  return 0;
+}
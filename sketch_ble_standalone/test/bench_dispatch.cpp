@@ -0,0 +1,97 @@
+/*
+ * Command name dispatch benchmark: the old strcmp chain against
+ * lookupCommand() from command_table.h.
+ *
+ * Names are drawn from a mix weighted like a game session (mostly roll and
+ * status, some config / sync, a few unknown names) and looked up in random
+ * order. Reports ns per lookup for each scheme and the worst single name.
+ *
+ * JSON parsing itself is not covered: ArduinoJson is not part of this tree.
+ *
+ * Usage: bench_dispatch [iterations]
+ */
+
+#include "command_table.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Dispatch order of the strcmp chain this replaced
+static CommandId strcmpChain(const char *command) {
+  if (strcmp(command, "roll") == 0) return CMD_ROLL;
+  if (strcmp(command, "undo") == 0) return CMD_UNDO;
+  if (strcmp(command, "reset") == 0) return CMD_RESET;
+  if (strcmp(command, "pair") == 0) return CMD_PAIR;
+  if (strcmp(command, "unpair") == 0) return CMD_UNPAIR;
+  if (strcmp(command, "config") == 0) return CMD_CONFIG;
+  if (strcmp(command, "sync_state") == 0) return CMD_SYNC_STATE;
+  if (strcmp(command, "update_settings") == 0) return CMD_UPDATE_SETTINGS;
+  if (strcmp(command, "status") == 0) return CMD_STATUS;
+  if (strcmp(command, "task_stats") == 0) return CMD_TASK_STATS;
+  if (strcmp(command, "profile") == 0) return CMD_PROFILE;
+  if (strcmp(command, "victory") == 0) return CMD_VICTORY;
+  return CMD_UNKNOWN;
+}
+
+struct WeightedName {
+  const char *name;
+  int weight;
+};
+
+static const WeightedName MIX[] = {
+  {"roll", 40}, {"status", 20}, {"undo", 5}, {"config", 5}, {"sync_state", 5},
+  {"pair", 3}, {"reset", 3}, {"victory", 2}, {"task_stats", 2}, {"profile", 2},
+  {"update_settings", 2}, {"unpair", 1}, {"bogus", 1}, {"rolls", 1}
+};
+
+typedef CommandId (*LookupFn)(const char *);
+
+static volatile uint32_t sink;
+
+static double nsPerLookup(LookupFn fn, const std::vector<const char *> &names, int iterations) {
+  uint32_t acc = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int it = 0; it < iterations; it++) {
+    for (const char *name : names) {
+      acc += fn(name);
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  sink = acc;
+  double ns = std::chrono::duration<double, std::nano>(end - start).count();
+  return ns / ((double)iterations * names.size());
+}
+
+int main(int argc, char **argv) {
+  int iterations = argc > 1 ? atoi(argv[1]) : 2000;
+
+  std::vector<const char *> names;
+  for (const WeightedName &w : MIX) {
+    for (int i = 0; i < w.weight; i++) names.push_back(w.name);
+  }
+  std::mt19937 rng(42);
+  std::shuffle(names.begin(), names.end(), rng);
+
+  for (const char *name : names) {
+    if (strcmpChain(name) != lookupCommand(name)) {
+      printf("MISMATCH for %s\n", name);
+      return 1;
+    }
+  }
+
+  printf("Command dispatch, %zu names per pass, %d passes (seed %u, %d slots)\n",
+         names.size(), iterations, COMMAND_HASH_SEED, COMMAND_HASH_SLOTS);
+  printf("  session mix    strcmp chain %6.2f ns   perfect hash %6.2f ns\n",
+         nsPerLookup(strcmpChain, names, iterations), nsPerLookup(lookupCommand, names, iterations));
+
+  // Per name: the chain degrades with position, the hash should not
+  for (const WeightedName &w : MIX) {
+    std::vector<const char *> one(64, w.name);
+    printf("  %-16s strcmp chain %6.2f ns   perfect hash %6.2f ns\n", w.name,
+           nsPerLookup(strcmpChain, one, iterations), nsPerLookup(lookupCommand, one, iterations));
+  }
+  return 0;
+}
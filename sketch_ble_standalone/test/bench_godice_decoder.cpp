@@ -0,0 +1,166 @@
+/*
+ * GoDice decode benchmark for GoDice.h, the one decode path every sketch
+ * uses, so its cost is measured here once.
+ *
+ * A game session's notifications (mostly rolls and stables, a few tilts,
+ * taps and status replies) are decoded as the die sends them one per
+ * notification, packed into 20-byte notifications, and split at random
+ * points, through decode() and, as a queue drains them, decodeBatch().
+ * Reports ns per message for each shape against calling
+ * godice_incoming_packet() and godice_incoming_packets() directly on
+ * pre-framed messages, which is the floor: the difference is framing and
+ * carrying split messages.
+ *
+ * Usage: bench_godice_decoder [iterations]
+ */
+
+#include "GoDice.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+struct WeightedMessage {
+  std::vector<uint8_t> bytes;
+  int weight;
+};
+
+static const std::vector<WeightedMessage> MIX = {
+  {{'R'}, 40},
+  {{'S', 0, 0, 64}, 12},
+  {{'S', (uint8_t)-62, 4, 9}, 12},
+  {{'T', 'S', 40, 40, 20}, 3},
+  {{'M', 'S', 0, 60, 10}, 2},
+  {{'F', 'S', 2, (uint8_t)-63, 0}, 1},
+  {{'T', 'a', 'p'}, 2},
+  {{'B', 'a', 't', 80}, 1},
+  {{'C', 'o', 'l', 3}, 1},
+  {{'C', 'h', 'a', 'r', 0}, 1},
+};
+
+typedef std::vector<std::vector<uint8_t>> Notifications;
+
+static volatile uint32_t sink;
+
+static void onRoll(void *userdata, int) { (*(uint32_t *)userdata)++; }
+static void onStable(void *userdata, int, const godice_stable_info_t *info) { *(uint32_t *)userdata += info->number; }
+static void onLevel(void *userdata, int, uint8_t level) { *(uint32_t *)userdata += level; }
+static void onCharging(void *userdata, int, bool charging) { *(uint32_t *)userdata += charging; }
+static void onColor(void *userdata, int, godice_color_t color) { *(uint32_t *)userdata += color; }
+
+static double nsDirect(const Notifications &messages, int iterations) {
+  godice_callbacks_t cb = {onColor, nullptr, onCharging, onLevel, onRoll, onStable};
+  uint32_t acc = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int it = 0; it < iterations; it++) {
+    for (const auto &m : messages) {
+      godice_incoming_packet(&cb, &acc, 0, 6, m.data(), m.size());
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  sink = acc;
+  return std::chrono::duration<double, std::nano>(end - start).count() / ((double)iterations * messages.size());
+}
+
+static double nsDirectBatch(const Notifications &messages, int iterations) {
+  std::vector<godice_packet_t> packets;
+  for (const auto &m : messages) packets.push_back({0, 6, m.data(), m.size()});
+  std::vector<godice_event_t> events(packets.size());
+  uint32_t acc = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int it = 0; it < iterations; it++) {
+    size_t n = godice_incoming_packets(packets.data(), packets.size(), events.data(), events.size(), nullptr);
+    for (size_t i = 0; i < n; i++) acc += events[i].value + events[i].type;
+  }
+  auto end = std::chrono::steady_clock::now();
+  sink = acc;
+  return std::chrono::duration<double, std::nano>(end - start).count() / ((double)iterations * messages.size());
+}
+
+static double nsDecoder(const Notifications &notifications, size_t messageCount, int iterations) {
+  GoDiceDecoder<1> decoder;
+  uint32_t acc = 0;
+  uint32_t nowMs = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int it = 0; it < iterations; it++) {
+    for (const auto &n : notifications) {
+      decoder.decode(0, n.data(), n.size(), nowMs++, [&](const GoDiceEvent &e) { acc += e.value + e.type; });
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  sink = acc;
+  if (decoder.messageCount() != (uint32_t)(messageCount * iterations) || decoder.malformedBytes() != 0) {
+    printf("MISMATCH: %u messages, %u malformed bytes\n", decoder.messageCount(), decoder.malformedBytes());
+    exit(1);
+  }
+  return std::chrono::duration<double, std::nano>(end - start).count() / ((double)iterations * messageCount);
+}
+
+// Notifications as update() drains them: up to 16 queued at a time
+static double nsDecoderBatch(const Notifications &notifications, size_t messageCount, int iterations) {
+  GoDiceDecoder<1> decoder;
+  std::vector<GoDiceNotification> queued;
+  for (const auto &n : notifications) queued.push_back({0, n.data(), n.size()});
+  GoDiceEvent events[64];
+  uint32_t acc = 0;
+  uint32_t nowMs = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int it = 0; it < iterations; it++) {
+    for (size_t done = 0; done < queued.size();) {
+      size_t consumed = 0;
+      size_t count = std::min(queued.size() - done, (size_t)16);
+      size_t n = decoder.decodeBatch(queued.data() + done, count, nowMs++, events, 64, &consumed);
+      for (size_t i = 0; i < n; i++) acc += events[i].value + events[i].type;
+      done += consumed;
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  sink = acc;
+  if (decoder.messageCount() != (uint32_t)(messageCount * iterations) || decoder.malformedBytes() != 0) {
+    printf("MISMATCH: %u messages, %u malformed bytes\n", decoder.messageCount(), decoder.malformedBytes());
+    exit(1);
+  }
+  return std::chrono::duration<double, std::nano>(end - start).count() / ((double)iterations * messageCount);
+}
+
+static Notifications chunked(const std::vector<uint8_t> &all, std::mt19937 &rng, size_t maxLen) {
+  Notifications out;
+  std::uniform_int_distribution<size_t> len(1, maxLen);
+  for (size_t i = 0; i < all.size();) {
+    size_t n = maxLen == 20 ? 20 : len(rng);
+    n = std::min(n, all.size() - i);
+    out.emplace_back(all.begin() + i, all.begin() + i + n);
+    i += n;
+  }
+  return out;
+}
+
+int main(int argc, char **argv) {
+  int iterations = argc > 1 ? atoi(argv[1]) : 2000;
+
+  Notifications messages;
+  for (const WeightedMessage &w : MIX) {
+    for (int i = 0; i < w.weight; i++) messages.push_back(w.bytes);
+  }
+  std::mt19937 rng(42);
+  std::shuffle(messages.begin(), messages.end(), rng);
+
+  std::vector<uint8_t> all;
+  for (const auto &m : messages) all.insert(all.end(), m.begin(), m.end());
+
+  printf("GoDice decode, %zu messages (%zu bytes) per pass, %d passes\n", messages.size(), all.size(), iterations);
+  printf("  SDK direct, pre-framed       %6.2f ns/message\n", nsDirect(messages, iterations));
+  printf("  SDK batch, pre-framed        %6.2f ns/message\n", nsDirectBatch(messages, iterations));
+  printf("  decoder, one per notify      %6.2f ns/message\n", nsDecoder(messages, messages.size(), iterations));
+  printf("  decoder, 20-byte notifies    %6.2f ns/message\n",
+         nsDecoder(chunked(all, rng, 20), messages.size(), iterations));
+  Notifications split = chunked(all, rng, 7);
+  printf("  decoder, random 1-7 splits   %6.2f ns/message\n", nsDecoder(split, messages.size(), iterations));
+  printf("  decodeBatch, 20-byte         %6.2f ns/message\n",
+         nsDecoderBatch(chunked(all, rng, 20), messages.size(), iterations));
+  printf("  decodeBatch, 1-7 splits      %6.2f ns/message\n", nsDecoderBatch(split, messages.size(), iterations));
+  return 0;
+}
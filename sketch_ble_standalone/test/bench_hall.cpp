@@ -0,0 +1,140 @@
+/*
+ * Coin-detection latency / false-positive benchmark for hall_sensors.h.
+ *
+ * Models the firmware loop: while waiting for a coin the loop polls
+ * isCoinPresent(expectedTile) every LOOP_PERIOD_MS. For each debounce
+ * configuration it reports the delay from the physical placement to the
+ * first positive check (what the app sees as coin_placed), and how often an
+ * empty tile is reported under sensor glitches and I2C NACKs.
+ *
+ * Usage: bench_hall [trials]
+ */
+
+#include "sim_hall_bus.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static const uint32_t LOOP_PERIOD_MS = 10;
+static const uint32_t GIVE_UP_MS = 2000;
+
+struct Scenario {
+  const char *name;
+  uint32_t bounceUs;
+  double glitchRate;
+  double nackRate;
+};
+
+static const Scenario SCENARIOS[] = {
+  {"clean",         0,    0.0,  0.0},
+  {"bounce 20ms",   20000, 0.0,  0.0},
+  {"noisy",         20000, 0.05, 0.02},
+};
+
+static const HallDebounceConfig CONFIGS[] = {
+  {1, 1, 0},
+  {3, 2, 2},
+  {5, 3, 2},   // HALL_DEBOUNCE_DEFAULT
+  {7, 4, 2},
+  {5, 5, 1},
+};
+
+static double percentile(std::vector<double> &v, double p) {
+  if (v.empty()) return 0;
+  std::sort(v.begin(), v.end());
+  size_t idx = (size_t)(p * (v.size() - 1));
+  return v[idx];
+}
+
+static void runConfig(const Scenario &sc, const HallDebounceConfig &cfg, int trials) {
+  std::vector<double> latencies;
+  int missed = 0;
+  int checks = 0;
+  int falsePositives = 0;
+
+  for (int i = 0; i < trials; i++) {
+    SimHallBus bus(1000 + i);
+    bus.bounceUs = sc.bounceUs;
+    bus.glitchRate = sc.glitchRate;
+    bus.nackRate = sc.nackRate;
+
+    int tile = 1 + (i % NUM_TILES);
+    uint64_t placedUs = 50000 + (uint64_t)(i * 7919 % 100) * 1000;
+    bus.placeCoin(tile, placedUs);
+
+    bool detected = false;
+    while (bus.nowUs < placedUs + (uint64_t)GIVE_UP_MS * 1000) {
+      bool present = hallCoinPresent(bus, tile, cfg);
+      checks++;
+      if (present) {
+        if (bus.nowUs < placedUs) {
+          falsePositives++;
+        } else {
+          latencies.push_back((bus.nowUs - placedUs) / 1000.0);
+          detected = true;
+          break;
+        }
+      }
+      bus.advanceMs(LOOP_PERIOD_MS);
+    }
+    if (!detected) missed++;
+  }
+
+  // Empty-board polling for the false-positive rate
+  SimHallBus idle(7);
+  idle.glitchRate = sc.glitchRate;
+  idle.nackRate = sc.nackRate;
+  int idleChecks = trials * 20;
+  for (int i = 0; i < idleChecks; i++) {
+    if (hallCoinPresent(idle, 1 + (i % NUM_TILES), cfg)) falsePositives++;
+    idle.advanceMs(LOOP_PERIOD_MS);
+  }
+  checks += idleChecks;
+
+  double mean = 0;
+  for (double l : latencies) mean += l;
+  if (!latencies.empty()) mean /= latencies.size();
+  double p50 = percentile(latencies, 0.50);
+  double p99 = percentile(latencies, 0.99);
+  double maxL = latencies.empty() ? 0 : latencies.back();
+
+  printf("  {%u,%u,%u}  mean %6.2f  p50 %6.2f  p99 %6.2f  max %6.2f ms  missed %d  FP %.4f%%\n",
+         cfg.samples, cfg.threshold, cfg.sampleGapMs, mean, p50, p99, maxL, missed,
+         100.0 * falsePositives / checks);
+}
+
+static void runScanCost() {
+  SimHallBus bus;
+  HallDebounceConfig cfg = HALL_DEBOUNCE_DEFAULT;
+
+  uint64_t start = bus.nowUs;
+  for (int t = 1; t <= NUM_TILES; t++) {
+    hallCoinPresent(bus, t, cfg);
+  }
+  double perTile = (bus.nowUs - start) / 1000.0;
+
+  start = bus.nowUs;
+  hallScanTiles(bus, cfg);
+  double batched = (bus.nowUs - start) / 1000.0;
+
+  printf("\nFull 20-tile scan (default debounce): per-tile %.2f ms, batched %.2f ms\n",
+         perTile, batched);
+}
+
+int main(int argc, char **argv) {
+  int trials = argc > 1 ? atoi(argv[1]) : 2000;
+  if (trials <= 0) trials = 2000;
+
+  printf("Coin detection, loop period %u ms, %d trials per config\n", LOOP_PERIOD_MS, trials);
+  printf("Config = {samples, threshold, gapMs}; latency = placement -> first positive check\n");
+  for (const Scenario &sc : SCENARIOS) {
+    printf("\n%s (bounce %u us, glitch %.0f%%, nack %.0f%%)\n", sc.name, sc.bounceUs,
+           sc.glitchRate * 100, sc.nackRate * 100);
+    for (const HallDebounceConfig &cfg : CONFIGS) {
+      runConfig(sc, cfg, trials);
+    }
+  }
+  runScanCost();
+  return 0;
+}
@@ -0,0 +1,113 @@
+/*
+ * Game journal benchmark on the NOR flash emulator, with the "journal"
+ * partition's geometry (64 KB, 4 KB sectors).
+ *
+ * Plays a number of turns (each a roll save and a coin save, as the
+ * coalesced saveGameState() issues them) and reports flash bytes written
+ * and sectors erased per turn, the spread of erases across sectors, and
+ * the projected partition lifetime at a given number of turns per day for
+ * 100k-cycle NOR flash. Then times recover() with a full head sector, the
+ * worst case at boot, and the flash bytes it reads.
+ *
+ * Usage: bench_journal [turns] [turns_per_day]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "game_journal.h"
+#include "flash_emulator.h"
+
+typedef std::chrono::steady_clock Clock;
+
+#define PARTITION_BYTES 0x10000
+#define SECTOR_BYTES 4096
+#define ERASE_CYCLES 100000.0
+
+static GameSnapshot freshGame() {
+  GameSnapshot s;
+  memset(&s, 0, sizeof(s));
+  for (int i = 0; i < NUM_PLAYERS; i++) {
+    s.players[i].tile = 1;
+    s.players[i].score = 10;
+    s.players[i].flags = SNAPSHOT_ALIVE;
+  }
+  return s;
+}
+
+static void playTurn(GameSnapshot &s, uint32_t turn, uint32_t &rng) {
+  SnapshotPlayer &p = s.players[turn % NUM_PLAYERS];
+  rng = rng * 1103515245u + 12345u;
+  p.tile = (uint8_t)((p.tile - 1 + 1 + (rng >> 16) % 6) % 20 + 1);
+  p.score = (int16_t)(p.score + (int)((rng >> 8) % 5) - 2);
+  p.flags = SNAPSHOT_ALIVE;
+}
+
+int main(int argc, char **argv) {
+  uint32_t turns = argc > 1 ? (uint32_t)atoi(argv[1]) : 100000;
+  double perDay = argc > 2 ? atof(argv[2]) : 500;
+
+  FlashEmulator flash(PARTITION_BYTES, SECTOR_BYTES);
+  GameJournal<FlashEmulator> journal(flash);
+  if (!journal.begin()) {
+    printf("partition too small\n");
+    return 1;
+  }
+  GameSnapshot game = freshGame();
+  journal.start(game);
+  uint64_t startBytes = flash.programmed;
+  uint64_t startErases = flash.totalErases();
+
+  uint32_t rng = 1;
+  for (uint32_t t = 0; t < turns; t++) {
+    playTurn(game, t, rng);
+    journal.record(game);
+    journal.commit();
+    game.players[t % NUM_PLAYERS].flags |= SNAPSHOT_COIN;
+    journal.record(game);
+    journal.commit();
+  }
+
+  double bytesPerTurn = (double)(flash.programmed - startBytes) / turns;
+  double erasesPerTurn = (double)(flash.totalErases() - startErases) / turns;
+  double snapshotBytes = 2.0 * sizeof(GameSnapshot);  // Payload alone, before NVS entry overhead
+  printf("%u turns, %u sectors of %u bytes, %u records per sector\n", turns, journal.sectors(), SECTOR_BYTES,
+         journal.recordsPerSector());
+  printf("bytes written per turn:  %.1f (two snapshots: %.0f)\n", bytesPerTurn, snapshotBytes);
+  printf("sector erases per turn:  %.4f\n", erasesPerTurn);
+  printf("erases per sector:       max %u, total %llu, violations %u\n", flash.maxErases(),
+         (unsigned long long)flash.totalErases(), flash.violations);
+
+  double turnsToWearOut = ERASE_CYCLES * journal.sectors() / erasesPerTurn;
+  printf("projected lifetime:      %.0f turns, %.0f years at %.0f turns/day\n", turnsToWearOut,
+         turnsToWearOut / perDay / 365.0, perDay);
+
+  // Worst-case boot: head sector full of records, nothing left to append
+  FlashEmulator full(PARTITION_BYTES, SECTOR_BYTES);
+  GameJournal<FlashEmulator> writer(full);
+  writer.begin();
+  GameSnapshot base = freshGame();
+  writer.start(base);
+  for (uint32_t i = 0; writer.headUsed() + sizeof(JournalRecord) <= SECTOR_BYTES; i++) {
+    playTurn(base, i, rng);
+    writer.record(base);
+    writer.commit();
+  }
+
+  const int runs = 2000;
+  uint64_t readBefore = full.readBytes;
+  GameSnapshot out;
+  Clock::time_point t0 = Clock::now();
+  uint32_t replayed = 0;
+  for (int i = 0; i < runs; i++) {
+    GameJournal<FlashEmulator> boot(full);
+    boot.begin();
+    boot.recover(out);
+    replayed = boot.replayed();
+  }
+  double us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / runs;
+  printf("recover(), full head:    %.1f us host, %u records replayed, %llu bytes read\n", us, replayed,
+         (unsigned long long)((full.readBytes - readBefore) / runs));
+  return memcmp(out.players, base.players, sizeof(base.players)) == 0 ? 0 : 1;
+}
@@ -0,0 +1,227 @@
+/*
+ * Persistence cost benchmark: replays a recorded game through the ways the
+ * firmware has saved state and reports flash cost per turn on the host
+ * NVS model (host_preferences.h) and the flash emulator.
+ *
+ *   per-field  16 putInt / putBool keys per save (before the snapshot)
+ *   snapshot   SnapshotStore over Preferences (the NVS fallback)
+ *   journal    GameJournal on the "journal" partition (the default)
+ *
+ * Each turn is two coalesced saves, after the roll and after the coin,
+ * as saveGameState() sees them; every session starts with a settings
+ * update (handleUpdateSettings) and ends with a reset. Reports bytes
+ * programmed, sector erases and modeled flash time per turn, the cost of
+ * the boot-time load, and the per-call breakdown of Preferences traffic.
+ *
+ * Usage: bench_persistence [sessions]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "game_journal.h"
+#include "host_preferences.h"
+
+#define NUM_TILES 20
+
+struct RecordedRoll {
+  uint8_t player;
+  uint8_t dice;
+  int8_t chance;  // Card effect if the roll lands on a chance tile
+};
+
+// Four-player session captured from the board's roll log
+static const RecordedRoll RECORDED_GAME[] = {
+  {0, 4, 2}, {1, 6, -2}, {2, 3, 1}, {3, 6, 0}, {0, 6, 2}, {1, 5, 1}, {2, 6, -1}, {3, 3, 0},
+  {0, 5, -3}, {1, 2, 2}, {2, 5, 0}, {3, 5, 1}, {0, 6, 1}, {1, 6, -1}, {2, 6, 2}, {3, 5, 1},
+  {0, 4, 2}, {1, 3, 0}, {2, 4, 1}, {3, 6, 2}, {0, 3, 0}, {1, 3, 0}, {2, 2, 0}, {3, 4, 0},
+  {0, 3, -2}, {1, 2, 0}, {2, 2, 1}, {3, 1, 1}, {0, 1, 2}, {1, 5, 0}, {2, 5, 0}, {3, 5, 1},
+  {0, 3, -3}, {1, 2, 1}, {2, 4, 0}, {3, 2, 1}, {0, 3, -1}, {1, 5, 2}, {2, 3, 0}, {3, 5, 0},
+  {0, 3, -1}, {1, 2, 2}, {2, 3, 1}, {3, 5, 1}, {0, 1, 2}, {1, 1, 2}, {2, 4, 1}, {3, 3, 1},
+  {0, 1, 1}, {1, 3, 1}, {2, 6, -1}, {3, 5, 2}, {0, 4, -3}, {1, 4, 0}, {2, 2, 1}, {3, 3, 2},
+  {0, 3, 2}, {1, 5, 2}, {2, 5, 1}, {3, 4, 1}, {0, 2, 0}, {1, 2, -3}, {2, 2, 0}, {3, 3, 2}
+};
+
+// handleRoll()'s score change per tile; chance tiles (6, 11, 16) use the card
+static const int8_t TILE_SCORE[NUM_TILES] = {
+  0, +1, -2, +3, -3, 0, +3, -1, -5, +3, 0, -4, +3, -2, +3, 0, -2, +4, +1, -2
+};
+
+static void resetGame(GameSnapshot &s) {
+  memset(&s, 0, sizeof(s));
+  for (int i = 0; i < NUM_PLAYERS; i++) {
+    s.players[i].tile = 1;
+    s.players[i].score = 10;
+    s.players[i].flags = SNAPSHOT_ALIVE;
+  }
+}
+
+static void applyRoll(GameSnapshot &s, const RecordedRoll &roll) {
+  SnapshotPlayer &p = s.players[roll.player];
+  int tile = p.tile + roll.dice;
+  if (tile > NUM_TILES) tile -= NUM_TILES;
+  int change = (tile == 6 || tile == 11 || tile == 16) ? roll.chance : TILE_SCORE[tile - 1];
+  int score = p.score + change;
+  if (score < 0) score = 0;
+  p.tile = (uint8_t)tile;
+  p.score = (int16_t)score;
+  p.flags = (uint8_t)(p.flags & ~SNAPSHOT_COIN);
+  if (score <= 0) p.flags = 0;
+}
+
+// Legacy saveGameState(): one key per field
+struct PerFieldSaver {
+  Preferences &prefs;
+  void save(const GameSnapshot &s) {
+    for (int i = 0; i < NUM_PLAYERS; i++) {
+      char key[12];
+      snprintf(key, sizeof(key), "p%d_tile", i);
+      prefs.putInt(key, s.players[i].tile);
+      snprintf(key, sizeof(key), "p%d_score", i);
+      prefs.putInt(key, s.players[i].score);
+      snprintf(key, sizeof(key), "p%d_alive", i);
+      prefs.putBool(key, (s.players[i].flags & SNAPSHOT_ALIVE) != 0);
+      snprintf(key, sizeof(key), "p%d_coin", i);
+      prefs.putBool(key, (s.players[i].flags & SNAPSHOT_COIN) != 0);
+    }
+  }
+  void load() {
+    for (int i = 0; i < NUM_PLAYERS; i++) {
+      char key[12];
+      snprintf(key, sizeof(key), "p%d_tile", i);
+      prefs.getInt(key, 1);
+      snprintf(key, sizeof(key), "p%d_score", i);
+      prefs.getInt(key, 10);
+      snprintf(key, sizeof(key), "p%d_alive", i);
+      prefs.getBool(key, true);
+      snprintf(key, sizeof(key), "p%d_coin", i);
+      prefs.getBool(key, false);
+    }
+  }
+};
+
+struct SnapshotSaver {
+  Preferences &prefs;
+  SnapshotStore<Preferences> store;
+  explicit SnapshotSaver(Preferences &p) : prefs(p), store(p) {}
+  void save(const GameSnapshot &s) { store.save(s); }
+  void load() {
+    SnapshotStore<Preferences> boot(prefs);
+    GameSnapshot s;
+    boot.load(s);
+  }
+};
+
+struct JournalSaver {
+  FlashEmulator flash;
+  GameJournal<FlashEmulator> journal;
+  JournalSaver() : flash(0x10000, 4096), journal(flash) {
+    journal.begin();
+    GameSnapshot s;
+    resetGame(s);
+    journal.start(s);
+  }
+  void save(const GameSnapshot &s) {
+    journal.record(s);
+    journal.commit();
+  }
+  void load() {
+    GameJournal<FlashEmulator> boot(flash);
+    GameSnapshot s;
+    boot.begin();
+    boot.recover(s);
+  }
+};
+
+struct Cost {
+  uint64_t programmed;
+  uint64_t erases;
+  double us;
+};
+
+static Cost costOf(const FlashEmulator &a, const FlashEmulator *b) {
+  Cost c = {a.programmed, a.totalErases(), a.modeledUs()};
+  if (b) {
+    c.programmed += b->programmed;
+    c.erases += b->totalErases();
+    c.us += b->modeledUs();
+  }
+  return c;
+}
+
+template <class Saver>
+static void run(const char *name, Saver &saver, NvsEmulator &nvs, Preferences &prefs, const FlashEmulator *extra,
+                int sessions) {
+  const int rolls = sizeof(RECORDED_GAME) / sizeof(RECORDED_GAME[0]);
+  Cost before = costOf(nvs.flash, extra);
+  GameSnapshot game;
+  for (int s = 0; s < sessions; s++) {
+    prefs.putString("password", s % 2 ? "654321" : "123456");
+    prefs.putString("nickname", "LastDrop-01");
+    resetGame(game);
+    saver.save(game);
+    for (int r = 0; r < rolls; r++) {
+      const RecordedRoll &roll = RECORDED_GAME[r];
+      if (!(game.players[roll.player].flags & SNAPSHOT_ALIVE)) continue;
+      applyRoll(game, roll);
+      saver.save(game);
+      if (game.players[roll.player].flags & SNAPSHOT_ALIVE) {
+        game.players[roll.player].flags |= SNAPSHOT_COIN;
+        saver.save(game);
+      }
+    }
+  }
+  Cost after = costOf(nvs.flash, extra);
+  double turns = (double)sessions * rolls;
+
+  Cost bootBefore = costOf(nvs.flash, extra);
+  prefs.getString("password");
+  prefs.getString("nickname");
+  saver.load();
+  Cost bootAfter = costOf(nvs.flash, extra);
+
+  uint32_t wear = nvs.flash.maxErases();
+  if (extra && extra->maxErases() > wear) wear = extra->maxErases();
+  printf("%-10s %10.1f %12.2f %10.2f %10.2f %8u %10u\n", name, (after.programmed - before.programmed) / turns,
+         (after.erases - before.erases) * 1000.0 / turns, (after.us - before.us) / turns / 1000.0,
+         (bootAfter.us - bootBefore.us) / 1000.0, nvs.collections(), wear);
+}
+
+static void printOps(const char *name, NvsEmulator &nvs) {
+  printf("\n%s: Preferences calls\n", name);
+  printf("  %-15s %8s %12s %8s %10s %10s\n", "call", "calls", "programmed", "erases", "read", "ms");
+  for (const auto &kv : nvs.ops) {
+    const NvsOpStats &s = kv.second;
+    printf("  %-15s %8u %12llu %8llu %10llu %10.1f\n", kv.first.c_str(), s.calls, (unsigned long long)s.programmed,
+           (unsigned long long)s.erases, (unsigned long long)s.readBytes, s.us / 1000.0);
+  }
+}
+
+int main(int argc, char **argv) {
+  int sessions = argc > 1 ? atoi(argv[1]) : 200;
+  printf("%d sessions of %d recorded rolls\n\n", sessions, (int)(sizeof(RECORDED_GAME) / sizeof(RECORDED_GAME[0])));
+  printf("%-10s %10s %12s %10s %10s %8s %10s\n", "scheme", "bytes/turn", "erases/1k", "ms/turn", "boot ms",
+         "nvs gc", "max wear");  // Wear: erases of the busiest sector
+
+  NvsEmulator fieldNvs;
+  Preferences fieldPrefs(fieldNvs);
+  fieldPrefs.begin("lastdrop");
+  PerFieldSaver fields = {fieldPrefs};
+  run("per-field", fields, fieldNvs, fieldPrefs, nullptr, sessions);
+
+  NvsEmulator snapNvs;
+  Preferences snapPrefs(snapNvs);
+  snapPrefs.begin("lastdrop");
+  SnapshotSaver snapshot(snapPrefs);
+  run("snapshot", snapshot, snapNvs, snapPrefs, nullptr, sessions);
+
+  NvsEmulator journalNvs;  // Settings stay in NVS
+  Preferences journalPrefs(journalNvs);
+  journalPrefs.begin("lastdrop");
+  JournalSaver journal;
+  run("journal", journal, journalNvs, journalPrefs, &journal.flash, sessions);
+
+  printOps("per-field", fieldNvs);
+  printOps("snapshot", snapNvs);
+  return 0;
+}
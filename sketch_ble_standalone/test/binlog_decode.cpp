@@ -0,0 +1,46 @@
+/*
+ * Host decoder for the board's binary log: reads a Serial capture (file
+ * argument or stdin), turns every "$B" line back into text with the
+ * log_catalog.h formats and passes all other lines through unchanged.
+ *
+ *   binlog_decode capture.txt
+ *   some-serial-monitor | binlog_decode
+ *
+ * Build it from the same tree as the firmware that wrote the log.
+ */
+
+#define BINLOG_MICROS() 0
+#include "binlog.h"
+#include <cstdio>
+
+int main(int argc, char **argv) {
+  FILE *in = stdin;
+  if (argc > 1) {
+    in = fopen(argv[1], "r");
+    if (in == nullptr) {
+      perror(argv[1]);
+      return 1;
+    }
+  }
+
+  char line[1024];
+  char text[256];
+  LogRecord rec;
+  const char *marker;
+  while (fgets(line, sizeof(line), in) != nullptr) {
+    // The marker may follow text the board printed without a newline
+    marker = strstr(line, LOG_LINE_MARKER);
+    if (marker == nullptr || !decodeLogLine(marker, rec)) {
+      fputs(line, stdout);
+      continue;
+    }
+    if (marker != line) printf("%.*s\n", (int)(marker - line), line);
+    formatLogRecord(rec, text, sizeof(text));
+    printf("[%lu.%06lu] %s\n", (unsigned long)(rec.timestampUs / 1000000),
+           (unsigned long)(rec.timestampUs % 1000000), text);
+    fflush(stdout);
+  }
+
+  if (in != stdin) fclose(in);
+  return 0;
+}
@@ -0,0 +1,22 @@
+/*
+ * CHECK() for the host tests: prints a failed condition with its location
+ * and counts it in failures, which each test's main() turns into its exit
+ * status.
+ */
+
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+#include <cstdio>
+
+static int failures = 0;
+
+#define CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+      failures++; \
+    } \
+  } while (0)
+
+#endif // TEST_CHECK_H
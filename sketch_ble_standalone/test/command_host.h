@@ -0,0 +1,294 @@
+/*
+ * Host build of the board's command path for the tests, the fuzzer and
+ * bench_commands: BLE writes go into the same CommandRing, are dispatched by
+ * the same dispatchCommand() (command_layer.h), and responses leave through
+ * the same TxArena + FragmentWriter into a mock TX characteristic.
+ *
+ * Request ids are echoed like sendBLEJson() / sendBLEFrame() do. The
+ * handlers are a small model of the game (positions, scores, pairing,
+ * negotiated wire version) that answers with messages shaped and sized like
+ * the firmware's, not the firmware's handlers themselves: those drive LEDs,
+ * Hall sensors and NVS and stay in the sketch.
+ *
+ * If ArduinoJson is on the include path, JSON commands are parsed too.
+ */
+
+#ifndef COMMAND_HOST_H
+#define COMMAND_HOST_H
+
+#if defined(__has_include)
+#if __has_include(<ArduinoJson.h>)
+#include <ArduinoJson.h>
+#endif
+#endif
+
+#include "command_layer.h"
+#include "command_ring.h"
+#include "ble_framing.h"
+#include "tx_arena.h"
+#include <stdio.h>
+#include <vector>
+
+#define HOST_RING_SLOTS 8
+#define HOST_SLOT_SIZE 512
+
+// Stands in for the TX BLECharacteristic: keeps what was notified
+class MockCharacteristic {
+public:
+  MockCharacteristic() : valueLen(0), notifyCount(0), byteCount(0), maxPayload(0) {}
+
+  void setValue(const uint8_t *data, size_t len) {
+    value.assign(data, data + len);
+    valueLen = len;
+  }
+
+  void notify() {
+    notifyCount++;
+    byteCount += valueLen;
+    if (valueLen > maxPayload) maxPayload = valueLen;
+    if (keep) sent.push_back(value);
+  }
+
+  void clear() {
+    sent.clear();
+    notifyCount = 0;
+    byteCount = 0;
+    maxPayload = 0;
+  }
+
+  bool keep = true;  // The bench turns this off
+  std::vector<std::vector<uint8_t>> sent;
+  std::vector<uint8_t> value;
+  size_t valueLen;
+  uint32_t notifyCount;
+  uint64_t byteCount;
+  size_t maxPayload;
+};
+
+class HostBoard {
+public:
+  HostBoard() : mtu(ATT_DEFAULT_MTU), isPaired(false), pairingRequired(true), wireVersion(0),
+                activePlayerCount(4), commandsRun(0), errorsSent(0), lastError(nullptr) {
+    for (int i = 0; i < NUM_PLAYERS; i++) {
+      tiles[i] = 1;
+      scores[i] = 10;
+      alive[i] = true;
+    }
+  }
+
+  // BLE write callback: what handleBLECommand() does on the board
+  CommandPushResult write(const uint8_t *data, size_t len) {
+    return ring.push(data, (uint32_t)len);
+  }
+
+  CommandPushResult write(const char *json) {
+    return write((const uint8_t *)json, strlen(json));
+  }
+
+  // Game task: processCommandQueue() for everything queued
+  uint32_t drain() {
+    uint32_t n = 0;
+    uint32_t len = 0;
+    char *cmd;
+    while ((cmd = ring.front(len)) != nullptr) {
+      CommandId id = CMD_UNKNOWN;
+      const char *error = dispatchCommand(*this, cmd, len, id);
+      if (error != nullptr) sendError(error);
+      request = NO_REQUEST;
+      commandsRun++;
+      ring.pop();
+      n++;
+    }
+    return n;
+  }
+
+  // ---- Board interface (command_layer.h) ----
+
+  bool paired() { return !pairingRequired || isPaired; }
+  void received(CommandId id, uint32_t, bool, const RequestTag &tag) {
+    request = tag;
+    if (id < CMD_COUNT && COMMAND_CATEGORIES[id] == CMD_CAT_GAME) coinWaitRequest = NO_REQUEST;
+  }
+
+  void handleRoll(const RollArgs &args) {
+    if (args.playerId >= activePlayerCount) {
+      sendError("Invalid player ID");
+      return;
+    }
+    int p = args.playerId;
+    int from = tiles[p];
+    int to = (from - 1 + args.diceValue) % NUM_TILES + 1;
+    int oldScore = scores[p];
+    int newScore = oldScore + (to % 3 == 0 ? -2 : 1);
+    tiles[p] = to;
+    scores[p] = newScore;
+    alive[p] = newScore > 0;
+    waitingForCoin = true;
+    coinPlayer = p;
+    coinWaitRequest = request;
+    if (wireVersion > 0) {
+      uint8_t buf[128];
+      WireWriter frame(buf, sizeof(buf));
+      frame.begin(WIRE_EVT_ROLL_PROCESSED, wireVersion);
+      frame.putInt(WIRE_TAG_PLAYER_ID, p);
+      frame.putInt(WIRE_TAG_FROM, from);
+      frame.putInt(WIRE_TAG_TO, to);
+      frame.putInt(WIRE_TAG_TILE_TYPE, to % 8);
+      frame.putInt(WIRE_TAG_SCORE_OLD, oldScore);
+      frame.putInt(WIRE_TAG_SCORE_NEW, newScore);
+      frame.putInt(WIRE_TAG_SCORE_CHANGE, newScore - oldScore);
+      frame.putBool(WIRE_TAG_ALIVE, alive[p]);
+      frame.putBool(WIRE_TAG_WAIT_COIN, true);
+      sendFrame(frame);
+      return;
+    }
+    sendText("{\"event\":\"roll_processed\",\"playerId\":%d,\"diceValue\":%d,\"from\":%d,\"to\":%d,"
+             "\"tile\":{\"index\":%d,\"name\":\"Tile %d\",\"type\":\"SAFE\"},\"scoreChange\":%d,"
+             "\"oldScore\":%d,\"newScore\":%d,\"alive\":%s,\"waitingForCoin\":true}",
+             p, args.diceValue, from, to, to, to, newScore - oldScore, oldScore, newScore,
+             alive[p] ? "true" : "false");
+  }
+
+  void handleUndo() { sendText("{\"event\":\"undo_complete\",\"playerId\":0,\"from\":5,\"to\":1,\"score\":10,\"alive\":true}"); }
+  void handleReset() {
+    for (int i = 0; i < NUM_PLAYERS; i++) {
+      tiles[i] = 1;
+      scores[i] = 10;
+      alive[i] = true;
+    }
+    sendText("{\"event\":\"reset_complete\",\"message\":\"Game reset\"}");
+  }
+
+  void handlePair(const PairArgs &args) {
+    if (args.password == nullptr || strcmp(args.password, "654321") != 0) {
+      sendText("{\"event\":\"pair_failed\",\"message\":\"Invalid password\"}");
+      return;
+    }
+    isPaired = true;
+    wireVersion = args.wireVersion < WIRE_VERSION ? args.wireVersion : WIRE_VERSION;
+    sendText("{\"event\":\"pair_success\",\"message\":\"Paired\",\"wire\":%d}", wireVersion);
+  }
+
+  void handleUnpair() {
+    isPaired = false;
+    wireVersion = 0;
+    sendText("{\"event\":\"unpaired\"}");
+  }
+
+  void handleConfig(const ConfigArgs &args) {
+    activePlayerCount = args.playerCount;
+    sendText("{\"event\":\"config_complete\",\"playerCount\":%d}", args.playerCount);
+  }
+
+  void handleSyncState(const SyncStateArgs &args) {
+    if (args.gameActive) {
+      activePlayerCount = args.playerCount;
+      for (int i = 0; i < args.positionCount; i++) tiles[i] = args.positions[i];
+      for (int i = 0; i < args.scoreCount; i++) scores[i] = args.scores[i];
+      for (int i = 0; i < args.aliveCount; i++) alive[i] = args.alive[i];
+    }
+    sendText("{\"event\":\"sync_complete\",\"message\":\"Game state restored\"}");
+  }
+
+  void handleUpdateSettings(const UpdateSettingsArgs &) {
+    sendText("{\"event\":\"settings_updated\",\"message\":\"Settings saved\"}");
+  }
+
+  // Roughly the size of the firmware's status_report
+  void sendStatus() {
+    char *buf = tx.begin();
+    if (buf == nullptr) return;
+    int n = snprintf(buf, tx.capacity(), "{\"event\":\"status_report\",\"connected\":true,\"players\":[");
+    for (int i = 0; i < NUM_PLAYERS && n > 0 && (uint32_t)n < tx.capacity(); i++) {
+      n += snprintf(buf + n, tx.capacity() - n, "%s{\"id\":%d,\"tile\":%d,\"score\":%d,\"alive\":%s}",
+                    i ? "," : "", i, tiles[i], scores[i], alive[i] ? "true" : "false");
+    }
+    if (n > 0 && (uint32_t)n < tx.capacity()) {
+      n += snprintf(buf + n, tx.capacity() - n,
+                    "],\"wire\":%d,\"commandQueue\":{\"depth\":%u,\"highWater\":%u,\"capacity\":%u,"
+                    "\"dropped\":%u}}", wireVersion, ring.size(), ring.highWater(), ring.capacity(),
+                    ring.droppedCount());
+    }
+    finish(buf, n);
+  }
+
+  void sendTaskStats(bool) { sendText("{\"event\":\"task_stats\",\"tasks\":[]}"); }
+  void sendProfile(bool) { sendText("{\"event\":\"profile\",\"stages\":[]}"); }
+  void handleVictory(const VictoryArgs &args) { sendText("{\"event\":\"victory_ack\",\"winnerId\":%d}", args.winnerId); }
+  void handleStateAck(const StateAckArgs &) {}
+  void handleResync(const ResyncArgs &args) { sendText("{\"event\":\"resync_required\",\"seq\":%u}", args.seq); }
+
+  // Deferred event: the coin for the last roll arrives (checkCoinPlacement())
+  void placeCoin() {
+    if (!waitingForCoin) return;
+    waitingForCoin = false;
+    RequestTag saved = request;
+    request = coinWaitRequest;
+    sendText("{\"event\":\"coin_placed\",\"playerId\":%d,\"tile\":%d}", coinPlayer, tiles[coinPlayer]);
+    request = saved;
+  }
+
+  // ---- Response path: arena -> fragments -> characteristic ----
+
+  void sendError(const char *message) {
+    errorsSent++;
+    lastError = message;
+    sendText("{\"event\":\"error\",\"message\":\"%s\"}", message);
+  }
+
+  template <typename... Args>
+  void sendText(const char *format, Args... args) {
+    char *buf = tx.begin();
+    if (buf == nullptr) return;
+    finish(buf, snprintf(buf, tx.capacity(), format, args...));
+  }
+
+  void sendFrame(WireWriter &frame) {
+    appendRequestId(frame, request);
+    if (frame.ok()) notify(frame.data(), frame.size());
+  }
+
+  MockCharacteristic characteristic;
+  CommandRing<HOST_RING_SLOTS, HOST_SLOT_SIZE> ring;
+  TxArena<2048, HOST_SLOT_SIZE> tx;
+  RequestTag request = NO_REQUEST;  // Of the command being dispatched
+  RequestTag coinWaitRequest = NO_REQUEST;
+  bool waitingForCoin = false;
+  int coinPlayer = 0;
+  uint16_t mtu;
+  bool isPaired;
+  bool pairingRequired;
+  uint8_t wireVersion;
+  int activePlayerCount;
+  int tiles[NUM_PLAYERS];
+  int scores[NUM_PLAYERS];
+  bool alive[NUM_PLAYERS];
+  uint32_t commandsRun;
+  uint32_t errorsSent;
+  const char *lastError;
+
+private:
+  uint8_t notifySeq = 0;
+
+  void finish(char *buf, int len) {
+    if (len > 0 && (uint32_t)len + 1 < tx.capacity()) {
+      len = (int)appendRequestId(buf, (uint32_t)len, tx.capacity(), request);
+    }
+    if (len > 0 && tx.fits((uint32_t)len)) notify((const uint8_t *)buf, (uint32_t)len);
+    tx.end();
+  }
+
+  void notify(const uint8_t *data, uint32_t len) {
+    uint32_t payload = notifyPayloadSize(mtu);
+    if (payload > tx.fragmentCapacity()) payload = tx.fragmentCapacity();
+    FragmentWriter writer;
+    if (!writer.begin(data, len, payload, notifySeq++)) return;
+    uint32_t fragmentLen = 0;
+    while (writer.next(tx.fragment(), fragmentLen)) {
+      characteristic.setValue(tx.fragment(), fragmentLen);
+      characteristic.notify();
+    }
+  }
+};
+
+#endif // COMMAND_HOST_H
@@ -0,0 +1,120 @@
+/*
+ * NOR flash model for host tests and benches of game_journal.h: erase sets
+ * a sector to 0xFF, a write can only clear bits (a write that would set
+ * one is counted as a violation and leaves the bit cleared, like the real
+ * part), and erases are counted per sector for wear figures.
+ *
+ * cutAfter() simulates a power cut: the write in progress stops after that
+ * many more bytes, a cut erase leaves the sector half erased, and every
+ * later operation fails until powerOn().
+ *
+ * modeledUs() turns the counters into time with typical SPI NOR datasheet
+ * figures, so host runs can compare persistence schemes in device terms.
+ */
+
+#ifndef FLASH_EMULATOR_H
+#define FLASH_EMULATOR_H
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+#define FLASH_ERASE_US 45000.0        // 4 KB sector erase, typical
+#define FLASH_PROGRAM_SETUP_US 20.0   // Per write call
+#define FLASH_PROGRAM_US_PER_BYTE 1.6 // Page program, ~0.4 ms per 256 bytes
+#define FLASH_READ_US_PER_BYTE 0.025  // 80 MHz QIO
+
+class FlashEmulator {
+public:
+  FlashEmulator(uint32_t bytes, uint32_t sector)
+    : mem(bytes, 0xFF), sectorBytes(sector), erases(bytes / sector, 0), programmed(0), writeCalls(0),
+      readBytes(0), violations(0), budget(-1), down(false) {}
+
+  uint32_t size() const { return (uint32_t)mem.size(); }
+  uint32_t sectorSize() const { return sectorBytes; }
+
+  bool erase(uint32_t addr) {
+    if (down || addr % sectorBytes != 0 || addr >= size()) return false;
+    uint32_t n = sectorBytes;
+    bool cut = consume(n);
+    memset(&mem[addr], 0xFF, n);
+    if (cut) {
+      // Half-erased: the rest keeps (some of) its old contents
+      return false;
+    }
+    erases[addr / sectorBytes]++;
+    return true;
+  }
+
+  bool write(uint32_t addr, const void *data, uint32_t len) {
+    if (down || addr + len > size()) return false;
+    uint32_t n = len;
+    bool cut = consume(n);
+    const uint8_t *p = (const uint8_t *)data;
+    for (uint32_t i = 0; i < n; i++) {
+      if (p[i] & ~mem[addr + i]) violations++;
+      mem[addr + i] &= p[i];
+    }
+    programmed += n;
+    writeCalls++;
+    return !cut;
+  }
+
+  bool read(uint32_t addr, void *data, uint32_t len) {
+    if (down || addr + len > size()) return false;
+    memcpy(data, &mem[addr], len);
+    readBytes += len;
+    return true;
+  }
+
+  // Power fails after n more bytes are written or erased
+  void cutAfter(int64_t n) { budget = n; }
+  void powerOn() {
+    budget = -1;
+    down = false;
+  }
+
+  uint32_t maxErases() const {
+    uint32_t m = 0;
+    for (uint32_t e : erases) m = e > m ? e : m;
+    return m;
+  }
+
+  uint64_t totalErases() const {
+    uint64_t t = 0;
+    for (uint32_t e : erases) t += e;
+    return t;
+  }
+
+  double modeledUs() const {
+    return totalErases() * FLASH_ERASE_US + writeCalls * FLASH_PROGRAM_SETUP_US +
+           programmed * FLASH_PROGRAM_US_PER_BYTE + readBytes * FLASH_READ_US_PER_BYTE;
+  }
+
+  std::vector<uint8_t> mem;
+  uint32_t sectorBytes;
+  std::vector<uint32_t> erases;
+  uint64_t programmed;
+  uint64_t writeCalls;
+  uint64_t readBytes;
+  uint32_t violations;  // Writes that tried to set a bit without an erase
+
+private:
+  int64_t budget;
+  bool down;
+
+  // Shortens n to what the remaining budget allows; true if power failed
+  bool consume(uint32_t &n) {
+    if (budget < 0) return false;
+    if ((int64_t)n <= budget) {
+      budget -= n;
+      return false;
+    }
+    n = (uint32_t)budget;
+    budget = 0;
+    down = true;
+    return true;
+  }
+};
+
+#endif // FLASH_EMULATOR_H
@@ -0,0 +1,59 @@
+/*
+ * Fuzz target for the command path (command_host.h): arbitrary bytes and
+ * command sequences go through the ring, dispatchCommand() and the send
+ * path of a fresh host board.
+ *
+ * Input: byte 0 picks the MTU and whether the board starts paired, then
+ * repeated [length][bytes] chunks, each one BLE write. A length byte of 0
+ * drains the ring mid-sequence, so the ring also fills and wraps.
+ *
+ * Beyond "no crash" (run under ASan/UBSan), every notification must fit the
+ * MTU and the app-side Reassembler must accept the whole output stream.
+ *
+ * Built with libFuzzer when the compiler is Clang (fuzz_commands); the
+ * fuzz_commands_smoke test runs it through fuzz_driver.cpp instead.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "command_host.h"
+
+static const uint16_t FUZZ_MTUS[] = {23, 24, 27, 64, 185, 247, 517};
+
+static void checkOutput(HostBoard &board, Reassembler<2048> &app) {
+  uint32_t payload = notifyPayloadSize(board.mtu);
+  for (const std::vector<uint8_t> &n : board.characteristic.sent) {
+    if (n.size() > payload) abort();
+    if (app.feed(n.data(), (uint32_t)n.size()) == REASM_ERROR) abort();
+  }
+  board.characteristic.clear();
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  if (size == 0) return 0;
+  static HostBoard *board = nullptr;
+  static Reassembler<2048> *app = nullptr;
+  delete board;  // Fresh state per input, kept off the stack
+  delete app;
+  board = new HostBoard();
+  app = new Reassembler<2048>();
+
+  board->mtu = FUZZ_MTUS[(data[0] & 0x7F) % (sizeof(FUZZ_MTUS) / sizeof(FUZZ_MTUS[0]))];
+  board->pairingRequired = (data[0] & 0x80) == 0;
+  size_t pos = 1;
+  while (pos < size) {
+    size_t len = data[pos++];
+    if (len == 0) {
+      board->drain();
+      checkOutput(*board, *app);
+      continue;
+    }
+    if (len > size - pos) len = size - pos;
+    board->write(data + pos, len);
+    pos += len;
+  }
+  board->drain();
+  checkOutput(*board, *app);
+  if (app->inProgress()) abort();  // Every message was sent whole
+  return 0;
+}
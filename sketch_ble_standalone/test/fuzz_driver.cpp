@@ -0,0 +1,86 @@
+/*
+ * Runs LLVMFuzzerTestOneInput without libFuzzer, for compilers that lack it
+ * and as a ctest smoke test.
+ *
+ * Usage: fuzz_commands_smoke [iterations]   seeded random and mutated inputs
+ *        fuzz_commands_smoke file...        replay saved inputs (crashes)
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "wire_protocol.h"
+#include "command_table.h"
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+static bool runFile(const char *path) {
+  FILE *f = fopen(path, "rb");
+  if (f == nullptr) {
+    printf("Cannot open %s\n", path);
+    return false;
+  }
+  std::vector<uint8_t> input;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) input.insert(input.end(), buf, buf + n);
+  fclose(f);
+  LLVMFuzzerTestOneInput(input.data(), input.size());
+  return true;
+}
+
+// A well-formed command, so mutations start close to the interesting paths
+static void appendCommand(std::vector<uint8_t> &input, std::mt19937 &rng) {
+  uint8_t buf[128];
+  WireWriter frame(buf, sizeof(buf));
+  frame.begin((uint8_t)(rng() % (CMD_COUNT + 1)));
+  int fields = (int)(rng() % 8);
+  for (int i = 0; i < fields; i++) {
+    uint8_t tag = (uint8_t)(rng() % (WIRE_TAG_STATE_VALUE + 2));
+    if (tag == WIRE_TAG_PASSWORD) frame.putString(tag, rng() % 2 ? "654321" : "x");
+    else frame.putInt(tag, (int32_t)(rng() % 40) - 4);
+  }
+  input.push_back((uint8_t)frame.size());
+  input.insert(input.end(), frame.data(), frame.data() + frame.size());
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1 && atoi(argv[1]) == 0) {
+    for (int i = 1; i < argc; i++) {
+      if (!runFile(argv[i])) return 1;
+    }
+    printf("%d inputs replayed\n", argc - 1);
+    return 0;
+  }
+
+  int iterations = argc > 1 ? atoi(argv[1]) : 20000;
+  std::mt19937 rng(12345);
+  std::vector<uint8_t> input;
+  for (int i = 0; i < iterations; i++) {
+    input.clear();
+    input.push_back((uint8_t)rng());
+    int commands = 1 + (int)(rng() % 12);
+    for (int c = 0; c < commands; c++) {
+      if (rng() % 8 == 0) {
+        input.push_back(0);  // Drain now
+        continue;
+      }
+      if (rng() % 4 == 0) {
+        int len = 1 + (int)(rng() % 64);  // Raw bytes
+        input.push_back((uint8_t)len);
+        for (int b = 0; b < len; b++) input.push_back((uint8_t)rng());
+      } else {
+        appendCommand(input, rng);
+      }
+    }
+    int flips = (int)(rng() % 4);
+    for (int f = 0; f < flips && input.size() > 1; f++) {
+      input[1 + rng() % (input.size() - 1)] ^= (uint8_t)(1u << (rng() % 8));
+    }
+    LLVMFuzzerTestOneInput(input.data(), input.size());
+  }
+  printf("%d fuzz iterations passed\n", iterations);
+  return 0;
+}
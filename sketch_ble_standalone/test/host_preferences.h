@@ -0,0 +1,433 @@
+/*
+ * Host implementation of the Arduino Preferences API the firmware uses
+ * (saveGameState / loadGameState through SnapshotStore, the legacy
+ * per-field keys, handleUpdateSettings), over a model of ESP-IDF NVS on
+ * the NOR flash emulator.
+ *
+ * The model follows NVS's layout and write pattern, not its byte format:
+ * 4 KB pages of a 32-byte header, a 2-bit-per-entry state bitmap and 126
+ * entries of 32 bytes. An item takes one entry (integers), one plus its
+ * data rounded up to entries (strings), or two plus its data (blobs: index
+ * and chunk header). Writing an item appends its entries to the active
+ * page, then flips their bitmap state to written; replacing or removing
+ * one flips the old entries to erased. A full page is closed and the next
+ * empty one opened; with only the reserved spare page left, the full page
+ * with the most erased entries is garbage collected: its live items are
+ * copied to the spare and it is erased. Setting a key to the value it
+ * already holds is a read, not a write, as in NVS.
+ *
+ * Every Preferences call is charged to a per-method NvsOpStats (calls,
+ * bytes programmed, sectors erased, bytes read, modeled time), so flash
+ * cost can be attributed to putBytes vs putInt vs remove.
+ *
+ * getString / putString use std::string where Arduino has String.
+ */
+
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "flash_emulator.h"
+
+#define NVS_PAGE_SIZE 4096
+#define NVS_ENTRY_SIZE 32
+#define NVS_PAGE_ENTRIES 126
+#define NVS_ENTRY_TABLE 64  // Page header + state bitmap
+#define NVS_KEY_MAX 15
+#define NVS_DEFAULT_SIZE 0x5000  // "nvs" in partitions.csv
+
+#define NVS_PAGE_ACTIVE 0xFFFFFFFEu
+#define NVS_PAGE_FULL 0xFFFFFFFCu
+#define NVS_PAGE_FREEING 0xFFFFFFF8u
+
+#define NVS_ENTRY_WRITTEN 0x2
+#define NVS_ENTRY_ERASED 0x0
+
+enum NvsType : uint8_t {
+  NVS_TYPE_U8 = 0x01,
+  NVS_TYPE_I32 = 0x14,
+  NVS_TYPE_STR = 0x21,
+  NVS_TYPE_BLOB = 0x42
+};
+
+struct NvsOpStats {
+  uint32_t calls = 0;
+  uint64_t programmed = 0;
+  uint64_t erases = 0;
+  uint64_t readBytes = 0;
+  double us = 0;
+};
+
+class NvsEmulator {
+public:
+  explicit NvsEmulator(uint32_t bytes = NVS_DEFAULT_SIZE)
+    : flash(bytes, NVS_PAGE_SIZE), pages(bytes / NVS_PAGE_SIZE), active(0), pageSeq(0), gcCount(0),
+      fullCount(0) {
+    openPage(0);
+  }
+
+  // Charges the flash activity of its lifetime to ops[name]
+  class Charge {
+  public:
+    Charge(NvsEmulator &nvs, const char *name)
+      : nvs(nvs), name(name), programmed(nvs.flash.programmed), erases(nvs.flash.totalErases()),
+        readBytes(nvs.flash.readBytes), us(nvs.flash.modeledUs()) {}
+    ~Charge() {
+      NvsOpStats &s = nvs.ops[name];
+      s.calls++;
+      s.programmed += nvs.flash.programmed - programmed;
+      s.erases += nvs.flash.totalErases() - erases;
+      s.readBytes += nvs.flash.readBytes - readBytes;
+      s.us += nvs.flash.modeledUs() - us;
+    }
+
+  private:
+    NvsEmulator &nvs;
+    const char *name;
+    uint64_t programmed;
+    uint64_t erases;
+    uint64_t readBytes;
+    double us;
+  };
+
+  // Namespace index, writing its entry the first time; 0 if it does not
+  // exist and create is false
+  uint8_t openNamespace(const char *name, bool create) {
+    auto it = namespaces.find(name);
+    if (it != namespaces.end()) return it->second;
+    if (!create || namespaces.size() >= 254) return 0;
+    uint8_t index = (uint8_t)(namespaces.size() + 1);
+    if (!set(0, name, NVS_TYPE_U8, &index, 1)) return 0;
+    namespaces[name] = index;
+    return index;
+  }
+
+  bool set(uint8_t ns, const char *key, uint8_t type, const void *data, size_t len) {
+    if (strlen(key) > NVS_KEY_MAX) return false;
+    const uint8_t *p = (const uint8_t *)data;
+    std::string id = itemId(ns, key);
+    auto it = items.find(id);
+    if (it != items.end()) {
+      readEntries(it->second);  // NVS compares before writing
+      if (it->second.type == type && it->second.value.size() == len && memcmp(it->second.value.data(), p, len) == 0) {
+        return true;
+      }
+    }
+    Item item;
+    item.ns = ns;
+    item.key = key;
+    item.type = type;
+    item.value.assign(p, p + len);
+    item.span = spanOf(type, len);
+    if (!allocate(item)) return false;
+    if (it != items.end()) {
+      retire(it->second);
+      it->second = item;
+    } else {
+      items[id] = item;
+    }
+    return true;
+  }
+
+  // Reads the item's entries from flash; null if absent
+  const std::vector<uint8_t> *get(uint8_t ns, const char *key, uint8_t type) {
+    auto it = items.find(itemId(ns, key));
+    if (it == items.end() || it->second.type != type) return nullptr;
+    readEntries(it->second);
+    return &it->second.value;
+  }
+
+  bool exists(uint8_t ns, const char *key) {
+    auto it = items.find(itemId(ns, key));
+    if (it == items.end()) return false;
+    uint8_t header[NVS_ENTRY_SIZE];
+    flash.read(entryAddr(it->second.page, it->second.entry), header, sizeof(header));
+    return true;
+  }
+
+  bool erase(uint8_t ns, const char *key) {
+    auto it = items.find(itemId(ns, key));
+    if (it == items.end()) return false;
+    retire(it->second);
+    items.erase(it);
+    return true;
+  }
+
+  bool eraseAll(uint8_t ns) {
+    for (auto it = items.begin(); it != items.end();) {
+      if (it->second.ns == ns) {
+        retire(it->second);
+        it = items.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    return true;
+  }
+
+  uint32_t liveEntries() const {
+    uint32_t n = 0;
+    for (const auto &kv : items) n += kv.second.span;
+    return n;
+  }
+  uint32_t pageCount() const { return (uint32_t)pages.size(); }
+  uint32_t collections() const { return gcCount; }  // Pages garbage collected
+  uint32_t outOfSpace() const { return fullCount; }  // Writes refused: no room even after GC
+
+  FlashEmulator flash;
+  std::map<std::string, NvsOpStats> ops;
+
+private:
+  struct Item {
+    uint8_t ns;
+    std::string key;
+    uint8_t type;
+    std::vector<uint8_t> value;
+    uint32_t span;
+    uint32_t page;
+    uint32_t entry;
+  };
+
+  enum PageState { PAGE_EMPTY, PAGE_OPEN, PAGE_CLOSED };
+
+  struct Page {
+    PageState state = PAGE_EMPTY;
+    uint32_t next = 0;    // First unused entry
+    uint32_t erased = 0;  // Entries retired
+  };
+
+  std::map<std::string, Item> items;
+  std::map<std::string, uint8_t> namespaces;
+  std::vector<Page> pages;
+  uint32_t active;
+  uint32_t pageSeq;
+  uint32_t gcCount;
+  uint32_t fullCount;
+
+  static std::string itemId(uint8_t ns, const char *key) { return std::string(1, (char)ns) + key; }
+
+  static uint32_t spanOf(uint8_t type, size_t len) {
+    uint32_t data = (uint32_t)((len + NVS_ENTRY_SIZE - 1) / NVS_ENTRY_SIZE);
+    if (type == NVS_TYPE_STR) return 1 + data;
+    if (type == NVS_TYPE_BLOB) return 2 + data;
+    return 1;
+  }
+
+  static uint32_t entryAddr(uint32_t page, uint32_t entry) {
+    return page * NVS_PAGE_SIZE + NVS_ENTRY_TABLE + entry * NVS_ENTRY_SIZE;
+  }
+
+  void openPage(uint32_t page) {
+    uint32_t header[NVS_ENTRY_SIZE / 4];
+    memset(header, 0xFF, sizeof(header));
+    header[0] = NVS_PAGE_ACTIVE;
+    header[1] = pageSeq++;
+    flash.write(page * NVS_PAGE_SIZE, header, sizeof(header));
+    pages[page] = Page();
+    pages[page].state = PAGE_OPEN;
+    active = page;
+  }
+
+  void setPageState(uint32_t page, uint32_t state) { flash.write(page * NVS_PAGE_SIZE, &state, sizeof(state)); }
+
+  // Rewrites the 32-bit bitmap words covering the range; bits only clear
+  void setEntryState(uint32_t page, uint32_t first, uint32_t count, uint8_t state) {
+    uint32_t word = first / 16;
+    uint32_t lastWord = (first + count - 1) / 16;
+    for (; word <= lastWord; word++) {
+      uint32_t addr = page * NVS_PAGE_SIZE + NVS_ENTRY_SIZE + word * 4;
+      uint32_t value;
+      memcpy(&value, &flash.mem[addr], 4);
+      for (uint32_t e = word * 16; e < word * 16 + 16; e++) {
+        if (e < first || e >= first + count) continue;
+        uint32_t shift = (e % 16) * 2;
+        value = (value & ~(3u << shift)) | ((uint32_t)state << shift);
+      }
+      flash.write(addr, &value, 4);
+    }
+  }
+
+  void program(const Item &item) {
+    std::vector<uint8_t> entries(item.span * NVS_ENTRY_SIZE, 0xFF);
+    entries[0] = item.ns;
+    entries[1] = item.type;
+    entries[2] = (uint8_t)item.span;
+    memcpy(&entries[8], item.key.c_str(), item.key.size() + 1);
+    if (item.span == 1) {
+      memcpy(&entries[24], item.value.data(), item.value.size() < 8 ? item.value.size() : 8);
+    } else {
+      uint32_t at = (item.type == NVS_TYPE_BLOB ? 2 : 1) * NVS_ENTRY_SIZE;
+      if (!item.value.empty()) memcpy(&entries[at], item.value.data(), item.value.size());
+    }
+    flash.write(entryAddr(item.page, item.entry), entries.data(), (uint32_t)entries.size());
+    setEntryState(item.page, item.entry, item.span, NVS_ENTRY_WRITTEN);
+  }
+
+  void readEntries(const Item &item) {
+    std::vector<uint8_t> buf(item.span * NVS_ENTRY_SIZE);
+    flash.read(entryAddr(item.page, item.entry), buf.data(), (uint32_t)buf.size());
+  }
+
+  void retire(const Item &item) {
+    setEntryState(item.page, item.entry, item.span, NVS_ENTRY_ERASED);
+    pages[item.page].erased += item.span;
+  }
+
+  bool allocate(Item &item) {
+    if (item.span > NVS_PAGE_ENTRIES) return false;
+    for (uint32_t tries = 0; pages[active].next + item.span > NVS_PAGE_ENTRIES; tries++) {
+      if (tries == pages.size() || !advance()) {
+        fullCount++;
+        return false;
+      }
+    }
+    item.page = active;
+    item.entry = pages[active].next;
+    pages[active].next += item.span;
+    program(item);
+    return true;
+  }
+
+  // Closes the active page and opens an empty one, keeping one spare for
+  // garbage collection
+  bool advance() {
+    uint32_t empty = 0, spare = 0;
+    for (uint32_t p = 0; p < pages.size(); p++) {
+      if (pages[p].state == PAGE_EMPTY) {
+        if (empty++ == 0) spare = p;
+      }
+    }
+    if (empty > 1) {
+      closeActive();
+      openPage(spare);
+      return true;
+    }
+    return collect(spare, empty == 1);
+  }
+
+  void closeActive() {
+    setPageState(active, NVS_PAGE_FULL);
+    pages[active].state = PAGE_CLOSED;
+  }
+
+  // Moves the live items of the closed page with the most erased entries
+  // to the spare page, then erases it
+  bool collect(uint32_t spare, bool haveSpare) {
+    if (!haveSpare) return false;
+    int victim = -1;
+    for (uint32_t p = 0; p < pages.size(); p++) {
+      if (p == active || pages[p].state != PAGE_CLOSED || pages[p].erased == 0) continue;
+      if (victim < 0 || pages[p].erased > pages[victim].erased) victim = (int)p;
+    }
+    if (victim < 0 && pages[active].erased > 0) victim = (int)active;
+    if (victim < 0) return false;
+    closeActive();
+    openPage(spare);
+    setPageState((uint32_t)victim, NVS_PAGE_FREEING);
+    for (auto &kv : items) {
+      Item &item = kv.second;
+      if (item.page != (uint32_t)victim) continue;
+      readEntries(item);
+      item.page = active;
+      item.entry = pages[active].next;
+      pages[active].next += item.span;
+      program(item);
+    }
+    flash.erase((uint32_t)victim * NVS_PAGE_SIZE);
+    pages[victim] = Page();
+    gcCount++;
+    return true;
+  }
+};
+
+class Preferences {
+public:
+  explicit Preferences(NvsEmulator &nvs) : nvs(nvs), ns(0), readOnly(true) {}
+
+  bool begin(const char *name, bool readOnlyMode = false) {
+    NvsEmulator::Charge charge(nvs, "begin");
+    ns = nvs.openNamespace(name, !readOnlyMode);
+    readOnly = readOnlyMode;
+    return ns != 0;
+  }
+  void end() { ns = 0; }
+
+  bool clear() {
+    NvsEmulator::Charge charge(nvs, "clear");
+    return writable() && nvs.eraseAll(ns);
+  }
+  bool remove(const char *key) {
+    NvsEmulator::Charge charge(nvs, "remove");
+    return writable() && nvs.erase(ns, key);
+  }
+  bool isKey(const char *key) {
+    NvsEmulator::Charge charge(nvs, "isKey");
+    return ns && nvs.exists(ns, key);
+  }
+
+  size_t putInt(const char *key, int32_t value) {
+    NvsEmulator::Charge charge(nvs, "putInt");
+    return put(key, NVS_TYPE_I32, &value, sizeof(value)) ? sizeof(value) : 0;
+  }
+  size_t putBool(const char *key, bool value) {
+    NvsEmulator::Charge charge(nvs, "putBool");
+    uint8_t v = value ? 1 : 0;
+    return put(key, NVS_TYPE_U8, &v, 1) ? 1 : 0;
+  }
+  size_t putString(const char *key, const std::string &value) {
+    NvsEmulator::Charge charge(nvs, "putString");
+    return put(key, NVS_TYPE_STR, value.c_str(), value.size() + 1) ? value.size() : 0;
+  }
+  size_t putBytes(const char *key, const void *value, size_t len) {
+    NvsEmulator::Charge charge(nvs, "putBytes");
+    return put(key, NVS_TYPE_BLOB, value, len) ? len : 0;
+  }
+
+  int32_t getInt(const char *key, int32_t defaultValue = 0) {
+    NvsEmulator::Charge charge(nvs, "getInt");
+    const std::vector<uint8_t> *v = ns ? nvs.get(ns, key, NVS_TYPE_I32) : nullptr;
+    if (!v) return defaultValue;
+    int32_t value;
+    memcpy(&value, v->data(), sizeof(value));
+    return value;
+  }
+  bool getBool(const char *key, bool defaultValue = false) {
+    NvsEmulator::Charge charge(nvs, "getBool");
+    const std::vector<uint8_t> *v = ns ? nvs.get(ns, key, NVS_TYPE_U8) : nullptr;
+    return v ? (*v)[0] != 0 : defaultValue;
+  }
+  std::string getString(const char *key, const std::string &defaultValue = std::string()) {
+    NvsEmulator::Charge charge(nvs, "getString");
+    const std::vector<uint8_t> *v = ns ? nvs.get(ns, key, NVS_TYPE_STR) : nullptr;
+    return v ? std::string((const char *)v->data()) : defaultValue;
+  }
+  size_t getBytesLength(const char *key) {
+    NvsEmulator::Charge charge(nvs, "getBytesLength");
+    const std::vector<uint8_t> *v = ns ? nvs.get(ns, key, NVS_TYPE_BLOB) : nullptr;
+    return v ? v->size() : 0;
+  }
+  size_t getBytes(const char *key, void *buf, size_t maxLen) {
+    NvsEmulator::Charge charge(nvs, "getBytes");
+    const std::vector<uint8_t> *v = ns ? nvs.get(ns, key, NVS_TYPE_BLOB) : nullptr;
+    if (!v || v->size() > maxLen) return 0;
+    memcpy(buf, v->data(), v->size());
+    return v->size();
+  }
+
+private:
+  NvsEmulator &nvs;
+  uint8_t ns;
+  bool readOnly;
+
+  bool writable() const { return ns && !readOnly; }
+  bool put(const char *key, uint8_t type, const void *data, size_t len) {
+    return writable() && nvs.set(ns, key, type, data, len);
+  }
+};
+
+#endif // HOST_PREFERENCES_H
@@ -0,0 +1,159 @@
+/*
+ * Simulated MCP23017 + GPIO Hall sensor board for host tests.
+ *
+ * Implements HallSensorBus on a virtual clock. Time only moves through
+ * waitMs(), advanceMs() and the modeled cost of each bus transaction, so a
+ * benchmark can measure detection latency deterministically.
+ *
+ * Fault model:
+ *  - scripted coin placements / removals per tile
+ *  - magnet bounce: sensor chatters for bounceUs after every transition
+ *  - glitches: a sensor without a coin reads LOW with probability glitchRate
+ *  - stuck pins: a tile forced LOW or HIGH regardless of coins
+ *  - I2C NACKs: random (nackRate) or inside scripted windows
+ */
+
+#ifndef SIM_HALL_BUS_H
+#define SIM_HALL_BUS_H
+
+#include "hall_sensors.h"
+#include <random>
+#include <vector>
+
+class SimHallBus : public HallSensorBus {
+public:
+  uint64_t nowUs = 0;
+
+  // Cost model (100 kHz I2C: write addr+reg, restart, read addr+2 bytes)
+  uint32_t i2cReadUs = 450;
+  uint32_t gpioReadUs = 1;
+
+  // Noise model
+  uint32_t bounceUs = 0;
+  double glitchRate = 0.0;
+  double nackRate = 0.0;
+
+  // Counters
+  uint32_t expanderReads = 0;
+  uint32_t nacks = 0;
+
+  explicit SimHallBus(uint32_t seed = 1) : rng(seed) {
+    for (int t = 0; t < NUM_TILES; t++) {
+      stuck[t] = -1;
+    }
+  }
+
+  void placeCoin(int tile, uint64_t atUs) { addEvent(tile, atUs, true); }
+  void removeCoin(int tile, uint64_t atUs) { addEvent(tile, atUs, false); }
+
+  // level: 0 = stuck LOW (reads as magnet), 1 = stuck HIGH, -1 = release
+  void stickTile(int tile, int level) { stuck[tile - 1] = level; }
+
+  void nackBetween(uint64_t fromUs, uint64_t toUs) {
+    nackWindows.push_back(Window{fromUs, toUs});
+  }
+
+  void clearScript() {
+    for (int t = 0; t < NUM_TILES; t++) {
+      events[t].clear();
+      stuck[t] = -1;
+    }
+    nackWindows.clear();
+  }
+
+  void advanceMs(uint32_t ms) { nowUs += (uint64_t)ms * 1000; }
+  uint32_t nowMs() const { return (uint32_t)(nowUs / 1000); }
+
+  bool readExpander(uint16_t &gpioAB) override {
+    nowUs += i2cReadUs;
+    expanderReads++;
+    if (inNackWindow() || (nackRate > 0 && chance(nackRate))) {
+      nacks++;
+      return false;
+    }
+    uint16_t bits = 0xFFFF;
+    for (uint8_t j = 0; j < 8; j++) {
+      if (sensorLow(MCP_PORTA_TILES[j])) bits &= ~(1u << j);
+      if (sensorLow(MCP_PORTB_TILES[j])) bits &= ~(1u << (j + 8));
+    }
+    gpioAB = bits;
+    return true;
+  }
+
+  int readDirect(uint8_t pin) override {
+    nowUs += gpioReadUs;
+    for (uint8_t j = 0; j < 4; j++) {
+      if (DIRECT_GPIO_PINS[j] == pin) {
+        return sensorLow(DIRECT_GPIO_TILES[j]) ? 0 : 1;
+      }
+    }
+    return 1;  // Unwired pin floats HIGH on its pull-up
+  }
+
+  void waitMs(uint32_t ms) override { advanceMs(ms); }
+
+  // Ground truth (ignores noise) for scoring detections
+  bool coinOn(int tile) const {
+    bool present = false;
+    for (const Event &e : events[tile - 1]) {
+      if (e.atUs > nowUs) break;
+      present = e.present;
+    }
+    return present;
+  }
+
+private:
+  struct Event {
+    uint64_t atUs;
+    bool present;
+  };
+  struct Window {
+    uint64_t fromUs;
+    uint64_t toUs;
+  };
+
+  std::mt19937 rng;
+  std::vector<Event> events[NUM_TILES];
+  std::vector<Window> nackWindows;
+  int stuck[NUM_TILES];
+
+  void addEvent(int tile, uint64_t atUs, bool present) {
+    std::vector<Event> &list = events[tile - 1];
+    auto it = list.begin();
+    while (it != list.end() && it->atUs <= atUs) ++it;
+    list.insert(it, Event{atUs, present});
+  }
+
+  bool chance(double p) {
+    return std::uniform_real_distribution<double>(0.0, 1.0)(rng) < p;
+  }
+
+  bool inNackWindow() const {
+    for (const Window &w : nackWindows) {
+      if (nowUs >= w.fromUs && nowUs < w.toUs) return true;
+    }
+    return false;
+  }
+
+  bool sensorLow(int tile) {
+    if (stuck[tile - 1] >= 0) {
+      return stuck[tile - 1] == 0;
+    }
+    bool present = false;
+    bool changed = false;
+    uint64_t lastChange = 0;
+    for (const Event &e : events[tile - 1]) {
+      if (e.atUs > nowUs) break;
+      present = e.present;
+      lastChange = e.atUs;
+      changed = true;
+    }
+    if (changed && bounceUs > 0 && nowUs - lastChange < bounceUs) {
+      return chance(0.5);
+    }
+    if (present) return true;
+    return glitchRate > 0 && chance(glitchRate);
+  }
+};
+
+#endif // SIM_HALL_BUS_H
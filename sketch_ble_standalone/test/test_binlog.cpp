@@ -0,0 +1,165 @@
+/*
+ * Host tests for binlog.h: records survive the ring and the "$B" line
+ * encoding, levels filter at compile time, and concurrent producers lose
+ * nothing that was not counted as dropped.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+static uint32_t fakeMicros = 0;
+
+#define BINLOG_MICROS() fakeMicros
+#define BINLOG_LEVEL LOG_LEVEL_INFO
+#include "binlog.h"
+#include "check.h"
+
+static_assert(logFormatArgs("100%% of %d") == 1, "%% is not a conversion");
+static_assert(logFormatArgs(LOG_FORMATS[LOG_HALL_RESULT]) == 6, "Hall result takes 6 args");
+
+static void testRoundTrip() {
+  BinLog<8> log;
+  fakeMicros = 12345678;
+  log.log<LOG_GODICE_STABLE>(4, -12, 3, 60);
+  LogRecord rec;
+  CHECK(log.pop(rec));
+  CHECK(rec.id == LOG_GODICE_STABLE && rec.argc == 4 && rec.timestampUs == 12345678);
+  CHECK(rec.args[1] == -12);
+  CHECK(!log.pop(rec));
+
+  char line[LOG_LINE_MAX];
+  uint32_t len = encodeLogLine(rec, line, sizeof(line));
+  CHECK(len > 0 && strncmp(line, "$B", 2) == 0 && strlen(line) == len);
+  CHECK(len == 2 + 2 * (7 + 4 * 4));
+
+  LogRecord back;
+  CHECK(decodeLogLine(line, back));
+  CHECK(back.id == rec.id && back.argc == 4 && back.timestampUs == rec.timestampUs);
+  CHECK(memcmp(back.args, rec.args, 4 * sizeof(int32_t)) == 0);
+
+  char text[128];
+  formatLogRecord(back, text, sizeof(text));
+  CHECK(strcmp(text, "GoDice stable: 4 (xyz: -12,3,60)") == 0);
+
+  // Trailing newline from the Serial capture is fine
+  strcat(line, "\r\n");
+  CHECK(decodeLogLine(line, back));
+}
+
+static void testLevelFilter() {
+  BinLog<8> log;
+  LogRecord rec;
+  log.log<LOG_HALL_RESULT>(5, 'M', 3, 3, 3, 1);  // DEBUG, below BINLOG_LEVEL
+  CHECK(!log.pop(rec));
+  CHECK(log.logged() == 0);
+  log.log<LOG_HALL_INVALID_TILE>(99);  // WARN
+  CHECK(log.pop(rec) && rec.id == LOG_HALL_INVALID_TILE);
+}
+
+static void testFormats() {
+  // Every catalog entry formats with zeros and stays within LOG_MAX_ARGS
+  for (int id = 0; id < LOG_MSG_COUNT; id++) {
+    CHECK(logFormatArgs(LOG_FORMATS[id]) <= LOG_MAX_ARGS);
+    LogRecord rec = {(uint16_t)id, (uint8_t)logFormatArgs(LOG_FORMATS[id]), 0, {0}};
+    char text[128];
+    CHECK(formatLogRecord(rec, text, sizeof(text)) > 0);
+  }
+  LogRecord hall = {LOG_HALL_RESULT, 6, 0, {7, 'G', 12, 2, 3, 0}};
+  char text[128];
+  formatLogRecord(hall, text, sizeof(text));
+  CHECK(strcmp(text, "[Hall] Tile 7 (G12) result: 2/3 readings LOW, coin 0") == 0);
+}
+
+static void testMalformedLines() {
+  LogRecord rec;
+  CHECK(!decodeLogLine("hello", rec));
+  CHECK(!decodeLogLine("$B", rec));
+  CHECK(!decodeLogLine("$B0100", rec));                          // Truncated header
+  CHECK(!decodeLogLine("$B0400000000000Z", rec));                // Not hex
+  CHECK(!decodeLogLine("$B04000000000001", rec));                // argc 1, no arg
+  CHECK(!decodeLogLine("$B0400000000000100000000FF", rec));      // Extra byte
+  CHECK(decodeLogLine("$B0400000000000163000000", rec) && rec.args[0] == 99);
+}
+
+static void testFullRing() {
+  BinLog<4> log;
+  for (int i = 0; i < 6; i++) log.log<LOG_HALL_INVALID_TILE>(i);
+  CHECK(log.takeDropped() == 2);
+  CHECK(log.takeDropped() == 0);
+  LogRecord rec;
+  for (int i = 0; i < 4; i++) CHECK(log.pop(rec) && rec.args[0] == i);  // Oldest kept
+  CHECK(!log.pop(rec));
+  log.log<LOG_HALL_INVALID_TILE>(42);  // Slots are reused after pop
+  CHECK(log.pop(rec) && rec.args[0] == 42);
+}
+
+// Several producers against one consumer; producers retry when the ring is
+// full, so every record must arrive exactly once and in order per producer
+static void testConcurrentProducers() {
+  static BinLog<64> log;
+  const int producers = 4;
+  const int perProducer = 5000;
+  std::atomic<int> running(producers);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; p++) {
+    threads.emplace_back([p, &running]() {
+      for (int i = 0; i < perProducer; i++) {
+        const int32_t args[] = {p, i};
+        while (!log.push(LOG_GODICE_STABLE, 0, args, 2)) std::this_thread::yield();  // Retry drops
+      }
+      running--;
+    });
+  }
+
+  int next[producers] = {0};
+  uint32_t received = 0;
+  bool ordered = true;
+  LogRecord rec;
+  for (;;) {
+    bool finished = running == 0;  // Before the pop, so an empty ring is final
+    if (log.pop(rec)) {
+      int p = rec.args[0];
+      if (p < 0 || p >= producers || rec.args[1] < next[p]) ordered = false;
+      else next[p] = rec.args[1] + 1;
+      received++;
+    } else if (finished) {
+      break;
+    }
+  }
+  for (auto &t : threads) t.join();
+  uint32_t dropped = log.takeDropped();
+  CHECK(ordered);
+  CHECK(received == (uint32_t)(producers * perProducer));
+  CHECK(log.logged() == received);
+  for (int p = 0; p < producers; p++) CHECK(next[p] == perProducer);
+
+  // Push cost, for reference
+  BinLog<1024> timing;
+  LogRecord sink;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 1000; i++) {
+    timing.log<LOG_HALL_INVALID_TILE>(i);
+    timing.pop(sink);
+  }
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / 1000;
+  printf("binlog: %u received, %u full-ring retries, %.0f ns per push+pop\n", received, dropped, ns);
+}
+
+int main() {
+  testRoundTrip();
+  testLevelFilter();
+  testFormats();
+  testMalformedLines();
+  testFullRing();
+  testConcurrentProducers();
+
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("binlog tests passed\n");
+  return 0;
+}
@@ -0,0 +1,271 @@
+/*
+ * Host tests for ble_framing.h: fragmenting at several MTUs, reassembly,
+ * the receiver's handling of lost / reordered / interleaved fragments, and
+ * the sender resuming after congestion.
+ */
+
+#include "ble_framing.h"
+#include "check.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+typedef std::vector<uint8_t> Bytes;
+
+static Bytes makeMessage(uint32_t len, uint8_t seed) {
+  Bytes msg(len);
+  for (uint32_t i = 0; i < len; i++) msg[i] = (uint8_t)(seed + i * 7);
+  if (len > 0) msg[0] = '{';  // Like a JSON document
+  return msg;
+}
+
+static std::vector<Bytes> fragment(const Bytes &msg, uint32_t payload, uint8_t seq) {
+  std::vector<Bytes> out;
+  FragmentWriter writer;
+  if (!writer.begin(msg.data(), (uint32_t)msg.size(), payload, seq)) return out;
+  uint8_t buf[600];
+  uint32_t len = 0;
+  while (writer.next(buf, len)) out.push_back(Bytes(buf, buf + len));
+  CHECK(out.size() == writer.fragmentCount());
+  return out;
+}
+
+static void testRoundTripAtMtus() {
+  const uint16_t mtus[] = {23, 27, 185, 247, 515};
+  const uint32_t lengths[] = {1, 19, 20, 21, 100, 768, 2048, 4000};
+  Reassembler<4096> rx;
+  uint8_t seq = 0;
+  for (uint16_t mtu : mtus) {
+    uint32_t payload = notifyPayloadSize(mtu);
+    for (uint32_t len : lengths) {
+      Bytes msg = makeMessage(len, (uint8_t)len);
+      std::vector<Bytes> frags = fragment(msg, payload, seq++);
+      CHECK(!frags.empty());
+      for (size_t i = 0; i < frags.size(); i++) {
+        CHECK(frags[i].size() <= payload);
+        ReassemblyResult r = rx.feed(frags[i].data(), (uint32_t)frags[i].size());
+        CHECK(r == (i + 1 == frags.size() ? REASM_COMPLETE : REASM_PENDING));
+      }
+      CHECK(rx.length() == len);
+      CHECK(rx.message() != nullptr && memcmp(rx.message(), msg.data(), len) == 0);
+      // Fits -> sent untouched in one notification
+      CHECK((len <= payload) == (frags.size() == 1 && frags[0] == msg));
+    }
+  }
+  CHECK(rx.errorCount() == 0);
+}
+
+static void testEfficiency() {
+  // Header overhead on a large status report, against the ATT payload limit
+  const uint32_t len = 2048;
+  const uint16_t mtus[] = {23, 185, 515};
+  printf("framing a %u-byte message:\n", len);
+  for (uint16_t mtu : mtus) {
+    uint32_t payload = notifyPayloadSize(mtu);
+    std::vector<Bytes> frags = fragment(makeMessage(len, 1), payload, 0);
+    uint32_t sent = 0;
+    for (const Bytes &f : frags) sent += (uint32_t)f.size();
+    uint32_t minimum = (len + payload - 1) / payload;
+    double efficiency = (double)len / sent;
+    printf("  MTU %3u: %3zu notifications (unframed minimum %u), %.1f%% payload efficiency\n",
+           mtu, frags.size(), minimum, efficiency * 100);
+    CHECK(efficiency > (mtu >= 185 ? 0.98 : 0.8));
+  }
+}
+
+static void testMarkerStartIsFragmented() {
+  // A short message starting with the marker byte must not be mistaken
+  // for a fragment, so it is framed even though it fits
+  Bytes msg = {0xF1, 'x', 'y'};
+  std::vector<Bytes> frags = fragment(msg, 20, 9);
+  CHECK(frags.size() == 1 && frags[0].size() == FRAG_HEADER_SIZE + FRAG_LENGTH_SIZE + 3);
+  Reassembler<64> rx;
+  CHECK(rx.feed(frags[0].data(), (uint32_t)frags[0].size()) == REASM_COMPLETE);
+  CHECK(rx.length() == 3 && memcmp(rx.message(), msg.data(), 3) == 0);
+}
+
+static void testWriterLimits() {
+  FragmentWriter writer;
+  Bytes big(FRAG_MAX_MESSAGE + 1, 'a');
+  CHECK(!writer.begin(big.data(), (uint32_t)big.size(), 512, 0));
+  // 256 fragments of a 20-byte payload hold about 4.3 KB
+  Bytes tooMany(20 * 256, 'a');
+  CHECK(!writer.begin(tooMany.data(), (uint32_t)tooMany.size(), 20, 0));
+  Bytes msg(30, 'a');
+  CHECK(!writer.begin(msg.data(), (uint32_t)msg.size(), FRAG_HEADER_SIZE + FRAG_LENGTH_SIZE, 0));
+  uint8_t buf[32];
+  uint32_t len;
+  CHECK(!writer.next(buf, len));
+  CHECK(!writer.begin(msg.data(), 0, 20, 0));
+  CHECK(!writer.next(buf, len));
+}
+
+static void testLossAndReorder() {
+  Bytes msg = makeMessage(200, 3);
+  std::vector<Bytes> frags = fragment(msg, 20, 5);
+  CHECK(frags.size() > 3);
+
+  // Lost middle fragment
+  Reassembler<512> rx;
+  CHECK(rx.feed(frags[0].data(), (uint32_t)frags[0].size()) == REASM_PENDING);
+  CHECK(rx.feed(frags[2].data(), (uint32_t)frags[2].size()) == REASM_ERROR);
+  CHECK(!rx.inProgress());
+  // The rest of that message is rejected rather than half-assembled
+  for (size_t i = 3; i < frags.size(); i++) {
+    CHECK(rx.feed(frags[i].data(), (uint32_t)frags[i].size()) == REASM_ERROR);
+  }
+
+  // Next message still assembles
+  Bytes next = makeMessage(90, 4);
+  std::vector<Bytes> nextFrags = fragment(next, 20, 6);
+  ReassemblyResult r = REASM_PENDING;
+  for (const Bytes &f : nextFrags) r = rx.feed(f.data(), (uint32_t)f.size());
+  CHECK(r == REASM_COMPLETE && rx.length() == 90);
+
+  // Lost first fragment
+  Reassembler<512> rx2;
+  CHECK(rx2.feed(frags[1].data(), (uint32_t)frags[1].size()) == REASM_ERROR);
+
+  // Lost last fragment, then a new message starts: old one is dropped
+  Reassembler<512> rx3;
+  for (size_t i = 0; i + 1 < frags.size(); i++) {
+    CHECK(rx3.feed(frags[i].data(), (uint32_t)frags[i].size()) == REASM_PENDING);
+  }
+  for (const Bytes &f : nextFrags) r = rx3.feed(f.data(), (uint32_t)f.size());
+  CHECK(r == REASM_COMPLETE && rx3.length() == 90 && memcmp(rx3.message(), next.data(), 90) == 0);
+  CHECK(rx3.errorCount() == 1);
+
+  // Fragment from another message interleaved
+  Reassembler<512> rx4;
+  CHECK(rx4.feed(frags[0].data(), (uint32_t)frags[0].size()) == REASM_PENDING);
+  CHECK(rx4.feed(nextFrags[1].data(), (uint32_t)nextFrags[1].size()) == REASM_ERROR);
+
+  // Whole message arrives in the middle of a fragmented one
+  Reassembler<512> rx5;
+  CHECK(rx5.feed(frags[0].data(), (uint32_t)frags[0].size()) == REASM_PENDING);
+  const uint8_t whole[] = "{\"event\":\"heartbeat\"}";
+  CHECK(rx5.feed(whole, sizeof(whole) - 1) == REASM_COMPLETE);
+  CHECK(rx5.message() == whole);  // Passed through without copying
+  CHECK(rx5.errorCount() == 1);
+}
+
+static void testMalformed() {
+  Reassembler<64> rx;
+  // Declared length larger than the receive buffer
+  const uint8_t huge[] = {FRAG_MARKER | FRAG_FIRST, 0, 0, 0xFF, 0x00, 'a'};
+  CHECK(rx.feed(huge, sizeof(huge)) == REASM_ERROR);
+  // More data than declared
+  const uint8_t over[] = {FRAG_MARKER | FRAG_FIRST | FRAG_LAST, 0, 0, 2, 0, 'a', 'b', 'c'};
+  CHECK(rx.feed(over, sizeof(over)) == REASM_ERROR);
+  // Less data than declared on the last fragment
+  const uint8_t under[] = {FRAG_MARKER | FRAG_FIRST | FRAG_LAST, 0, 0, 4, 0, 'a'};
+  CHECK(rx.feed(under, sizeof(under)) == REASM_ERROR);
+  // First fragment with a non-zero index, and truncated headers
+  const uint8_t badIndex[] = {FRAG_MARKER | FRAG_FIRST, 0, 1, 1, 0, 'a'};
+  CHECK(rx.feed(badIndex, sizeof(badIndex)) == REASM_ERROR);
+  const uint8_t shortHeader[] = {FRAG_MARKER | FRAG_FIRST, 0};
+  CHECK(rx.feed(shortHeader, sizeof(shortHeader)) == REASM_ERROR);
+  const uint8_t noLength[] = {FRAG_MARKER | FRAG_FIRST, 0, 0, 1};
+  CHECK(rx.feed(noLength, sizeof(noLength)) == REASM_ERROR);
+  CHECK(rx.feed(nullptr, 0) == REASM_ERROR);
+  CHECK(rx.completedCount() == 0);
+}
+
+// A link that takes notifications while open and hands them to a receiver
+struct FakeLink {
+  bool open = true;
+  int acceptBeforeClosing = -1;  // Close after this many more, -1: never
+  Reassembler<4096> rx;
+  std::vector<Bytes> received;
+
+  bool operator()(const uint8_t *data, uint32_t len) {
+    if (!open) return false;
+    if (acceptBeforeClosing == 0) {
+      open = false;
+      return false;
+    }
+    if (acceptBeforeClosing > 0) acceptBeforeClosing--;
+    if (rx.feed(data, len) == REASM_COMPLETE) received.push_back(Bytes(rx.message(), rx.message() + rx.length()));
+    return true;
+  }
+};
+
+static void testSenderResumesAfterCongestion() {
+  NotifySender<4096> sender(500);
+  FakeLink link;
+  uint8_t fragment[64];
+  const uint32_t payload = notifyPayloadSize(23);
+  std::vector<Bytes> sent = {makeMessage(300, 1), makeMessage(10, 2), makeMessage(120, 3)};
+
+  // Congested after three fragments of the first message: nothing blocks,
+  // and the caller's buffer may be reused at once
+  link.acceptBeforeClosing = 3;
+  Bytes scratch = sent[0];
+  CHECK(sender.send(scratch.data(), (uint32_t)scratch.size(), payload, 0, fragment, 0, link) == NOTIFY_QUEUED);
+  memset(scratch.data(), 0, scratch.size());
+  CHECK(sender.send(sent[1].data(), (uint32_t)sent[1].size(), payload, 1, fragment, 1, link) == NOTIFY_QUEUED);
+  CHECK(sender.send(sent[2].data(), (uint32_t)sent[2].size(), payload, 2, fragment, 2, link) == NOTIFY_QUEUED);
+  CHECK(!sender.idle() && link.received.empty());
+  CHECK(!sender.pump(fragment, 10, link));
+
+  // Clears: everything goes out in order, the refused fragment once
+  link.open = true;
+  link.acceptBeforeClosing = -1;
+  CHECK(sender.pump(fragment, 20, link));
+  CHECK(sender.idle());
+  CHECK(link.received == sent);
+  CHECK(link.rx.errorCount() == 0);
+  CHECK(sender.refusals() == 4 && sender.dropped() == 0);  // Offered once per send or pump
+
+  // Nothing waiting: straight through
+  CHECK(sender.send(sent[1].data(), (uint32_t)sent[1].size(), payload, 3, fragment, 30, link) == NOTIFY_SENT);
+  CHECK(link.received.size() == 4);
+}
+
+static void testSenderDrops() {
+  NotifySender<256> sender(500);
+  FakeLink link;
+  uint8_t fragment[64];
+  const uint32_t payload = notifyPayloadSize(23);
+  Bytes small = makeMessage(100, 4), big = makeMessage(200, 5);
+
+  link.open = false;
+  CHECK(sender.send(small.data(), (uint32_t)small.size(), payload, 0, fragment, 0, link) == NOTIFY_QUEUED);
+  CHECK(sender.send(big.data(), (uint32_t)big.size(), payload, 1, fragment, 0, link) == NOTIFY_BACKLOG_FULL);
+  Bytes huge(FRAG_MAX_MESSAGE + 1, '{');
+  CHECK(sender.send(huge.data(), (uint32_t)huge.size(), payload, 2, fragment, 0, link) == NOTIFY_UNFRAMEABLE);
+  CHECK(sender.dropped() == 2);
+
+  // A link that never clears gives the message up, not the sender
+  CHECK(!sender.pump(fragment, 500, link));
+  CHECK(sender.pump(fragment, 501, link));
+  CHECK(sender.idle() && sender.dropped() == 3);
+
+  link.open = true;
+  CHECK(sender.send(small.data(), (uint32_t)small.size(), payload, 3, fragment, 600, link) == NOTIFY_SENT);
+  CHECK(link.received.size() == 1 && link.received[0] == small);
+
+  // reset() forgets a half-sent message
+  link.acceptBeforeClosing = 1;
+  CHECK(sender.send(small.data(), (uint32_t)small.size(), payload, 4, fragment, 700, link) == NOTIFY_QUEUED);
+  sender.reset();
+  CHECK(sender.idle());
+}
+
+int main() {
+  testRoundTripAtMtus();
+  testEfficiency();
+  testMarkerStartIsFragmented();
+  testWriterLimits();
+  testLossAndReorder();
+  testMalformed();
+  testSenderResumesAfterCongestion();
+  testSenderDrops();
+
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("ble framing tests passed\n");
+  return 0;
+}
@@ -0,0 +1,288 @@
+/*
+ * Host tests for command_layer.h through the host board (command_host.h):
+ * pairing gate, wire negotiation, argument validation and malformed input,
+ * with every response checked to fit the negotiated MTU and reassemble.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include "command_host.h"
+#include "check.h"
+
+// The app's side: reassemble everything notified since the last call
+static std::vector<std::string> received(HostBoard &board) {
+  static Reassembler<2048> app;
+  std::vector<std::string> messages;
+  uint32_t payload = notifyPayloadSize(board.mtu);
+  for (const std::vector<uint8_t> &n : board.characteristic.sent) {
+    CHECK(n.size() <= payload);
+    ReassemblyResult r = app.feed(n.data(), (uint32_t)n.size());
+    CHECK(r != REASM_ERROR);
+    if (r == REASM_COMPLETE) messages.push_back(std::string((const char *)app.message(), app.length()));
+  }
+  board.characteristic.clear();
+  return messages;
+}
+
+static void sendFrame(HostBoard &board, const WireWriter &frame) {
+  CHECK(board.write(frame.data(), frame.size()) == CMD_PUSH_OK);
+  board.drain();
+}
+
+static void pairBinary(HostBoard &board, const char *password) {
+  uint8_t buf[64];
+  WireWriter frame(buf, sizeof(buf));
+  frame.begin(CMD_PAIR);
+  frame.putString(WIRE_TAG_PASSWORD, password);
+  sendFrame(board, frame);
+}
+
+static void writeRoll(HostBoard &board, int playerId, int diceValue, int64_t requestId = -1) {
+  uint8_t buf[32];
+  WireWriter frame(buf, sizeof(buf));
+  frame.begin(CMD_ROLL);
+  frame.putInt(WIRE_TAG_PLAYER_ID, playerId);
+  frame.putInt(WIRE_TAG_DICE_VALUE, diceValue);
+  if (requestId >= 0) frame.putInt(WIRE_TAG_REQUEST_ID, (int32_t)requestId);
+  CHECK(board.write(frame.data(), frame.size()) == CMD_PUSH_OK);
+}
+
+static void writeCommand(HostBoard &board, CommandId id, uint32_t requestId) {
+  uint8_t buf[16];
+  WireWriter frame(buf, sizeof(buf));
+  frame.begin(id);
+  frame.putInt(WIRE_TAG_REQUEST_ID, (int32_t)requestId);
+  CHECK(board.write(frame.data(), frame.size()) == CMD_PUSH_OK);
+}
+
+static void roll(HostBoard &board, int playerId, int diceValue) {
+  writeRoll(board, playerId, diceValue);
+  board.drain();
+}
+
+static bool contains(const std::string &s, const char *part) {
+  return s.find(part) != std::string::npos;
+}
+
+static void testPairingGate() {
+  HostBoard board;
+  roll(board, 0, 3);
+  std::vector<std::string> out = received(board);
+  CHECK(out.size() == 1);
+  CHECK(out.size() == 1 && contains(out[0], "pairing required"));
+  CHECK(board.tiles[0] == 1);
+
+  pairBinary(board, "000000");
+  out = received(board);
+  CHECK(out.size() == 1 && contains(out[0], "pair_failed"));
+  CHECK(!board.isPaired);
+}
+
+static void testBinaryNegotiation() {
+  HostBoard board;
+  pairBinary(board, "654321");
+  std::vector<std::string> out = received(board);
+  CHECK(out.size() == 1 && contains(out[0], "\"wire\":1"));
+  CHECK(board.wireVersion == WIRE_VERSION);
+
+  roll(board, 1, 4);
+  out = received(board);
+  CHECK(out.size() == 1);
+  if (out.size() == 1) {
+    WireReader reader((const uint8_t *)out[0].data(), (uint32_t)out[0].size());
+    CHECK(reader.valid());
+    CHECK(reader.type() == WIRE_EVT_ROLL_PROCESSED);
+    int32_t to = 0;
+    CHECK(reader.findInt(WIRE_TAG_TO, to) && to == 5);
+  }
+  CHECK(board.tiles[1] == 5);
+}
+
+static void testInvalidArgs() {
+  HostBoard board;
+  board.pairingRequired = false;
+  roll(board, 0, 13);
+  roll(board, NUM_PLAYERS, 2);
+
+  uint8_t buf[32];
+  WireWriter frame(buf, sizeof(buf));
+  frame.begin(CMD_ROLL);
+  frame.putInt(WIRE_TAG_PLAYER_ID, 0);
+  sendFrame(board, frame);
+
+  std::vector<std::string> out = received(board);
+  CHECK(out.size() == 3);
+  CHECK(out.size() == 3 && contains(out[0], "Invalid dice value"));
+  CHECK(out.size() == 3 && contains(out[1], "Invalid player ID"));
+  CHECK(out.size() == 3 && contains(out[2], "Missing playerId"));
+  CHECK(board.errorsSent == 3);
+  CHECK(board.tiles[0] == 1);
+}
+
+static void testUnknownAndMalformed() {
+  HostBoard board;
+  board.pairingRequired = false;
+
+  uint8_t buf[32];
+  WireWriter frame(buf, sizeof(buf));
+  frame.begin(CMD_COUNT + 5);
+  sendFrame(board, frame);
+
+  const uint8_t badVersion[] = {(uint8_t)(WIRE_MAGIC | 0x0F), CMD_STATUS};
+  CHECK(board.write(badVersion, sizeof(badVersion)) == CMD_PUSH_OK);
+  const uint8_t truncated[] = {(uint8_t)(WIRE_MAGIC | WIRE_VERSION), CMD_ROLL, 0x80};
+  CHECK(board.write(truncated, sizeof(truncated)) == CMD_PUSH_OK);
+  board.drain();
+
+  std::vector<std::string> out = received(board);
+  CHECK(out.size() == 3);
+  CHECK(out.size() == 3 && contains(out[0], "Unknown command"));
+  CHECK(out.size() == 3 && contains(out[1], "Unsupported binary frame version"));
+  CHECK(out.size() == 3 && contains(out[2], "Malformed binary command"));
+}
+
+static void testJson() {
+  HostBoard board;
+  CHECK(board.write("{\"command\":\"pair\",\"password\":\"654321\"}") == CMD_PUSH_OK);
+  CHECK(board.write("{\"command\":\"status\"}") == CMD_PUSH_OK);
+  board.drain();
+  std::vector<std::string> out = received(board);
+  CHECK(out.size() == 2);
+#ifdef ARDUINOJSON_VERSION
+  CHECK(out.size() == 2 && contains(out[0], "pair_success"));
+  CHECK(out.size() == 2 && contains(out[1], "status_report"));
+#else
+  CHECK(out.size() == 2 && contains(out[0], "not supported"));
+  CHECK(!board.isPaired);
+#endif
+}
+
+static void testResponsesFitMtu() {
+  const uint16_t mtus[] = {23, 27, 64, 185, 247, 517};
+  for (uint16_t mtu : mtus) {
+    HostBoard board;
+    board.mtu = mtu;
+    board.pairingRequired = false;
+    uint8_t buf[16];
+    WireWriter frame(buf, sizeof(buf));
+    frame.begin(CMD_STATUS);
+    sendFrame(board, frame);
+    for (int i = 0; i < 8; i++) roll(board, i % NUM_PLAYERS, i + 1);
+    CHECK(board.characteristic.maxPayload <= notifyPayloadSize(mtu));
+    std::vector<std::string> out = received(board);
+    CHECK(out.size() == 9);
+    CHECK(out.size() == 9 && contains(out[0], "status_report") && out[0].back() == '}');
+  }
+}
+
+// Request id of a JSON or binary response, -1 if it has none
+static int64_t responseId(const std::string &m) {
+  if (isWireFrame((const uint8_t *)m.data(), (uint32_t)m.size())) {
+    WireReader reader((const uint8_t *)m.data(), (uint32_t)m.size());
+    int32_t id = 0;
+    return reader.findInt(WIRE_TAG_REQUEST_ID, id) ? (int64_t)(uint32_t)id : -1;
+  }
+  size_t at = m.rfind(",\"id\":");
+  if (at == std::string::npos) at = m.rfind("{\"id\":");
+  if (at == std::string::npos || m.find('}', at) != m.size() - 1) return -1;
+  return strtoll(m.c_str() + at + 6, nullptr, 10);
+}
+
+static void testAppendRequestId() {
+  char buf[32];
+  const RequestTag tag = {true, 4000000000u};
+  strcpy(buf, "{\"a\":1}");
+  uint32_t len = appendRequestId(buf, (uint32_t)strlen(buf), sizeof(buf), tag);
+  CHECK(len == strlen(buf) && strcmp(buf, "{\"a\":1,\"id\":4000000000}") == 0);
+  strcpy(buf, "{}");
+  CHECK(appendRequestId(buf, 2, sizeof(buf), tag) == 17 && strcmp(buf, "{\"id\":4000000000}") == 0);
+  strcpy(buf, "{\"a\":1}");
+  CHECK(appendRequestId(buf, 7, sizeof(buf), NO_REQUEST) == 7 && strcmp(buf, "{\"a\":1}") == 0);
+  strcpy(buf, "{\"a\":1}");
+  CHECK(appendRequestId(buf, 7, 20, tag) == 0);  // Would not fit
+}
+
+static void testRequestIds() {
+  HostBoard board;
+  board.pairingRequired = false;
+  board.wireVersion = WIRE_VERSION;
+
+  // Pipelined without waiting: each response carries its request's id
+  writeRoll(board, 0, 2, 10);
+  writeCommand(board, CMD_STATUS, 11);
+  writeRoll(board, 1, 99, 12);  // Error echoes the id too
+  writeCommand(board, CMD_PROFILE, 0xFFFFFFFFu);
+  writeRoll(board, 2, 3);       // No id, none echoed
+  board.drain();
+  std::vector<std::string> out = received(board);
+  CHECK(out.size() == 5);
+  if (out.size() == 5) {
+    CHECK(responseId(out[0]) == 10 && isWireFrame((const uint8_t *)out[0].data(), (uint32_t)out[0].size()));
+    CHECK(responseId(out[1]) == 11 && contains(out[1], "status_report"));
+    CHECK(responseId(out[2]) == 12 && contains(out[2], "Invalid dice value"));
+    CHECK(responseId(out[3]) == 0xFFFFFFFFu);
+    CHECK(responseId(out[4]) == -1);
+  }
+
+  // Deferred event of a roll carries the roll's id, not the current one's
+  writeRoll(board, 0, 1, 20);
+  writeCommand(board, CMD_STATUS, 21);
+  board.drain();
+  board.placeCoin();
+  out = received(board);
+  CHECK(out.size() == 3);
+  CHECK(out.size() == 3 && contains(out[2], "coin_placed") && responseId(out[2]) == 20);
+
+  // A later GAME command supersedes the open wait's id
+  writeRoll(board, 0, 1, 30);
+  writeCommand(board, CMD_UNDO, 31);
+  board.drain();
+  board.placeCoin();
+  out = received(board);
+  CHECK(out.size() == 3);
+  CHECK(out.size() == 3 && responseId(out[1]) == 31 && responseId(out[2]) == -1);
+
+  // A QUERY in between does not
+  writeRoll(board, 0, 1, 40);
+  writeCommand(board, CMD_TASK_STATS, 41);
+  board.drain();
+  board.placeCoin();
+  out = received(board);
+  CHECK(out.size() == 3 && responseId(out[2]) == 40);
+}
+
+static void testRingFull() {
+  HostBoard board;
+  board.pairingRequired = false;
+  uint8_t buf[16];
+  WireWriter frame(buf, sizeof(buf));
+  frame.begin(CMD_STATUS);
+  int accepted = 0;
+  for (int i = 0; i < HOST_RING_SLOTS + 4; i++) {
+    if (board.write(frame.data(), frame.size()) == CMD_PUSH_OK) accepted++;
+  }
+  CHECK(accepted < HOST_RING_SLOTS + 4);
+  CHECK(board.ring.droppedCount() > 0);
+  CHECK(board.drain() == (uint32_t)accepted);
+  CHECK(received(board).size() == (size_t)accepted);
+}
+
+int main() {
+  testPairingGate();
+  testBinaryNegotiation();
+  testInvalidArgs();
+  testUnknownAndMalformed();
+  testJson();
+  testResponsesFitMtu();
+  testAppendRequestId();
+  testRequestIds();
+  testRingFull();
+
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("command layer tests passed\n");
+  return 0;
+}
@@ -0,0 +1,131 @@
+/*
+ * Host tests for command_ring.h, single-threaded and with a real
+ * producer / consumer thread pair.
+ */
+
+#include "command_ring.h"
+#include "check.h"
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+static CommandPushResult pushStr(CommandRing<4, 32> &ring, const char *s) {
+  return ring.push((const uint8_t *)s, (uint32_t)strlen(s));
+}
+
+static void testBasics() {
+  CommandRing<4, 32> ring;
+  uint32_t len = 0;
+  CHECK(ring.empty());
+  CHECK(ring.front(len) == nullptr);
+  ring.pop();  // Popping an empty ring is a no-op
+  CHECK(ring.empty());
+
+  CHECK(pushStr(ring, "{\"command\":\"status\"}") == CMD_PUSH_OK);
+  CHECK(pushStr(ring, "{\"command\":\"reset\"}") == CMD_PUSH_OK);
+  CHECK(ring.size() == 2);
+
+  char *cmd = ring.front(len);
+  CHECK(cmd != nullptr && len == 20);
+  CHECK(strcmp(cmd, "{\"command\":\"status\"}") == 0);  // NUL-terminated
+  // front() is stable until pop()
+  CHECK(ring.front(len) == cmd);
+  ring.pop();
+  cmd = ring.front(len);
+  CHECK(cmd != nullptr && strcmp(cmd, "{\"command\":\"reset\"}") == 0);
+  ring.pop();
+  CHECK(ring.empty());
+  CHECK(ring.highWater() == 2);
+
+  // The enqueue stamp travels with the slot
+  uint32_t stamp = 0;
+  CHECK(ring.push((const uint8_t *)"{}", 2, 12345) == CMD_PUSH_OK);
+  CHECK(ring.front(len, &stamp) != nullptr && stamp == 12345);
+  ring.pop();
+}
+
+static void testFullAndOversize() {
+  CommandRing<4, 32> ring;
+  for (int i = 0; i < 4; i++) {
+    CHECK(pushStr(ring, "x") == CMD_PUSH_OK);
+  }
+  CHECK(pushStr(ring, "y") == CMD_PUSH_FULL);
+  CHECK(ring.droppedCount() == 1);
+  CHECK(ring.size() == 4);
+  CHECK(ring.highWater() == 4);
+
+  // Exactly SLOT_SIZE fits, one more byte does not
+  char big[34];
+  memset(big, 'a', sizeof(big));
+  CHECK(ring.push((const uint8_t *)big, 33) == CMD_PUSH_TOO_LONG);
+  CHECK(ring.oversizeCount() == 1);
+  CHECK(ring.push((const uint8_t *)big, 0) == CMD_PUSH_EMPTY);
+
+  uint32_t len = 0;
+  ring.pop();
+  CHECK(ring.push((const uint8_t *)big, 32) == CMD_PUSH_OK);
+  for (int i = 0; i < 3; i++) {
+    CHECK(ring.front(len) != nullptr && len == 1);
+    ring.pop();
+  }
+  char *cmd = ring.front(len);
+  CHECK(cmd != nullptr && len == 32 && cmd[31] == 'a' && cmd[32] == '\0');
+  ring.pop();
+  CHECK(ring.empty());
+  CHECK(ring.droppedCount() == 1);
+}
+
+static void testThreads() {
+  const uint32_t count = 100000;
+  CommandRing<8, 64> ring;
+  bool intact = true;
+  uint32_t received = 0;
+  uint32_t refused = 0;
+
+  std::thread consumer([&] {
+    uint32_t expect = 0;
+    char want[64];
+    while (expect < count) {
+      uint32_t len = 0;
+      char *cmd = ring.front(len);
+      if (cmd == nullptr) {
+        std::this_thread::yield();
+        continue;
+      }
+      int n = snprintf(want, sizeof(want), "{\"seq\":%u,\"pad\":\"%.*s\"}", expect, (int)(expect % 20), "xxxxxxxxxxxxxxxxxxxx");
+      if ((uint32_t)n != len || memcmp(cmd, want, len) != 0 || cmd[len] != '\0') intact = false;
+      ring.pop();
+      expect++;
+      received++;
+    }
+  });
+
+  char buf[64];
+  for (uint32_t i = 0; i < count; i++) {
+    int n = snprintf(buf, sizeof(buf), "{\"seq\":%u,\"pad\":\"%.*s\"}", i, (int)(i % 20), "xxxxxxxxxxxxxxxxxxxx");
+    while (ring.push((const uint8_t *)buf, (uint32_t)n) == CMD_PUSH_FULL) {
+      refused++;
+      std::this_thread::yield();
+    }
+  }
+  consumer.join();
+
+  CHECK(intact);
+  CHECK(received == count);
+  CHECK(ring.empty());
+  CHECK(ring.droppedCount() == refused);
+  CHECK(ring.highWater() <= ring.capacity());
+}
+
+int main() {
+  testBasics();
+  testFullAndOversize();
+  testThreads();
+
+  if (failures) {
+    printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("command ring tests passed\n");
+  return 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * Host tests for command_table.h: every command name maps to its id and
+ * nothing else does.
+ */
+
+#include "command_table.h"
+#include "check.h"
+#include <cstdio>
+#include <cstring>
+
+// Resolved at compile time, so the table itself is constexpr-usable
+static_assert(COMMAND_TABLE.slots[commandSlot("roll", COMMAND_HASH_SEED)] == CMD_ROLL,
+              "roll is not in its slot");
+
+static void testKnownNames() {
+  for (int i = 0; i < CMD_COUNT; i++) {
+    CHECK(lookupCommand(COMMAND_NAMES[i]) == (CommandId)i);
+  }
+  CHECK(lookupCommand("sync_state") == CMD_SYNC_STATE);
+  CHECK(lookupCommand("update_settings") == CMD_UPDATE_SETTINGS);
+}
+
+static void testTableIsPerfect() {
+  int filled = 0;
+  bool seen[CMD_COUNT] = {};
+  for (int s = 0; s < COMMAND_HASH_SLOTS; s++) {
+    uint8_t id = COMMAND_TABLE.slots[s];
+    if (id == CMD_UNKNOWN) continue;
+    CHECK(id < CMD_COUNT);
+    if (id >= CMD_COUNT) continue;
+    CHECK(!seen[id]);
+    seen[id] = true;
+    filled++;
+  }
+  CHECK(filled == CMD_COUNT);
+  CHECK(commandSeedIsPerfect(COMMAND_HASH_SEED));
+}
+
+static void testUnknownNames() {
+  CHECK(lookupCommand(nullptr) == CMD_UNKNOWN);
+  CHECK(lookupCommand("") == CMD_UNKNOWN);
+  CHECK(lookupCommand("rol") == CMD_UNKNOWN);        // Prefix
+  CHECK(lookupCommand("rolls") == CMD_UNKNOWN);      // Extension
+  CHECK(lookupCommand("ROLL") == CMD_UNKNOWN);       // Case matters
+  CHECK(lookupCommand("sync-state") == CMD_UNKNOWN);
+  CHECK(lookupCommand("status ") == CMD_UNKNOWN);
+  CHECK(lookupCommand("bogus") == CMD_UNKNOWN);
+
+  // Every single-character edit of every name is rejected (any that hashes
+  // into an occupied slot must be caught by the strcmp)
+  char buf[32];
+  for (int i = 0; i < CMD_COUNT; i++) {
+    size_t len = strlen(COMMAND_NAMES[i]);
+    for (size_t pos = 0; pos < len; pos++) {
+      for (int c = 'a'; c <= 'z'; c++) {
+        strcpy(buf, COMMAND_NAMES[i]);
+        if (buf[pos] == c) continue;
+        buf[pos] = (char)c;
+        CommandId id = lookupCommand(buf);
+        CHECK(id == CMD_UNKNOWN || strcmp(buf, COMMAND_NAMES[id]) == 0);
+      }
+    }
+  }
+}
+
+int main() {
+  testKnownNames();
+  testTableIsPerfect();
+  testUnknownNames();
+
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("command table tests passed\n");
+  return 0;
+}
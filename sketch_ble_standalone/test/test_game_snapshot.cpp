@@ -0,0 +1,194 @@
+/*
+ * Host tests for game_snapshot.h: one write per changed save, alternating
+ * slots, and recovery from torn or corrupted slots after a power cut.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include "game_snapshot.h"
+#include "check.h"
+
+// Preferences' byte API over a map; tornAt simulates a power cut that
+// leaves only the first bytes of the next write
+struct MemoryStore {
+  std::map<std::string, std::vector<uint8_t>> keys;
+  uint32_t puts = 0;
+  int tornAt = -1;
+  bool failNext = false;
+
+  size_t putBytes(const char *key, const void *value, size_t len) {
+    if (failNext) {
+      failNext = false;
+      return 0;
+    }
+    puts++;
+    const uint8_t *p = (const uint8_t *)value;
+    size_t n = tornAt >= 0 && (size_t)tornAt < len ? (size_t)tornAt : len;
+    keys[key].assign(p, p + n);
+    tornAt = -1;
+    return n;
+  }
+
+  size_t getBytes(const char *key, void *buf, size_t maxLen) {
+    auto it = keys.find(key);
+    if (it == keys.end() || it->second.size() > maxLen) return 0;
+    memcpy(buf, it->second.data(), it->second.size());
+    return it->second.size();
+  }
+};
+
+static GameSnapshot game(int tile0, int score0) {
+  GameSnapshot s;
+  memset(&s, 0, sizeof(s));
+  for (int i = 0; i < NUM_PLAYERS; i++) {
+    s.players[i].tile = 1;
+    s.players[i].score = 10;
+    s.players[i].flags = SNAPSHOT_ALIVE;
+  }
+  s.players[0].tile = (uint8_t)tile0;
+  s.players[0].score = (int16_t)score0;
+  return s;
+}
+
+static void testCrc() {
+  CHECK(snapshotCrc32("123456789", 9) == 0xCBF43926u);  // Standard check value
+  CHECK(snapshotCrc32("", 0) == 0);
+}
+
+static void testRoundTripAndSkip() {
+  MemoryStore mem;
+  SnapshotStore<MemoryStore> store(mem);
+  GameSnapshot loaded;
+  CHECK(store.load(loaded) == SNAPSHOT_EMPTY);
+
+  CHECK(store.save(game(5, 12)));
+  CHECK(mem.puts == 1);
+  CHECK(store.save(game(5, 12)));  // Unchanged: no flash write
+  CHECK(mem.puts == 1);
+  CHECK(store.skipped() == 1);
+  CHECK(store.save(game(7, 11)));
+  CHECK(mem.puts == 2);
+  CHECK(mem.keys.count(SNAPSHOT_KEY_A) && mem.keys.count(SNAPSHOT_KEY_B));
+
+  SnapshotStore<MemoryStore> reboot(mem);
+  CHECK(reboot.load(loaded) == SNAPSHOT_LOADED);
+  CHECK(loaded.seq == 2);
+  CHECK(loaded.players[0].tile == 7 && loaded.players[0].score == 11);
+  CHECK(reboot.save(game(7, 11)));  // Same as loaded: skipped
+  CHECK(reboot.writes() == 0 && reboot.skipped() == 1);
+}
+
+static void testSlotsAlternate() {
+  MemoryStore mem;
+  SnapshotStore<MemoryStore> store(mem);
+  for (int i = 0; i < 6; i++) {
+    CHECK(store.save(game(i + 1, i)));
+    CHECK(store.slot() == i % 2);
+    CHECK(store.seq() == (uint32_t)i + 1);
+  }
+}
+
+static void testTornWriteKeepsPrevious() {
+  for (int cut = 1; cut < (int)sizeof(GameSnapshot); cut += 3) {
+    MemoryStore mem;
+    SnapshotStore<MemoryStore> store(mem);
+    CHECK(store.save(game(4, 9)));
+    CHECK(store.save(game(6, 8)));
+    mem.tornAt = cut;
+    store.save(game(9, 3));  // Power cut mid-write
+
+    SnapshotStore<MemoryStore> reboot(mem);
+    GameSnapshot loaded;
+    CHECK(reboot.load(loaded) == SNAPSHOT_LOADED);
+    CHECK(loaded.seq == 2 && loaded.players[0].tile == 6);
+    CHECK(reboot.rejected() == 1);
+
+    // Next save goes over the torn slot, not the good one
+    CHECK(reboot.save(game(10, 2)));
+    CHECK(reboot.seq() == 3);
+    SnapshotStore<MemoryStore> again(mem);
+    CHECK(again.load(loaded) == SNAPSHOT_LOADED && loaded.players[0].tile == 10);
+    CHECK(again.rejected() == 0);
+  }
+}
+
+static void testCorruption() {
+  MemoryStore mem;
+  SnapshotStore<MemoryStore> store(mem);
+  CHECK(store.save(game(4, 9)));
+  CHECK(store.save(game(6, 8)));
+
+  // One flipped bit in the newest slot: falls back to the older one
+  mem.keys[SNAPSHOT_KEY_B][9] ^= 0x10;
+  GameSnapshot loaded;
+  SnapshotStore<MemoryStore> reboot(mem);
+  CHECK(reboot.load(loaded) == SNAPSHOT_LOADED && loaded.seq == 1 && loaded.players[0].tile == 4);
+
+  mem.keys[SNAPSHOT_KEY_A][0] ^= 0x01;
+  SnapshotStore<MemoryStore> both(mem);
+  CHECK(both.load(loaded) == SNAPSHOT_CORRUPT);
+  CHECK(both.rejected() == 2);
+
+  // Another version is not loaded
+  MemoryStore other;
+  SnapshotStore<MemoryStore> writer(other);
+  CHECK(writer.save(game(3, 3)));
+  GameSnapshot raw;
+  memcpy(&raw, other.keys[SNAPSHOT_KEY_A].data(), sizeof(raw));
+  raw.version = SNAPSHOT_VERSION + 1;
+  raw.crc = snapshotBodyCrc(raw);
+  memcpy(other.keys[SNAPSHOT_KEY_A].data(), &raw, sizeof(raw));
+  SnapshotStore<MemoryStore> reader(other);
+  CHECK(reader.load(loaded) == SNAPSHOT_CORRUPT);
+}
+
+static void testSeqWrap() {
+  MemoryStore mem;
+  GameSnapshot s = game(2, 2);
+  s.magic = SNAPSHOT_MAGIC;
+  s.version = SNAPSHOT_VERSION;
+  s.playerCount = NUM_PLAYERS;
+  s.seq = 0xFFFFFFFFu;
+  s.crc = snapshotBodyCrc(s);
+  mem.putBytes(SNAPSHOT_KEY_A, &s, sizeof(s));
+
+  SnapshotStore<MemoryStore> store(mem);
+  GameSnapshot loaded;
+  CHECK(store.load(loaded) == SNAPSHOT_LOADED);
+  CHECK(store.save(game(3, 3)));
+  CHECK(store.seq() == 0);  // Wrapped
+
+  SnapshotStore<MemoryStore> reboot(mem);
+  CHECK(reboot.load(loaded) == SNAPSHOT_LOADED && loaded.players[0].tile == 3);
+}
+
+static void testFailedWrite() {
+  MemoryStore mem;
+  SnapshotStore<MemoryStore> store(mem);
+  CHECK(store.save(game(4, 9)));
+  mem.failNext = true;
+  CHECK(!store.save(game(5, 9)));
+  CHECK(store.failures() == 1);
+  CHECK(store.save(game(5, 9)));  // Retried, not skipped as unchanged
+  CHECK(store.writes() == 2);
+}
+
+int main() {
+  testCrc();
+  testRoundTripAndSkip();
+  testSlotsAlternate();
+  testTornWriteKeepsPrevious();
+  testCorruption();
+  testSeqWrap();
+  testFailedWrite();
+
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("game snapshot tests passed\n");
+  return 0;
+}
@@ -0,0 +1,298 @@
+/*
+ * Host tests for GoDice.h: messages come out whole however the link packs
+ * or splits them, each as the SDK decodes it on its own, garbage is skipped
+ * and counted, and a partial message whose rest never comes is dropped.
+ */
+
+#include "GoDice.h"
+#include "check.h"
+#include <cstdio>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+typedef GoDiceDecoder<2> Decoder;
+
+static std::vector<uint8_t> bytesOf(const char *s, std::vector<uint8_t> payload = {}) {
+  std::vector<uint8_t> out(s, s + strlen(s));
+  out.insert(out.end(), payload.begin(), payload.end());
+  return out;
+}
+
+// Events as text, "key:value:x,y,z" each
+static std::string eventText(const GoDiceEvent &e) {
+  return std::string(1, (char)e.key) + ":" + std::to_string(e.value) + ":" + std::to_string(e.stable.x) + "," +
+         std::to_string(e.stable.y) + "," + std::to_string(e.stable.z) + " ";
+}
+
+static std::string feedAll(Decoder &decoder, const std::vector<uint8_t> &data, uint32_t nowMs,
+                           uint8_t slot = 0) {
+  std::string out;
+  decoder.decode(slot, data.data(), data.size(), nowMs, [&](const GoDiceEvent &e) {
+    CHECK(e.slot == slot);
+    out += eventText(e);
+  });
+  return out;
+}
+
+// One roll as the die reports it, every message kind included
+static std::vector<std::vector<uint8_t>> sampleMessages() {
+  return {
+    bytesOf("R"), bytesOf("R"), bytesOf("TS", {10, 20, 60}), bytesOf("Tap"), bytesOf("MS", {0, 64, 0}),
+    bytesOf("S", {(uint8_t)-64, 0, 0}), bytesOf("Bat", {87}), bytesOf("Char", {1}), bytesOf("Col", {3}),
+    bytesOf("DTap"), bytesOf("FS", {0, 0, 64}),
+  };
+}
+
+static std::vector<uint8_t> sampleStream() {
+  std::vector<uint8_t> all;
+  for (const auto &m : sampleMessages()) all.insert(all.end(), m.begin(), m.end());
+  return all;
+}
+
+static const char *SAMPLE = "R:0:0,0,0 R:0:0,0,0 T:2:10,20,60 T:0:0,0,0 M:3:0,64,0 S:1:-64,0,0 "
+                            "B:87:0,0,0 C:1:0,0,0 C:3:0,0,0 D:0:0,0,0 F:2:0,0,64 ";
+
+static void testOnePerNotification() {
+  Decoder decoder;
+  CHECK(feedAll(decoder, bytesOf("S", {0, 0, 64}), 0) == "S:2:0,0,64 ");
+  CHECK(feedAll(decoder, bytesOf("R"), 1) == "R:0:0,0,0 ");
+  CHECK(feedAll(decoder, bytesOf("Bat", {55}), 2) == "B:55:0,0,0 ");
+  CHECK(decoder.messageCount() == 3);
+}
+
+// Each event carries what the SDK reports for the message on its own
+static void testMatchesSdk() {
+  struct Seen {
+    int rolls;
+    int level;
+    int charging;
+    int color;
+    godice_stable_info_t stable;
+  };
+  godice_callbacks_t cb;
+  memset(&cb, 0, sizeof(cb));
+  cb.on_dice_roll = [](void *u, int) { ((Seen *)u)->rolls++; };
+  cb.on_charge_level = [](void *u, int, uint8_t level) { ((Seen *)u)->level = level; };
+  cb.on_charging_state_chaged = [](void *u, int, bool charging) { ((Seen *)u)->charging = charging; };
+  cb.on_dice_color = [](void *u, int, godice_color_t color) { ((Seen *)u)->color = color; };
+  cb.on_dice_stable_ex = [](void *u, int, const godice_stable_info_t *info) { ((Seen *)u)->stable = *info; };
+
+  Decoder decoder;
+  for (const auto &m : sampleMessages()) {
+    Seen seen;
+    memset(&seen, 0, sizeof(seen));
+    godice_incoming_packet(&cb, &seen, 0, 6, m.data(), m.size());
+
+    int events = 0;
+    decoder.decode(0, m.data(), m.size(), 0, [&](const GoDiceEvent &e) {
+      events++;
+      switch (e.type) {
+        case GODICE_EVENT_ROLL:
+          CHECK(seen.rolls == 1);
+          break;
+        case GODICE_EVENT_STABLE:
+          CHECK(e.value == seen.stable.number);
+          CHECK(e.stable.type == seen.stable.type);
+          if (e.stable.type == GODICE_STABLE) {
+            CHECK(e.stable.runner_up == 0 && e.stable.margin == 0);  // Face table only
+          } else {
+            CHECK(e.stable.runner_up == seen.stable.runner_up);
+            CHECK(e.stable.margin == seen.stable.margin);
+          }
+          break;
+        case GODICE_EVENT_CHARGE_LEVEL:
+          CHECK(e.value == seen.level);
+          break;
+        case GODICE_EVENT_CHARGING:
+          CHECK(e.value == seen.charging);
+          break;
+        case GODICE_EVENT_COLOR:
+          CHECK(e.value == seen.color);
+          break;
+        default:
+          break;
+      }
+    });
+    CHECK(events == 1);
+  }
+
+  // A die balanced on an edge: the margin the sketches gate on comes through
+  std::vector<uint8_t> edge = bytesOf("TS", {45, 45, 0});
+  int events = 0;
+  decoder.decode(0, edge.data(), edge.size(), 0, [&](const GoDiceEvent &e) {
+    events++;
+    CHECK(e.stable.type == GODICE_TILT_STABLE);
+    CHECK(e.stable.runner_up != e.value);
+    CHECK(e.stable.margin < 100);
+  });
+  CHECK(events == 1);
+}
+
+static void testConcatenated() {
+  Decoder decoder;
+  std::vector<uint8_t> all = sampleStream();
+  std::string out;
+  // As many whole or partial messages per notification as a 20-byte
+  // payload holds
+  for (size_t i = 0; i < all.size(); i += 20) {
+    std::vector<uint8_t> chunk(all.begin() + i, all.begin() + std::min(all.size(), i + 20));
+    out += feedAll(decoder, chunk, (uint32_t)i);
+  }
+  CHECK(out == SAMPLE);
+  CHECK(decoder.malformedBytes() == 0 && decoder.badPayloadCount() == 0);
+
+  // Or all of them in one
+  Decoder whole;
+  CHECK(feedAll(whole, all, 0) == SAMPLE);
+}
+
+static void testSplitAtEveryByte() {
+  std::vector<uint8_t> all = sampleStream();
+  // Notifications of up to 16 bytes, with an extra split at every offset
+  for (size_t cut = 1; cut < all.size(); cut++) {
+    Decoder decoder;
+    std::string out;
+    size_t start = 0;
+    while (start < all.size()) {
+      size_t end = std::min(all.size(), start + 16);
+      if (start < cut && cut < end) end = cut;
+      out += feedAll(decoder, std::vector<uint8_t>(all.begin() + start, all.begin() + end), (uint32_t)start);
+      start = end;
+    }
+    CHECK(out == SAMPLE);
+  }
+
+  // One byte per notification
+  Decoder decoder;
+  std::string out;
+  for (size_t i = 0; i < all.size(); i++) {
+    out += feedAll(decoder, std::vector<uint8_t>(1, all[i]), (uint32_t)i);
+  }
+  CHECK(out == SAMPLE);
+}
+
+static void testSlotsIndependent() {
+  Decoder decoder;
+  // Half a message on each die; neither completes the other's
+  CHECK(feedAll(decoder, bytesOf("Ba"), 0, 0) == "");
+  CHECK(feedAll(decoder, bytesOf("Co"), 0, 1) == "");
+  CHECK(feedAll(decoder, {'l', 4}, 1, 1) == "C:4:0,0,0 ");
+  CHECK(feedAll(decoder, {'t', 9}, 1, 0) == "B:9:0,0,0 ");
+
+  // Out-of-range slots are ignored
+  CHECK(feedAll(decoder, bytesOf("R"), 2, 2) == "");
+  CHECK(decoder.messageCount() == 2);
+
+  // A die type the SDK has no table for reports no stable
+  decoder.setDiceMax(1, 7);
+  CHECK(feedAll(decoder, bytesOf("S", {0, 0, 64}), 3, 1) == "");
+  CHECK(decoder.badPayloadCount() == 0);
+}
+
+static void testResync() {
+  Decoder decoder;
+  // Garbage before, between and inside keys ("Bx" is no key)
+  std::vector<uint8_t> data = {0x00, 0xFF, 'x'};
+  std::vector<uint8_t> bat = bytesOf("Bat", {40});
+  data.insert(data.end(), bat.begin(), bat.end());
+  data.push_back('B');
+  data.push_back('x');
+  data.push_back('R');
+  CHECK(feedAll(decoder, data, 0) == "B:40:0,0,0 R:0:0,0,0 ");
+  CHECK(decoder.malformedBytes() == 5);
+
+  // The same across a notification boundary: "D" then "TS..." is a tilt
+  // stable, not a double tap
+  CHECK(feedAll(decoder, bytesOf("D"), 1) == "");
+  CHECK(feedAll(decoder, bytesOf("TS", {0, 64, 0}), 2) == "T:3:0,64,0 ");
+  CHECK(decoder.malformedBytes() == 6);
+
+  // Payloads the SDK rejects are consumed without an event
+  CHECK(feedAll(decoder, bytesOf("Bat", {101}), 3) == "");
+  CHECK(feedAll(decoder, bytesOf("Col", {9}), 4) == "");
+  CHECK(feedAll(decoder, bytesOf("Char", {2}), 5) == "");
+  CHECK(decoder.badPayloadCount() == 3);
+  CHECK(feedAll(decoder, bytesOf("Col", {5}), 6) == "C:5:0,0,0 ");
+}
+
+static void testStalePartial() {
+  Decoder decoder;
+  // Half a battery message, then nothing for longer than the stale window:
+  // the stable that follows must not be read as its level
+  CHECK(feedAll(decoder, bytesOf("Ba"), 0) == "");
+  CHECK(feedAll(decoder, bytesOf("S", {0, 64, 0}), GODICE_DECODER_STALE_MS + 1) == "S:3:0,64,0 ");
+  CHECK(decoder.staleBytes() == 2);
+
+  // Within the window the halves join up
+  CHECK(feedAll(decoder, bytesOf("Ba"), 1000) == "");
+  CHECK(feedAll(decoder, {'t', 12}, 1000 + GODICE_DECODER_STALE_MS) == "B:12:0,0,0 ");
+  CHECK(decoder.staleBytes() == 2);
+
+  // reset() forgets the partial without counting it
+  CHECK(feedAll(decoder, bytesOf("Cha"), 2000) == "");
+  decoder.reset(0);
+  CHECK(feedAll(decoder, {'r', 1, 'R'}, 2001) == "R:0:0,0,0 ");
+  CHECK(decoder.malformedBytes() == 2);
+  CHECK(decoder.staleBytes() == 2);
+}
+
+// decodeBatch() gives what decode() does, notification by notification,
+// with two dice interleaved, and stops before a notification that might
+// not fit in the events left
+static void testBatch() {
+  std::vector<uint8_t> all = sampleStream();
+  std::vector<GoDiceNotification> notifications;
+  for (size_t i = 0; i < all.size(); i += 7) {
+    size_t size = std::min(all.size() - i, (size_t)7);
+    notifications.push_back({0, all.data() + i, size});
+    notifications.push_back({1, all.data() + i, size});
+  }
+
+  Decoder decoder;
+  decoder.setDiceMax(1, 20);
+  GoDiceEvent events[64];
+  std::string out[2];
+  size_t done = 0;
+  int calls = 0;
+  while (done < notifications.size()) {
+    size_t consumed = 0;
+    size_t n = decoder.decodeBatch(notifications.data() + done, notifications.size() - done, 0, events, 16,
+                                   &consumed);
+    CHECK(consumed > 0);
+    for (size_t i = 0; i < n; i++) out[events[i].slot] += eventText(events[i]);
+    done += consumed;
+    calls++;
+  }
+  CHECK(out[0] == SAMPLE);
+  CHECK(calls > 1);
+  CHECK(decoder.malformedBytes() == 0 && decoder.badPayloadCount() == 0);
+
+  Decoder d20;
+  d20.setDiceMax(0, 20);
+  CHECK(feedAll(d20, all, 0) == out[1]);
+
+  // Not even one notification fits
+  size_t consumed = 1;
+  CHECK(decoder.decodeBatch(notifications.data(), 1, 0, events, GODICE_MESSAGE_MAX + 5, &consumed) == 0);
+  CHECK(consumed == 0);
+}
+
+int main() {
+  testOnePerNotification();
+  testMatchesSdk();
+  testConcatenated();
+  testSplitAtEveryByte();
+  testSlotsIndependent();
+  testResync();
+  testStalePartial();
+  testBatch();
+
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("godice decoder tests passed\n");
+  return 0;
+}
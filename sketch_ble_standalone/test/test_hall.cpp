@@ -0,0 +1,133 @@
+/*
+ * Host tests for hall_sensors.h against the simulated sensor board.
+ */
+
+#include "sim_hall_bus.h"
+#include "check.h"
+#include <cstdio>
+
+static void testWiringCoversEveryTileOnce() {
+  int seen[NUM_TILES + 1] = {0};
+  for (int j = 0; j < 8; j++) {
+    seen[MCP_PORTA_TILES[j]]++;
+    seen[MCP_PORTB_TILES[j]]++;
+  }
+  for (int j = 0; j < 4; j++) {
+    seen[DIRECT_GPIO_TILES[j]]++;
+  }
+  for (int t = 1; t <= NUM_TILES; t++) {
+    CHECK(seen[t] == 1);
+    CHECK(hallWiringForTile(t).source != HALL_SOURCE_NONE);
+  }
+  CHECK(hallWiringForTile(0).source == HALL_SOURCE_NONE);
+  CHECK(hallWiringForTile(NUM_TILES + 1).source == HALL_SOURCE_NONE);
+}
+
+static void testDetectsCoinOnEveryTile() {
+  for (int t = 1; t <= NUM_TILES; t++) {
+    SimHallBus bus;
+    CHECK(!hallCoinPresent(bus, t, HALL_DEBOUNCE_DEFAULT));
+    bus.placeCoin(t, bus.nowUs);
+    int low = -1;
+    CHECK(hallCoinPresent(bus, t, HALL_DEBOUNCE_DEFAULT, &low));
+    CHECK(low == HALL_DEBOUNCE_DEFAULT.samples);
+    // Neighbours stay empty
+    CHECK(!hallCoinPresent(bus, t == 1 ? 2 : 1, HALL_DEBOUNCE_DEFAULT));
+  }
+}
+
+static void testRemovedCoinNotReported() {
+  SimHallBus bus;
+  bus.placeCoin(7, 0);
+  bus.removeCoin(7, 50000);
+  CHECK(hallCoinPresent(bus, 7, HALL_DEBOUNCE_DEFAULT));
+  bus.advanceMs(50);
+  CHECK(!hallCoinPresent(bus, 7, HALL_DEBOUNCE_DEFAULT));
+}
+
+static void testStuckPins() {
+  SimHallBus bus;
+  bus.stickTile(4, 0);
+  CHECK(hallCoinPresent(bus, 4, HALL_DEBOUNCE_DEFAULT));
+  bus.stickTile(4, 1);
+  bus.placeCoin(4, 0);
+  CHECK(!hallCoinPresent(bus, 4, HALL_DEBOUNCE_DEFAULT));
+  bus.stickTile(4, -1);
+  CHECK(hallCoinPresent(bus, 4, HALL_DEBOUNCE_DEFAULT));
+}
+
+static void testNackNeverFakesCoin() {
+  SimHallBus bus;
+  bus.nackBetween(0, 1000000000ULL);
+  HallStats stats = {0, 0};
+  for (int t = 1; t <= NUM_TILES; t++) {
+    bus.stickTile(t, 0);
+  }
+  for (int t = 1; t <= NUM_TILES; t++) {
+    bool present = hallCoinPresent(bus, t, HALL_DEBOUNCE_DEFAULT, nullptr, &stats);
+    // Only the direct GPIO tiles can still be read
+    CHECK(present == (hallWiringForTile(t).source == HALL_SOURCE_GPIO));
+  }
+  CHECK(stats.busErrors == 16u * HALL_DEBOUNCE_DEFAULT.samples);
+
+  uint32_t mask = hallScanTiles(bus, HALL_DEBOUNCE_DEFAULT);
+  uint32_t gpioMask = 0;
+  for (int j = 0; j < 4; j++) {
+    gpioMask |= 1UL << (DIRECT_GPIO_TILES[j] - 1);
+  }
+  CHECK(mask == gpioMask);
+}
+
+static void testDebounceRidesOutGlitches() {
+  SimHallBus bus(42);
+  bus.glitchRate = 0.05;
+  int falsePositives = 0;
+  for (int i = 0; i < 2000; i++) {
+    if (hallCoinPresent(bus, 1 + (i % NUM_TILES), HALL_DEBOUNCE_DEFAULT)) {
+      falsePositives++;
+    }
+  }
+  // P(>= 3 of 5 at 5%) ~= 0.1%
+  CHECK(falsePositives < 20);
+}
+
+static void testScanMatchesPerTile() {
+  SimHallBus bus(7);
+  const int tiles[] = {1, 6, 9, 12, 13, 20};
+  for (int t : tiles) {
+    bus.placeCoin(t, 0);
+  }
+  uint32_t mask = hallScanTiles(bus, HALL_DEBOUNCE_DEFAULT);
+  for (int t = 1; t <= NUM_TILES; t++) {
+    bool inMask = (mask >> (t - 1)) & 1;
+    CHECK(inMask == hallCoinPresent(bus, t, HALL_DEBOUNCE_DEFAULT));
+    CHECK(inMask == bus.coinOn(t));
+  }
+}
+
+static void testScanUsesOneExpanderReadPerSample() {
+  SimHallBus bus;
+  HallStats stats = {0, 0};
+  hallScanTiles(bus, HALL_DEBOUNCE_DEFAULT, &stats);
+  CHECK(bus.expanderReads == HALL_DEBOUNCE_DEFAULT.samples);
+  CHECK(stats.reads == (uint32_t)NUM_TILES * HALL_DEBOUNCE_DEFAULT.samples);
+  CHECK(stats.busErrors == 0);
+}
+
+int main() {
+  testWiringCoversEveryTileOnce();
+  testDetectsCoinOnEveryTile();
+  testRemovedCoinNotReported();
+  testStuckPins();
+  testNackNeverFakesCoin();
+  testDebounceRidesOutGlitches();
+  testScanMatchesPerTile();
+  testScanUsesOneExpanderReadPerSample();
+
+  if (failures) {
+    printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("hall sensor tests passed\n");
+  return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * Host tests for host_preferences.h: the Preferences calls the firmware
+ * makes round-trip, identical writes cost no flash, garbage collection
+ * keeps every live value, and each call is charged to its own stats.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include "host_preferences.h"
+#include "check.h"
+
+static void testRoundTrip() {
+  NvsEmulator nvs;
+  Preferences prefs(nvs);
+  CHECK(!prefs.begin("lastdrop", true));  // Read-only does not create it
+  CHECK(prefs.begin("lastdrop", false));
+
+  CHECK(prefs.getInt("p0_tile", 1) == 1);
+  CHECK(prefs.getString("password", "654321") == "654321");
+  CHECK(prefs.putInt("p0_tile", 7) == 4);
+  CHECK(prefs.putBool("p0_alive", false) == 1);
+  CHECK(prefs.putString("nickname", "Board A") == 7);
+  uint8_t blob[28];
+  for (int i = 0; i < (int)sizeof(blob); i++) blob[i] = (uint8_t)i;
+  CHECK(prefs.putBytes("snap_a", blob, sizeof(blob)) == sizeof(blob));
+
+  CHECK(prefs.getInt("p0_tile", 1) == 7);
+  CHECK(prefs.getBool("p0_alive", true) == false);
+  CHECK(prefs.getString("nickname") == "Board A");
+  uint8_t back[28];
+  CHECK(prefs.getBytesLength("snap_a") == sizeof(blob));
+  CHECK(prefs.getBytes("snap_a", back, sizeof(back)) == sizeof(back) && memcmp(back, blob, sizeof(blob)) == 0);
+  CHECK(prefs.getBytes("snap_a", back, 4) == 0);  // Too small
+  CHECK(prefs.getInt("nickname", -1) == -1);      // Wrong type reads as missing
+
+  CHECK(prefs.isKey("p0_tile"));
+  CHECK(prefs.remove("p0_tile"));
+  CHECK(!prefs.isKey("p0_tile"));
+  CHECK(!prefs.remove("p0_tile"));
+  CHECK(prefs.putInt("a_key_of_16_char", 1) == 0);  // NVS keys are at most 15
+
+  // Another namespace does not see these keys
+  Preferences other(nvs);
+  CHECK(other.begin("settings", false));
+  CHECK(!other.isKey("nickname"));
+  CHECK(prefs.clear());
+  CHECK(!prefs.isKey("nickname"));
+
+  Preferences readOnly(nvs);
+  CHECK(readOnly.begin("lastdrop", true));
+  CHECK(readOnly.putInt("p0_tile", 3) == 0);
+  CHECK(nvs.flash.violations == 0);
+}
+
+static void testIdenticalWriteIsFree() {
+  NvsEmulator nvs;
+  Preferences prefs(nvs);
+  prefs.begin("lastdrop");
+  prefs.putInt("p0_score", 10);
+  uint64_t before = nvs.flash.programmed;
+  CHECK(prefs.putInt("p0_score", 10) == 4);
+  CHECK(nvs.flash.programmed == before);
+  CHECK(prefs.putInt("p0_score", 11) == 4);
+  // One entry, one bitmap word to mark it written, one to retire the old one
+  CHECK(nvs.flash.programmed - before == NVS_ENTRY_SIZE + 4 + 4);
+}
+
+static void testGarbageCollection() {
+  NvsEmulator nvs;
+  Preferences prefs(nvs);
+  prefs.begin("lastdrop");
+  prefs.putString("password", "654321");
+  for (int i = 0; i < 5000; i++) {
+    char key[12];
+    snprintf(key, sizeof(key), "p%d_tile", i % 4);
+    CHECK(prefs.putInt(key, i) == 4);
+  }
+  CHECK(nvs.collections() > 0);
+  CHECK(nvs.outOfSpace() == 0);
+  for (int p = 0; p < 4; p++) {
+    char key[12];
+    snprintf(key, sizeof(key), "p%d_tile", p);
+    CHECK(prefs.getInt(key, -1) == 4996 + p);
+  }
+  CHECK(prefs.getString("password") == "654321");  // Moved, not lost
+  CHECK(nvs.flash.violations == 0);
+  CHECK(nvs.flash.maxErases() > 0);
+}
+
+static void testOutOfSpace() {
+  NvsEmulator nvs(2 * NVS_PAGE_SIZE);  // One page plus the spare
+  Preferences prefs(nvs);
+  prefs.begin("lastdrop");
+  int stored = 0;
+  for (int i = 0; i < 200; i++) {
+    char key[12];
+    snprintf(key, sizeof(key), "k%d", i);
+    if (prefs.putInt(key, i)) stored++;
+  }
+  CHECK(stored < 126);
+  CHECK(nvs.outOfSpace() > 0);
+  CHECK(prefs.getInt("k0", -1) == 0);
+}
+
+static void testChargedPerCall() {
+  NvsEmulator nvs;
+  Preferences prefs(nvs);
+  prefs.begin("lastdrop");
+  uint8_t blob[28] = {0};
+  prefs.putBytes("snap_a", blob, sizeof(blob));
+  prefs.putInt("p0_tile", 3);
+  prefs.getInt("p0_tile");
+  CHECK(nvs.ops["putBytes"].calls == 1);
+  CHECK(nvs.ops["putBytes"].programmed == 3 * NVS_ENTRY_SIZE + 4);  // Index, chunk header, data, bitmap
+  CHECK(nvs.ops["putInt"].programmed == NVS_ENTRY_SIZE + 4);
+  CHECK(nvs.ops["getInt"].programmed == 0 && nvs.ops["getInt"].readBytes == NVS_ENTRY_SIZE);
+  CHECK(nvs.ops["putInt"].us > nvs.ops["getInt"].us);
+  CHECK(nvs.ops["begin"].calls == 1);
+}
+
+int main() {
+  testRoundTrip();
+  testIdenticalWriteIsFree();
+  testGarbageCollection();
+  testOutOfSpace();
+  testChargedPerCall();
+
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("host preferences tests passed\n");
+  return 0;
+}
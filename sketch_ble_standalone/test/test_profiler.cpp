@@ -0,0 +1,121 @@
+/*
+ * Host tests for profiler.h on a fake cycle counter.
+ */
+
+static unsigned fakeCycles = 0;
+#define PROFILE_CYCLES() fakeCycles
+
+#include "profiler.h"
+#include "check.h"
+#include <cstdio>
+
+static void testBuckets() {
+  // Every value maps into a bucket whose [low, high] range contains it
+  uint32_t samples[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 100, 1000, 65535, 65536,
+                        123456789, 0x7FFFFFFFu, 0x80000000u, 0xFFFFFFFFu};
+  for (uint32_t v : samples) {
+    int b = profileBucket(v);
+    CHECK(b >= 0 && b < PROFILE_BUCKETS);
+    CHECK(profileBucketLow(b) <= v);
+    CHECK(profileBucketHigh(b) >= v);
+  }
+  CHECK(profileBucket(0xFFFFFFFFu) == PROFILE_BUCKETS - 1);
+
+  // Buckets tile the range with no gaps and stay within 1/PROFILE_SUB_BUCKETS
+  for (int b = 0; b < PROFILE_BUCKETS - 1; b++) {
+    CHECK(profileBucketHigh(b) + 1 == profileBucketLow(b + 1));
+    CHECK(profileBucket(profileBucketLow(b)) == b);
+    CHECK(profileBucket(profileBucketHigh(b)) == b);
+    uint32_t low = profileBucketLow(b);
+    if (low >= PROFILE_SUB_BUCKETS) {
+      CHECK(profileBucketHigh(b) - low < low / PROFILE_SUB_BUCKETS + 1);
+    }
+  }
+}
+
+static void testPercentiles() {
+  LoopProfiler prof;
+  int id = prof.addStage("stage");
+  CHECK(id == 0);
+  CHECK(prof.percentile(id, 500) == 0);
+
+  // 1..1000 cycles once each
+  for (uint32_t c = 1; c <= 1000; c++) {
+    prof.record(id, c);
+  }
+  const ProfileStage &s = prof.stage(id);
+  CHECK(s.count == 1000);
+  CHECK(s.maxCycles == 1000);
+  CHECK(s.totalCycles == 500500);
+
+  uint32_t p50 = prof.percentile(id, 500);
+  uint32_t p99 = prof.percentile(id, 990);
+  CHECK(p50 >= 500 && p50 < 500 + 500 / PROFILE_SUB_BUCKETS);
+  CHECK(p99 >= 990 && p99 <= 1000);
+  CHECK(prof.percentile(id, 1000) == 1000);
+  CHECK(p50 <= p99);
+
+  prof.reset();
+  CHECK(prof.stage(id).count == 0);
+  CHECK(prof.stage(id).maxCycles == 0);
+  CHECK(prof.percentile(id, 990) == 0);
+}
+
+static void testOutlier() {
+  // One slow sample only moves the max, not p50 / p99
+  LoopProfiler prof;
+  int id = prof.addStage("stage");
+  for (int i = 0; i < 999; i++) prof.record(id, 200);
+  prof.record(id, 2000000);
+  CHECK(prof.percentile(id, 500) <= 200 + 200 / PROFILE_SUB_BUCKETS);
+  CHECK(prof.percentile(id, 990) <= 200 + 200 / PROFILE_SUB_BUCKETS);
+  CHECK(prof.stage(id).maxCycles == 2000000);
+}
+
+static void testScope() {
+  LoopProfiler prof;
+  int a = prof.addStage("a");
+  int b = prof.addStage("b");
+
+  fakeCycles = 0xFFFFFF00u;  // Counter wraps inside the scope
+  {
+    PROFILE_SCOPE(prof, a);
+    fakeCycles += 0x300;
+  }
+  {
+    PROFILE_SCOPE(prof, b);
+    fakeCycles += 50;
+  }
+  CHECK(prof.stage(a).count == 1);
+  CHECK(prof.stage(a).maxCycles == 0x300);
+  CHECK(prof.stage(b).maxCycles == 50);
+
+  // Unknown ids are ignored
+  prof.record(-1, 10);
+  prof.record(PROFILE_MAX_STAGES, 10);
+  CHECK(prof.stage(a).count == 1);
+}
+
+static void testCapacity() {
+  LoopProfiler prof;
+  for (int i = 0; i < PROFILE_MAX_STAGES; i++) {
+    CHECK(prof.addStage("s") == i);
+  }
+  CHECK(prof.addStage("s") == -1);
+  CHECK(prof.count() == PROFILE_MAX_STAGES);
+}
+
+int main() {
+  testBuckets();
+  testPercentiles();
+  testOutlier();
+  testScope();
+  testCapacity();
+
+  if (failures) {
+    printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("profiler tests passed\n");
+  return 0;
+}
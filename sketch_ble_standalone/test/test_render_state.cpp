@@ -0,0 +1,154 @@
+/*
+ * Host tests for spsc_queue.h and render_state.h, single-threaded and with a
+ * real producer / consumer thread pair.
+ */
+
+#include "spsc_queue.h"
+#include "render_state.h"
+#include "check.h"
+#include <cstdio>
+#include <thread>
+
+static void testQueueBasics() {
+  SpscQueue<int, 4> q;
+  int v = 0;
+  CHECK(q.empty());
+  CHECK(!q.pop(v));
+  CHECK(q.capacity() == 4);
+
+  for (int i = 0; i < 4; i++) {
+    CHECK(q.push(i));
+  }
+  CHECK(q.size() == 4);
+  CHECK(!q.push(99));  // Full: all N slots usable, extra is dropped
+  CHECK(q.droppedCount() == 1);
+
+  for (int i = 0; i < 4; i++) {
+    CHECK(q.pop(v) && v == i);
+  }
+  CHECK(q.empty());
+}
+
+static void testQueueWrap() {
+  // Head/tail are free-running; push/pop far past N keeps FIFO order
+  SpscQueue<uint32_t, 8> q;
+  uint32_t next = 0;
+  uint32_t expect = 0;
+  for (int round = 0; round < 1000; round++) {
+    for (int i = 0; i < 3; i++) CHECK(q.push(next++));
+    uint32_t v = 0;
+    for (int i = 0; i < 3; i++) {
+      CHECK(q.pop(v) && v == expect);
+      expect++;
+    }
+  }
+  CHECK(q.empty());
+  CHECK(q.droppedCount() == 0);
+}
+
+static void testQueueThreads() {
+  const uint32_t count = 200000;
+  SpscQueue<uint32_t, 16> q;
+  bool ordered = true;
+  uint32_t received = 0;
+
+  std::thread consumer([&] {
+    uint32_t expect = 0;
+    while (expect < count) {
+      uint32_t v;
+      if (!q.pop(v)) {
+        std::this_thread::yield();
+        continue;
+      }
+      if (v != expect) ordered = false;
+      expect++;
+      received++;
+    }
+  });
+
+  for (uint32_t i = 0; i < count; i++) {
+    while (!q.push(i)) {
+      std::this_thread::yield();
+    }
+  }
+  consumer.join();
+
+  CHECK(ordered);
+  CHECK(received == count);
+  CHECK(q.empty());
+}
+
+static void testSeqLockBasics() {
+  SeqLock<RenderSnapshot> lock;
+  RenderSnapshot out;
+  lock.read(out);
+  CHECK(lock.version() == 0);
+  CHECK(out.expectedTile == 0);
+
+  RenderSnapshot snap = {};
+  snap.expectedTile = 7;
+  snap.players[2].tile = 13;
+  snap.players[2].color = 0x00FF00;
+  lock.publish(snap);
+  CHECK(lock.version() == 1);
+
+  lock.read(out);
+  CHECK(out.expectedTile == 7);
+  CHECK(out.players[2].tile == 13);
+  CHECK(out.players[2].color == 0x00FF00);
+}
+
+// Every word of the payload carries the same counter, so a torn copy
+// (half old, half new) is detectable
+struct Stamped {
+  uint32_t words[32];
+};
+
+static void testSeqLockThreads() {
+  const uint32_t publishes = 200000;
+  SeqLock<Stamped> lock;
+  bool torn = false;
+  bool backwards = false;
+  uint32_t reads = 0;
+
+  std::thread reader([&] {
+    uint32_t last = 0;
+    Stamped s;
+    while (last < publishes) {
+      lock.read(s);
+      for (int i = 1; i < 32; i++) {
+        if (s.words[i] != s.words[0]) torn = true;
+      }
+      if (s.words[0] < last) backwards = true;
+      last = s.words[0];
+      reads++;
+    }
+  });
+
+  Stamped s;
+  for (uint32_t n = 1; n <= publishes; n++) {
+    for (int i = 0; i < 32; i++) s.words[i] = n;
+    lock.publish(s);
+  }
+  reader.join();
+
+  CHECK(!torn);
+  CHECK(!backwards);
+  CHECK(reads > 0);
+  CHECK(lock.version() == publishes);
+}
+
+int main() {
+  testQueueBasics();
+  testQueueWrap();
+  testQueueThreads();
+  testSeqLockBasics();
+  testSeqLockThreads();
+
+  if (failures) {
+    printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("render state tests passed\n");
+  return 0;
+}
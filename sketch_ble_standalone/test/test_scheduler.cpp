@@ -0,0 +1,158 @@
+/*
+ * Host tests for scheduler.h on a fake millis()/micros() clock.
+ */
+
+#include "scheduler.h"
+#include "check.h"
+#include <cstdio>
+
+static uint32_t fakeMs = 0;
+static uint32_t fakeUs = 0;
+static uint32_t clockMs() { return fakeMs; }
+static uint32_t clockUs() { return fakeUs; }
+
+static void advance(uint32_t ms) {
+  fakeMs += ms;
+  fakeUs += ms * 1000;
+}
+
+static int periodicRuns = 0;
+static int oneShotRuns = 0;
+static Scheduler *active = nullptr;
+static int selfTuneTask = SCHED_INVALID_TASK;
+
+static void periodicFn() { periodicRuns++; }
+static void oneShotFn() { oneShotRuns++; }
+static void slowFn() { fakeUs += 750; }
+static void selfTuneFn() { active->setPeriod(selfTuneTask, 100); }
+
+static void testPeriodic() {
+  fakeMs = 0;
+  periodicRuns = 0;
+  Scheduler sched(clockMs, clockUs);
+  int id = sched.addPeriodic("p", periodicFn, 50);
+  CHECK(id == 0);
+  CHECK(sched.runDue(1000) == 50);
+  CHECK(periodicRuns == 0);
+  advance(50);
+  CHECK(sched.runDue(1000) == 50);
+  CHECK(periodicRuns == 1);
+  // A long stall skips missed periods instead of bursting
+  advance(500);
+  sched.runDue(1000);
+  CHECK(periodicRuns == 2);
+  CHECK(sched.task(id).stats.maxLateMs == 450);
+  CHECK(sched.msUntilNext(1000) == 50);
+}
+
+static void testOneShot() {
+  fakeMs = 1000;
+  oneShotRuns = 0;
+  Scheduler sched(clockMs, clockUs);
+  int id = sched.addOneShot("o", oneShotFn);
+  CHECK(!sched.isArmed(id));
+  CHECK(sched.runDue(1000) == 1000);
+  sched.runIn(id, 300);
+  advance(299);
+  CHECK(sched.runDue(1000) == 1);
+  advance(1);
+  sched.runDue(1000);
+  CHECK(oneShotRuns == 1);
+  CHECK(!sched.isArmed(id));
+  advance(1000);
+  sched.runDue(1000);
+  CHECK(oneShotRuns == 1);
+  // Re-arming pushes the deadline out
+  sched.runIn(id, 100);
+  advance(50);
+  sched.runIn(id, 100);
+  advance(60);
+  sched.runDue(1000);
+  CHECK(oneShotRuns == 1);
+  sched.cancel(id);
+  advance(100);
+  sched.runDue(1000);
+  CHECK(oneShotRuns == 1);
+}
+
+static void testDisarmedPeriodic() {
+  fakeMs = 0;
+  periodicRuns = 0;
+  Scheduler sched(clockMs, clockUs);
+  int id = sched.addPeriodic("p", periodicFn, 10, false);
+  advance(100);
+  CHECK(sched.runDue(1000) == 1000);
+  CHECK(periodicRuns == 0);
+  sched.runIn(id, 0);
+  CHECK(sched.msUntilNext(1000) == 0);
+  sched.runDue(1000);
+  CHECK(periodicRuns == 1);
+}
+
+static void testMillisRollover() {
+  fakeMs = 0xFFFFFFF0u;
+  periodicRuns = 0;
+  Scheduler sched(clockMs, clockUs);
+  sched.addPeriodic("p", periodicFn, 32);
+  advance(16);
+  CHECK(sched.runDue(1000) == 16);
+  CHECK(periodicRuns == 0);
+  advance(16);
+  sched.runDue(1000);
+  CHECK(periodicRuns == 1);
+}
+
+static void testSetPeriodFromTask() {
+  fakeMs = 0;
+  Scheduler sched(clockMs, clockUs);
+  active = &sched;
+  selfTuneTask = sched.addPeriodic("tune", selfTuneFn, 500);
+  advance(500);
+  CHECK(sched.runDue(1000) == 100);
+  active = nullptr;
+}
+
+static void testRuntimeStats() {
+  fakeMs = 0;
+  fakeUs = 0;
+  Scheduler sched(clockMs, clockUs);
+  int id = sched.addPeriodic("slow", slowFn, 10);
+  for (int i = 0; i < 4; i++) {
+    advance(10);
+    sched.runDue(1000);
+  }
+  CHECK(sched.task(id).stats.runs == 4);
+  CHECK(sched.task(id).stats.totalUs == 3000);
+  CHECK(sched.task(id).stats.maxUs == 750);
+  sched.resetStats();
+  CHECK(sched.task(id).stats.runs == 0);
+}
+
+static void testCapacity() {
+  Scheduler sched(clockMs, clockUs);
+  for (int i = 0; i < SCHED_MAX_TASKS; i++) {
+    CHECK(sched.addOneShot("o", oneShotFn) == i);
+  }
+  CHECK(sched.addOneShot("o", oneShotFn) == SCHED_INVALID_TASK);
+  // Invalid ids are ignored
+  sched.runIn(SCHED_INVALID_TASK, 0);
+  sched.cancel(SCHED_MAX_TASKS);
+  CHECK(!sched.isArmed(SCHED_INVALID_TASK));
+}
+
+int main() {
+  testPeriodic();
+  testOneShot();
+  testDisarmedPeriodic();
+  testMillisRollover();
+  testSetPeriodFromTask();
+  testRuntimeStats();
+  testCapacity();
+
+  if (failures) {
+    printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("scheduler tests passed\n");
+  return 0;
+}
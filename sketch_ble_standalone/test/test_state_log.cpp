@@ -0,0 +1,213 @@
+/*
+ * Host tests for state_log.h: sequencing, coalesced deltas, the snapshot
+ * fallback, checksums, and an app-side replica that follows the deltas.
+ */
+
+#include "state_log.h"
+#include "check.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+typedef StateLog<64, 32> Log;
+
+static SyncedState newGame(int playerCount) {
+  SyncedState s;
+  memset(&s, 0, sizeof(s));
+  s.playerCount = (uint8_t)playerCount;
+  const uint32_t colors[] = {0xFF0000, 0x00FF00, 0x0000FF, 0xFFFF00};
+  for (int i = 0; i < STATE_MAX_PLAYERS; i++) {
+    s.colors[i] = colors[i];
+    s.tiles[i] = 1;
+    s.scores[i] = 10;
+    s.alive[i] = true;
+  }
+  return s;
+}
+
+static bool sameState(const SyncedState &a, const SyncedState &b) {
+  for (int i = 0; i < STATE_FIELD_COUNT; i++) {
+    uint8_t field = stateFieldAt(i);
+    if (getStateField(a, field) != getStateField(b, field)) return false;
+  }
+  return true;
+}
+
+static void testFields() {
+  bool seen[256] = {};
+  for (int i = 0; i < STATE_FIELD_COUNT; i++) {
+    uint8_t field = stateFieldAt(i);
+    CHECK(!seen[field]);
+    seen[field] = true;
+  }
+  SyncedState s = newGame(4);
+  CHECK(setStateField(s, stateField(SF_SCORE, 2), -3) && s.scores[2] == -3);
+  CHECK(setStateField(s, stateField(SF_COLOR, 1), 0x7FABCDEF) && s.colors[1] == 0xABCDEF);
+  CHECK(!setStateField(s, stateField(SF_PLAYER_COUNT, 1), 2));  // Not a field
+  CHECK(!setStateField(s, 0x7F, 1));
+}
+
+static void testCommitAndDelta() {
+  Log log;
+  CHECK(log.seq() == 0);
+  SyncedState s = newGame(2);
+  CHECK(log.commit(s));
+  CHECK(log.seq() == 1);
+  CHECK(!log.commit(s));  // No change, no seq
+  CHECK(log.seq() == 1);
+  log.ack(1);
+
+  s.tiles[0] = 5;
+  s.scores[0] = 8;
+  CHECK(log.commit(s) && log.seq() == 2);
+  s.tiles[0] = 9;
+  CHECK(log.commit(s) && log.seq() == 3);
+
+  StateChange out[STATE_FIELD_COUNT];
+  int n = log.deltaSince(log.ackedSeq(), out, STATE_FIELD_COUNT);
+  CHECK(n == 2);  // Tile coalesced to its latest value
+  bool tile = false, score = false;
+  for (int i = 0; i < n; i++) {
+    if (out[i].field == stateField(SF_TILE, 0)) tile = out[i].value == 9;
+    if (out[i].field == stateField(SF_SCORE, 0)) score = out[i].value == 8;
+  }
+  CHECK(tile && score);
+
+  CHECK(log.deltaSince(3, out, STATE_FIELD_COUNT) == 0);
+  CHECK(log.deltaSince(2, out, STATE_FIELD_COUNT) == 1);
+  CHECK(log.deltaSince(4, out, STATE_FIELD_COUNT) == -1);  // Future base
+  CHECK(log.deltaSince(1, out, 1) == -1);                  // Too many fields
+}
+
+static void testAck() {
+  Log log;
+  SyncedState s = newGame(2);
+  for (int i = 0; i < 5; i++) {
+    s.tiles[1] = (uint8_t)(i + 2);
+    log.commit(s);
+  }
+  log.ack(3);
+  CHECK(log.ackedSeq() == 3);
+  log.ack(2);  // Backwards
+  CHECK(log.ackedSeq() == 3);
+  log.ack(99);  // Future
+  CHECK(log.ackedSeq() == 3);
+  log.resetAck();
+  CHECK(log.ackedSeq() == 0);
+}
+
+static void testOverflowFallsBackToSnapshot() {
+  Log log;
+  SyncedState s = newGame(4);
+  log.commit(s);
+  uint32_t base = log.seq();
+  // 64 entries: enough single-field commits to push base out of the log
+  for (int i = 0; i < 70; i++) {
+    s.scores[i % 4] = (int16_t)(s.scores[i % 4] + 1);
+    log.commit(s);
+  }
+  StateChange out[STATE_FIELD_COUNT];
+  CHECK(log.oldestBase() > base);
+  CHECK(log.deltaSince(base, out, STATE_FIELD_COUNT) == -1);
+  CHECK(log.deltaSince(log.oldestBase(), out, STATE_FIELD_COUNT) >= 0);
+  CHECK(log.deltaSince(log.seq() - 1, out, STATE_FIELD_COUNT) == 1);
+}
+
+static void testChecksum() {
+  SyncedState a = newGame(3);
+  SyncedState b = newGame(3);
+  CHECK(stateChecksum(a) == stateChecksum(b));
+  b.scores[2] = 11;
+  CHECK(stateChecksum(a) != stateChecksum(b));
+  b = a;
+  b.tiles[3] = 20;  // Inactive player does not count
+  CHECK(stateChecksum(a) == stateChecksum(b));
+  b = a;
+  b.playerCount = 2;
+  CHECK(stateChecksum(a) != stateChecksum(b));
+
+  Log log;
+  log.commit(a);
+  uint32_t seqA = log.seq(), sum = 0;
+  log.commit(b);
+  CHECK(log.checksumAt(seqA, sum) && sum == stateChecksum(a));
+  CHECK(log.checksumAt(log.seq(), sum) && sum == stateChecksum(b));
+  CHECK(!log.checksumAt(log.seq() + 1, sum));
+  CHECK(log.checksum() == stateChecksum(log.state()));
+}
+
+// App side: apply what the board sends and check it arrives at the same
+// state and checksum; randomized game-like changes with occasional lost acks
+static void testReplica() {
+  Log log;
+  SyncedState board = newGame(4);
+  SyncedState app;
+  memset(&app, 0, sizeof(app));
+  uint32_t appSeq = 0;
+  int deltas = 0, snapshots = 0;
+  srand(1234);
+
+  for (int step = 0; step < 5000; step++) {
+    int p = rand() % 4;
+    switch (rand() % 4) {
+      case 0: board.tiles[p] = (uint8_t)(1 + rand() % 20); break;
+      case 1: board.scores[p] = (int16_t)(rand() % 40 - 5); break;
+      case 2: board.alive[p] = board.scores[p] > 0; break;
+      case 3: if (rand() % 50 == 0) board.playerCount = (uint8_t)(2 + rand() % 3); break;
+    }
+    if (!log.commit(board)) continue;
+
+    StateChange out[12];
+    int n = log.deltaSince(log.ackedSeq(), out, 12);
+    if (n < 0) {
+      app = log.state();
+      snapshots++;
+    } else {
+      for (int i = 0; i < n; i++) CHECK(setStateField(app, out[i].field, out[i].value));
+      deltas++;
+    }
+    appSeq = log.seq();
+    CHECK(stateChecksum(app) == log.checksum());
+    CHECK(sameState(app, log.state()));
+    if (rand() % 8 != 0) log.ack(appSeq);  // Some acks are lost
+  }
+  CHECK(deltas > snapshots);
+  printf("replica: %d deltas, %d snapshots\n", deltas, snapshots);
+}
+
+// Reconnect: an app that kept (seq, checksum) is recognised and needs only
+// what changed since; one with a stale checksum is not
+static void testResyncDecision() {
+  Log log;
+  SyncedState s = newGame(2);
+  log.commit(s);
+  s.tiles[0] = 7;
+  log.commit(s);
+  uint32_t appSeq = log.seq(), appSum = log.checksum();
+
+  s.scores[1] = 12;
+  log.commit(s);
+
+  uint32_t expected = 0;
+  CHECK(log.checksumAt(appSeq, expected) && expected == appSum);
+  StateChange out[STATE_FIELD_COUNT];
+  CHECK(log.deltaSince(appSeq, out, STATE_FIELD_COUNT) == 1);
+  CHECK(!(log.checksumAt(appSeq, expected) && expected == appSum + 1));
+}
+
+int main() {
+  testFields();
+  testCommitAndDelta();
+  testAck();
+  testOverflowFallsBackToSnapshot();
+  testChecksum();
+  testReplica();
+  testResyncDecision();
+
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("state log tests passed\n");
+  return 0;
+}
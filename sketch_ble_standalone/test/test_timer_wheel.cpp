@@ -0,0 +1,224 @@
+/*
+ * Host tests for timer_wheel.h on a fake millis() clock.
+ */
+
+#include "timer_wheel.h"
+#include "check.h"
+#include <cstdio>
+#include <random>
+#include <vector>
+
+static uint32_t fakeMs = 0;
+static uint32_t clockMs() { return fakeMs; }
+
+static int firedA = 0;
+static int firedB = 0;
+static uint32_t firedAtA = 0;
+static void onA() { firedA++; firedAtA = fakeMs; }
+static void onB() { firedB++; }
+
+// Advance in `step` ms increments until `untilMs` or the first fire
+static void runUntil(TimerWheel &wheel, uint32_t untilMs, uint32_t step = 1) {
+  while ((int32_t)(untilMs - fakeMs) > 0) {
+    fakeMs += step;
+    wheel.advance();
+  }
+}
+
+static void testFiresOnTimeAcrossLevels() {
+  const uint32_t delays[] = {0, 1, 9, 10, 11, 630, 640, 650, 5000, 40960, 41000, 300000, 2621440};
+  for (uint32_t delay : delays) {
+    fakeMs = 12345;
+    firedA = 0;
+    TimerWheel wheel(clockMs);
+    WheelTimer a("a", onA);
+    wheel.arm(a, delay);
+    uint32_t armedAt = fakeMs;
+    wheel.advance();
+    while (firedA == 0 && fakeMs - armedAt < delay + 1000) {
+      fakeMs += 1;
+      wheel.advance();
+    }
+    CHECK(firedA == 1);
+    // Never early, at most one tick late
+    CHECK(firedAtA - armedAt >= delay);
+    CHECK(firedAtA - armedAt <= delay + TIMER_WHEEL_TICK_MS);
+    CHECK(!wheel.isPending(a));
+    CHECK(wheel.pending() == 0);
+  }
+}
+
+static void testCancelAndRearm() {
+  fakeMs = 0;
+  firedA = firedB = 0;
+  TimerWheel wheel(clockMs);
+  WheelTimer a("a", onA);
+  WheelTimer b("b", onB);
+  wheel.arm(a, 100);
+  wheel.arm(b, 100);
+  wheel.cancel(b);
+  CHECK(!wheel.isPending(b));
+  runUntil(wheel, 50);
+  wheel.arm(a, 100);  // Pushes the deadline out to 150
+  runUntil(wheel, 140);
+  CHECK(firedA == 0);
+  runUntil(wheel, 200);
+  CHECK(firedA == 1);
+  CHECK(firedAtA >= 150 && firedAtA <= 160);
+  CHECK(firedB == 0);
+  // Cancelling an idle timer is harmless
+  wheel.cancel(a);
+  wheel.cancel(a);
+  CHECK(wheel.pending() == 0);
+}
+
+static TimerWheel *periodicWheel = nullptr;
+static WheelTimer *periodicTimer = nullptr;
+static int periodicRuns = 0;
+static void onPeriodic() {
+  periodicRuns++;
+  periodicWheel->arm(*periodicTimer, 500);
+}
+
+static void testRearmFromCallback() {
+  fakeMs = 0;
+  periodicRuns = 0;
+  TimerWheel wheel(clockMs);
+  WheelTimer p("p", onPeriodic);
+  periodicWheel = &wheel;
+  periodicTimer = &p;
+  wheel.arm(p, 500);
+  runUntil(wheel, 5005);
+  CHECK(periodicRuns == 10);
+  CHECK(wheel.isPending(p));
+}
+
+static void testMillisRollover() {
+  fakeMs = 0xFFFFFF00u;
+  firedA = 0;
+  TimerWheel wheel(clockMs);
+  WheelTimer a("a", onA);
+  uint32_t armedAt = fakeMs;
+  wheel.arm(a, 30000);
+  runUntil(wheel, armedAt + 29999);
+  CHECK(firedA == 0);
+  runUntil(wheel, armedAt + 30010);
+  CHECK(firedA == 1);
+}
+
+static void testLongStall() {
+  fakeMs = 0;
+  firedA = firedB = 0;
+  TimerWheel wheel(clockMs);
+  WheelTimer a("a", onA);
+  WheelTimer b("b", onB);
+  wheel.arm(a, 1000);
+  wheel.arm(b, 700000);
+  // Loop blocked for 10 minutes, then catches up in one advance()
+  fakeMs += 600000;
+  CHECK(wheel.advance() == 1);
+  CHECK(firedA == 1 && firedB == 0);
+  runUntil(wheel, 700000, 7);
+  CHECK(firedB == 1);
+}
+
+static void testBeyondWheelRange() {
+  fakeMs = 0;
+  firedA = 0;
+  TimerWheel wheel(clockMs);
+  WheelTimer a("a", onA);
+  const uint32_t fiftyHours = 50UL * 3600 * 1000;
+  wheel.arm(a, fiftyHours);
+  runUntil(wheel, fiftyHours - 1000, 1000);
+  CHECK(firedA == 0);
+  runUntil(wheel, fiftyHours + 20);
+  CHECK(firedA == 1);
+  CHECK(firedAtA >= fiftyHours && firedAtA <= fiftyHours + TIMER_WHEEL_TICK_MS);
+}
+
+static void testNextExpiryHint() {
+  fakeMs = 1000;
+  TimerWheel wheel(clockMs);
+  WheelTimer a("a", onA);
+  CHECK(wheel.msUntilNext(777) == 777);
+  wheel.arm(a, 250);
+  uint32_t hint = wheel.msUntilNext(1000);
+  CHECK(hint <= 250 && hint >= 240);
+  wheel.arm(a, 60000);
+  CHECK(wheel.msUntilNext(1000) == 1000);
+  // Hint never overshoots the real deadline
+  firedA = 0;
+  while (firedA == 0) {
+    uint32_t sleep = wheel.msUntilNext(5000);
+    fakeMs += sleep > 0 ? sleep : 1;
+    wheel.advance();
+  }
+  CHECK(firedAtA - 1000 >= 60000 && firedAtA - 1000 <= 60000 + TIMER_WHEEL_TICK_MS);
+}
+
+// Many timers, random delays/cancels/steps: each fires once, on time
+static std::vector<uint32_t> fuzzFiredAt;
+static const int FUZZ_TIMERS = 64;
+static void (*fuzzFns[FUZZ_TIMERS])();
+template <int N> static void fuzzFn() { fuzzFiredAt[N] = fakeMs; }
+template <int N> struct FuzzInit {
+  static void run() { fuzzFns[N] = fuzzFn<N>; FuzzInit<N + 1>::run(); }
+};
+template <> struct FuzzInit<FUZZ_TIMERS> {
+  static void run() {}
+};
+
+static void testRandomized() {
+  FuzzInit<0>::run();
+  std::mt19937 rng(2024);
+  fakeMs = 0xFFF00000u;
+  TimerWheel wheel(clockMs);
+  std::vector<WheelTimer *> timers;
+  std::vector<uint32_t> dueAt(FUZZ_TIMERS);
+  std::vector<bool> cancelled(FUZZ_TIMERS);
+  fuzzFiredAt.assign(FUZZ_TIMERS, 0);
+  for (int i = 0; i < FUZZ_TIMERS; i++) {
+    timers.push_back(new WheelTimer("fuzz", fuzzFns[i]));
+    uint32_t delay = rng() % 900000;
+    wheel.arm(*timers[i], delay);
+    dueAt[i] = fakeMs + delay;
+    cancelled[i] = (rng() % 5) == 0;
+    if (cancelled[i]) wheel.cancel(*timers[i]);
+    fakeMs += rng() % 50;
+    wheel.advance();
+  }
+  uint32_t end = fakeMs + 1000000;
+  while ((int32_t)(end - fakeMs) > 0) {
+    uint32_t step = 1 + rng() % 40;
+    fakeMs += step;
+    wheel.advance();
+  }
+  for (int i = 0; i < FUZZ_TIMERS; i++) {
+    if (cancelled[i]) {
+      CHECK(fuzzFiredAt[i] == 0);
+    } else {
+      int32_t late = (int32_t)(fuzzFiredAt[i] - dueAt[i]);
+      CHECK(late >= 0 && late <= TIMER_WHEEL_TICK_MS + 40);
+    }
+    delete timers[i];
+  }
+  CHECK(wheel.pending() == 0);
+}
+
+int main() {
+  testFiresOnTimeAcrossLevels();
+  testCancelAndRearm();
+  testRearmFromCallback();
+  testMillisRollover();
+  testLongStall();
+  testBeyondWheelRange();
+  testNextExpiryHint();
+  testRandomized();
+
+  if (failures) {
+    printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("timer wheel tests passed\n");
+  return 0;
+}
@@ -0,0 +1,136 @@
+/*
+ * Host tests for tx_arena.h: the send path (serialize into the arena,
+ * fragment into its fragment buffer) makes no heap allocation, and the
+ * counters catch overflow, collisions and allocations that do happen.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// Counts every C++ allocation in this process, like the board's counter
+static unsigned newCalls = 0;
+
+void *operator new(size_t size) {
+  newCalls++;
+  void *p = malloc(size);
+  if (p == nullptr) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+#define TX_HEAP_ALLOCS() newCalls
+#include "tx_arena.h"
+#include "ble_framing.h"
+#include "check.h"
+
+typedef TxArena<512, 64> Arena;
+
+static Arena arena;
+static Reassembler<512> receiver;
+
+// What sendBLEJson() + notifyApp() do, with snprintf standing in for
+// serializeJson and the receiver for the app
+static bool sendRoll(Arena &tx, int playerId, int from, int to, int score, uint32_t mtu) {
+  char *buf = tx.begin();
+  if (buf == nullptr) return false;
+  int len = snprintf(buf, tx.capacity(),
+                     "{\"event\":\"roll_processed\",\"playerId\":%d,\"from\":%d,\"to\":%d,"
+                     "\"score\":%d,\"alive\":true,\"waitingForCoin\":true}",
+                     playerId, from, to, score);
+  bool sent = false;
+  if (len > 0 && tx.fits((uint32_t)len)) {
+    uint32_t payload = notifyPayloadSize((uint16_t)mtu);
+    if (payload > tx.fragmentCapacity()) payload = tx.fragmentCapacity();
+    FragmentWriter writer;
+    uint32_t fragmentLen = 0;
+    if (writer.begin((const uint8_t *)buf, (uint32_t)len, payload, 0)) {
+      while (writer.next(tx.fragment(), fragmentLen)) {
+        CHECK(fragmentLen <= payload);
+        sent = receiver.feed(tx.fragment(), fragmentLen) == REASM_COMPLETE;
+      }
+    }
+  }
+  tx.end();
+  return sent;
+}
+
+static void testNoAllocations() {
+  unsigned before = newCalls;
+  for (int i = 0; i < 1000; i++) {
+    CHECK(sendRoll(arena, i % 4, i % 20 + 1, (i + 3) % 20 + 1, i % 30, i % 2 ? 23 : 67));
+  }
+  CHECK(newCalls == before);
+  CHECK(arena.heapAllocs() == 0);
+  CHECK(arena.messagesWithAllocs() == 0);
+  CHECK(arena.messages() == 1000);
+  CHECK(arena.highWater() > 0 && arena.highWater() < arena.capacity());
+  CHECK(arena.overflows() == 0);
+
+  // Last message arrived intact
+  const char *expected = "\"playerId\":3";
+  CHECK(receiver.length() > 0);
+  CHECK(memmem(receiver.message(), receiver.length(), expected, strlen(expected)) != nullptr);
+}
+
+static void testAllocationIsCounted() {
+  Arena tx;
+  char *buf = tx.begin();
+  CHECK(buf != nullptr);
+  int *leak = new int(7);  // Stands in for a String in the send path
+  CHECK(tx.fits((uint32_t)snprintf(buf, tx.capacity(), "{\"n\":%d}", *leak)));
+  tx.end();
+  delete leak;
+  CHECK(tx.heapAllocs() == 1);
+  CHECK(tx.messagesWithAllocs() == 1);
+}
+
+static void testOverflow() {
+  Arena tx;
+  char *buf = tx.begin();
+  memset(buf, 'x', tx.capacity() - 1);
+  buf[tx.capacity() - 1] = '\0';
+  CHECK(!tx.fits(tx.capacity() - 1));  // Serializer filled the buffer: truncated
+  tx.end();
+  CHECK(tx.overflows() == 1);
+  CHECK(tx.messages() == 0);
+
+  buf = tx.begin();
+  CHECK(!tx.fits(0));  // Nothing written
+  tx.end();
+  CHECK(tx.overflows() == 2);
+
+  buf = tx.begin();
+  CHECK(tx.fits(tx.capacity() - 2));  // Largest that fits with its NUL
+  tx.end();
+  CHECK(tx.messages() == 1);
+}
+
+static void testCollision() {
+  Arena tx;
+  CHECK(tx.begin() != nullptr);
+  CHECK(tx.begin() == nullptr);  // Still open
+  CHECK(tx.collisions() == 1);
+  tx.end();
+  CHECK(tx.begin() != nullptr);
+  tx.end();
+  tx.end();  // Harmless
+  CHECK(tx.collisions() == 1);
+}
+
+int main() {
+  testNoAllocations();
+  testAllocationIsCounted();
+  testOverflow();
+  testCollision();
+
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("tx arena tests passed\n");
+  return 0;
+}
@@ -0,0 +1,231 @@
+/*
+ * Host tests for wire_protocol.h: round trips, frame sizes of the hot
+ * events, and malformed input.
+ */
+
+#include "wire_protocol.h"
+#include "command_table.h"
+#include "check.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+// Default ATT MTU (23) minus the 3-byte notification header
+static const uint32_t DEFAULT_NOTIFY_PAYLOAD = 20;
+
+// A roll event as sendRollResponse() encodes it (no chance card)
+static uint32_t encodeRoll(uint8_t *buf, uint32_t cap, int playerId, int from, int to,
+                           int oldScore, int newScore) {
+  WireWriter frame(buf, cap);
+  frame.begin(WIRE_EVT_ROLL_PROCESSED);
+  frame.putInt(WIRE_TAG_PLAYER_ID, playerId);
+  frame.putInt(WIRE_TAG_FROM, from);
+  frame.putInt(WIRE_TAG_TO, to);
+  frame.putInt(WIRE_TAG_TILE_TYPE, 4);
+  frame.putInt(WIRE_TAG_SCORE_OLD, oldScore);
+  frame.putInt(WIRE_TAG_SCORE_NEW, newScore);
+  frame.putInt(WIRE_TAG_SCORE_CHANGE, newScore - oldScore);
+  frame.putBool(WIRE_TAG_ALIVE, newScore > 0);
+  frame.putBool(WIRE_TAG_WAIT_COIN, true);
+  return frame.ok() ? frame.size() : 0;
+}
+
+static void testRoundTrip() {
+  uint8_t buf[128];
+  WireWriter frame(buf, sizeof(buf));
+  frame.begin(WIRE_EVT_COIN_PLACED);
+  frame.putInt(WIRE_TAG_PLAYER_ID, 3);
+  frame.putInt(WIRE_TAG_SCORE, -7);
+  frame.putInt(WIRE_TAG_UNEXPECTED_MASK, 0xFFFFF);
+  frame.putInt(WIRE_TAG_SCORE_CHANGE, INT32_MIN);
+  frame.putInt(WIRE_TAG_SCORE_NEW, INT32_MAX);
+  frame.putString(WIRE_TAG_CHANCE_DESC, "Rain harvest");
+  const uint8_t raw[] = {0, 2, 0xFF};
+  frame.putBytes(WIRE_TAG_MISSING_PLAYERS, raw, sizeof(raw));
+  CHECK(frame.ok());
+  CHECK(buf[0] == (WIRE_MAGIC | WIRE_VERSION));
+  CHECK(buf[0] != '{');
+
+  WireReader reader(buf, frame.size());
+  CHECK(reader.valid());
+  CHECK(reader.version() == WIRE_VERSION);
+  CHECK(reader.type() == WIRE_EVT_COIN_PLACED);
+
+  WireField f;
+  CHECK(reader.next(f) && f.tag == WIRE_TAG_PLAYER_ID && f.kind == WIRE_KIND_INT && f.value == 3);
+  CHECK(reader.next(f) && f.tag == WIRE_TAG_SCORE && f.value == -7);
+  CHECK(reader.next(f) && f.tag == WIRE_TAG_UNEXPECTED_MASK && f.value == 0xFFFFF);
+  CHECK(reader.next(f) && f.tag == WIRE_TAG_SCORE_CHANGE && f.value == INT32_MIN);
+  CHECK(reader.next(f) && f.tag == WIRE_TAG_SCORE_NEW && f.value == INT32_MAX);
+  CHECK(reader.next(f) && f.tag == WIRE_TAG_CHANCE_DESC && f.kind == WIRE_KIND_BYTES);
+  CHECK(f.str() != nullptr && strcmp(f.str(), "Rain harvest") == 0);
+  CHECK((const uint8_t *)f.str() > buf && (const uint8_t *)f.str() < buf + frame.size());  // Zero-copy
+  CHECK(reader.next(f) && f.tag == WIRE_TAG_MISSING_PLAYERS && f.len == 3);
+  CHECK(memcmp(f.bytes, raw, 3) == 0);
+  CHECK(f.str() == nullptr);  // Not NUL-terminated
+  CHECK(!reader.next(f));
+  CHECK(!reader.error());
+
+  int32_t value = 0;
+  CHECK(reader.findInt(WIRE_TAG_SCORE, value) && value == -7);
+  CHECK(!reader.findInt(WIRE_TAG_DICE_VALUE, value));
+}
+
+static void testEventSizes() {
+  uint8_t buf[128];
+  // Typical mid-game roll fits one default-MTU notification
+  uint32_t size = encodeRoll(buf, sizeof(buf), 2, 14, 18, 9, 6);
+  CHECK(size > 0 && size <= DEFAULT_NOTIFY_PAYLOAD);
+  // Worst case for scores a game can reach still fits
+  size = encodeRoll(buf, sizeof(buf), 3, 20, 1, 60, 63);
+  CHECK(size > 0 && size <= DEFAULT_NOTIFY_PAYLOAD);
+
+  WireWriter hb(buf, sizeof(buf));
+  hb.begin(WIRE_EVT_HEARTBEAT);
+  hb.putInt(WIRE_TAG_PLAYER_ID, 1);
+  hb.putInt(WIRE_TAG_TILE, 17);
+  hb.putInt(WIRE_TAG_ELAPSED_S, 12);
+  hb.putInt(WIRE_TAG_REMAINING_S, 18);
+  CHECK(hb.ok() && hb.size() <= DEFAULT_NOTIFY_PAYLOAD);
+
+  WireWriter scan(buf, sizeof(buf));
+  const uint8_t players[] = {0, 1, 2, 3};
+  scan.begin(WIRE_EVT_MISPLACEMENT_SCAN);
+  scan.putInt(WIRE_TAG_UNEXPECTED_MASK, 0x80001);
+  scan.putInt(WIRE_TAG_MISSING_MASK, 0x01E00);
+  scan.putBytes(WIRE_TAG_MISSING_PLAYERS, players, sizeof(players));
+  CHECK(scan.ok() && scan.size() <= DEFAULT_NOTIFY_PAYLOAD);
+
+  // Decode cost, for reference
+  size = encodeRoll(buf, sizeof(buf), 2, 14, 18, 9, 6);
+  const int runs = 100000;
+  int32_t sum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++) {
+    WireReader reader(buf, size);
+    WireField f;
+    while (reader.next(f)) sum += f.value;
+  }
+  auto end = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(end - start).count() / runs;
+  CHECK(sum != 0);
+  printf("roll_processed: %u bytes, decoded in %.0f ns\n", size, ns);
+}
+
+static void testCommandFrame() {
+  // App side: roll command in binary; type byte is the CommandId
+  uint8_t buf[32];
+  WireWriter cmd(buf, sizeof(buf));
+  cmd.begin(CMD_ROLL);
+  cmd.putInt(WIRE_TAG_PLAYER_ID, 1);
+  cmd.putInt(WIRE_TAG_DICE_VALUE, 6);
+  CHECK(cmd.ok() && cmd.size() == 6);
+  CHECK(isWireFrame(buf, cmd.size()));
+
+  WireReader reader(buf, cmd.size());
+  CHECK(reader.valid() && reader.type() == CMD_ROLL);
+  int32_t dice = 0;
+  CHECK(reader.findInt(WIRE_TAG_DICE_VALUE, dice) && dice == 6);
+
+  const char *json = "{\"command\":\"roll\"}";
+  CHECK(!isWireFrame((const uint8_t *)json, (uint32_t)strlen(json)));
+}
+
+static void testUnknownTagsSkipped() {
+  // A newer peer may add fields; older decoders step over them
+  uint8_t buf[64];
+  WireWriter frame(buf, sizeof(buf));
+  frame.begin(WIRE_EVT_COIN_TIMEOUT);
+  frame.putInt(60, 123456);
+  frame.putString(61, "future");
+  frame.putInt(WIRE_TAG_TILE, 9);
+  CHECK(frame.ok());
+
+  WireReader reader(buf, frame.size());
+  WireField f;
+  int tile = -1;
+  while (reader.next(f)) {
+    if (f.tag == WIRE_TAG_TILE) tile = f.value;
+  }
+  CHECK(tile == 9);
+  CHECK(!reader.error());
+}
+
+static void testOverflow() {
+  uint8_t buf[8];
+  WireWriter frame(buf, sizeof(buf));
+  frame.begin(WIRE_EVT_ROLL_PROCESSED);
+  frame.putInt(WIRE_TAG_PLAYER_ID, 1);
+  CHECK(frame.ok());
+  frame.putString(WIRE_TAG_CHANCE_DESC, "much too long for this");
+  CHECK(!frame.ok());
+  frame.putInt(WIRE_TAG_TILE, 1);
+  CHECK(!frame.ok());  // Sticky
+  CHECK(frame.size() <= sizeof(buf));
+}
+
+static void testMalformed() {
+  WireField f;
+
+  // Wrong magic / unsupported version
+  const uint8_t json[] = {'{', '}'};
+  CHECK(!WireReader(json, sizeof(json)).valid());
+  const uint8_t future[] = {WIRE_MAGIC | 0x0F, 1};
+  CHECK(!WireReader(future, sizeof(future)).valid());
+  const uint8_t zero[] = {WIRE_MAGIC, 1};
+  CHECK(!WireReader(zero, sizeof(zero)).valid());
+  const uint8_t tooShort[] = {WIRE_MAGIC | WIRE_VERSION};
+  CHECK(!WireReader(tooShort, sizeof(tooShort)).valid());
+
+  // Truncated varint value
+  const uint8_t truncated[] = {WIRE_MAGIC | WIRE_VERSION, 1, WIRE_TAG_TILE << 1, 0x80};
+  WireReader r1(truncated, sizeof(truncated));
+  CHECK(!r1.next(f) && r1.error());
+
+  // Key with no value
+  const uint8_t noValue[] = {WIRE_MAGIC | WIRE_VERSION, 1, WIRE_TAG_TILE << 1};
+  WireReader r2(noValue, sizeof(noValue));
+  CHECK(!r2.next(f) && r2.error());
+
+  // Bytes length past the end of the frame
+  const uint8_t overrun[] = {WIRE_MAGIC | WIRE_VERSION, 1, (WIRE_TAG_PASSWORD << 1) | 1, 10, 'a', 'b'};
+  WireReader r3(overrun, sizeof(overrun));
+  CHECK(!r3.next(f) && r3.error());
+
+  // Over-long varint (6 bytes)
+  const uint8_t longVarint[] = {WIRE_MAGIC | WIRE_VERSION, 1, WIRE_TAG_TILE << 1,
+                                0x80, 0x80, 0x80, 0x80, 0x80, 0x01};
+  WireReader r4(longVarint, sizeof(longVarint));
+  CHECK(!r4.next(f) && r4.error());
+
+  // Tag above WIRE_TAG_MAX (two-byte key)
+  const uint8_t bigTag[] = {WIRE_MAGIC | WIRE_VERSION, 1, 0x80, 0x01, 0x02};
+  WireReader r5(bigTag, sizeof(bigTag));
+  CHECK(!r5.next(f) && r5.error());
+
+  // Every truncation of a valid frame fails cleanly or stops at a field edge
+  uint8_t buf[64];
+  uint32_t size = encodeRoll(buf, sizeof(buf), 2, 14, 18, 9, 6);
+  for (uint32_t cut = 2; cut < size; cut++) {
+    WireReader reader(buf, cut);
+    int fields = 0;
+    while (reader.next(f)) fields++;
+    CHECK(fields <= 9);
+  }
+}
+
+int main() {
+  testRoundTrip();
+  testEventSizes();
+  testCommandFrame();
+  testUnknownTagsSkipped();
+  testOverflow();
+  testMalformed();
+
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("wire protocol tests passed\n");
+  return 0;
+}
@@ -0,0 +1,303 @@
+/*
+ * Last Drop - Hierarchical Timer Wheel
+ *
+ * Game and connection timeouts (coin timeout, turn delay, pairing, idle dim,
+ * heartbeat, chance card dismiss, GoDice reconnect) are WheelTimers instead of
+ * separate millis() globals polled every pass of loop(). Arming and
+ * cancelling is O(1); loop() calls advance() to fire whatever has expired, so
+ * an armed timer costs nothing until its slot comes round.
+ *
+ * Layout: 4 levels x 64 slots of TIMER_WHEEL_TICK_MS ticks (level 0 covers
+ * 64 ticks, level 3 reaches 2^24 ticks = ~46 h at 10 ms). Timers further out
+ * park in the last level and are re-filed as the wheel turns. An occupancy
+ * bitmap per level gives msUntilNext() without walking the slots.
+ *
+ * All tick / millis() arithmetic is unsigned-wrap safe. Timers never fire
+ * early; they fire up to one tick late.
+ *
+ * Define TIMER_WHEEL_LOCK() / TIMER_WHEEL_UNLOCK() before including this
+ * header if timers are armed from another task (e.g. BLE callbacks).
+ * Callbacks always run from advance(), outside the lock.
+ */
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <stdint.h>
+
+#ifndef TIMER_WHEEL_TICK_MS
+#define TIMER_WHEEL_TICK_MS 10
+#endif
+
+#ifndef TIMER_WHEEL_LOCK
+#define TIMER_WHEEL_LOCK()
+#define TIMER_WHEEL_UNLOCK()
+#endif
+
+#define TIMER_WHEEL_LEVELS 4
+#define TIMER_WHEEL_SLOT_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_SLOT_BITS)
+#define TIMER_WHEEL_SLOT_MASK (TIMER_WHEEL_SLOTS - 1)
+
+typedef void (*WheelTimerFn)();
+typedef uint32_t (*WheelClockFn)();
+
+// Circular doubly-linked list node; each slot holds a sentinel
+struct WheelTimerLink {
+  WheelTimerLink *prev;
+  WheelTimerLink *next;
+};
+
+struct WheelTimer : WheelTimerLink {
+  const char *name;
+  WheelTimerFn fn;
+  uint32_t expires;      // Tick at which the timer fires
+  bool pending;
+
+  WheelTimer(const char *name, WheelTimerFn fn)
+    : name(name), fn(fn), expires(0), pending(false) {
+    prev = next = this;
+  }
+};
+
+class TimerWheel {
+public:
+  explicit TimerWheel(WheelClockFn clockMs)
+    : clockMs(clockMs), baseTick(0), baseMs(0), started(false), pendingCount(0) {
+    for (int l = 0; l < TIMER_WHEEL_LEVELS; l++) {
+      occupied[l] = 0;
+      for (int s = 0; s < TIMER_WHEEL_SLOTS; s++) {
+        listInit(slots[l][s]);
+      }
+    }
+  }
+
+  // (Re)arm a timer to fire delayMs from now
+  void arm(WheelTimer &t, uint32_t delayMs) {
+    uint32_t now = clockMs();
+    TIMER_WHEEL_LOCK();
+    start(now);
+    if (t.pending) {
+      unlink(t);
+    } else {
+      pendingCount++;
+    }
+    int32_t rel = (int32_t)(now + delayMs - baseMs);
+    t.expires = baseTick;
+    if (rel > 0) {
+      t.expires += ((uint32_t)rel + TIMER_WHEEL_TICK_MS - 1) / TIMER_WHEEL_TICK_MS;
+    }
+    t.pending = true;
+    insert(t);
+    TIMER_WHEEL_UNLOCK();
+  }
+
+  void cancel(WheelTimer &t) {
+    TIMER_WHEEL_LOCK();
+    if (t.pending) {
+      unlink(t);
+      t.pending = false;
+      pendingCount--;
+    }
+    TIMER_WHEEL_UNLOCK();
+  }
+
+  bool isPending(const WheelTimer &t) const { return t.pending; }
+  uint32_t pending() const { return pendingCount; }
+
+  // Fire every timer whose tick has started. Returns the number fired.
+  int advance() {
+    uint32_t now = clockMs();
+    int fired = 0;
+
+    TIMER_WHEEL_LOCK();
+    start(now);
+    TIMER_WHEEL_UNLOCK();
+
+    while ((int32_t)(now - baseMs) >= 0) {
+      WheelTimerLink expired;
+      listInit(expired);
+
+      TIMER_WHEEL_LOCK();
+      if (pendingCount == 0) {
+        // Nothing armed: jump straight to the current tick
+        uint32_t ticks = (now - baseMs) / TIMER_WHEEL_TICK_MS + 1;
+        baseTick += ticks;
+        baseMs += ticks * TIMER_WHEEL_TICK_MS;
+        TIMER_WHEEL_UNLOCK();
+        break;
+      }
+      uint32_t index = baseTick & TIMER_WHEEL_SLOT_MASK;
+      if (index == 0) {
+        cascade(1);
+      }
+      if (occupied[0] & (1ULL << index)) {
+        listSplice(slots[0][index], expired);
+        occupied[0] &= ~(1ULL << index);
+      }
+      baseTick++;
+      baseMs += TIMER_WHEEL_TICK_MS;
+      TIMER_WHEEL_UNLOCK();
+
+      fired += fire(expired);
+    }
+    return fired;
+  }
+
+  // Milliseconds until the next timer could fire (0 if overdue),
+  // capped at maxMs. May be early for far timers, never late.
+  uint32_t msUntilNext(uint32_t maxMs) {
+    uint32_t now = clockMs();
+    TIMER_WHEEL_LOCK();
+    if (!started || pendingCount == 0) {
+      TIMER_WHEEL_UNLOCK();
+      return maxMs;
+    }
+
+    uint32_t ticks = UINT32_MAX;
+    if (occupied[0]) {
+      ticks = slotsAhead(occupied[0], baseTick & TIMER_WHEEL_SLOT_MASK);
+    }
+    for (int l = 1; l < TIMER_WHEEL_LEVELS; l++) {
+      if (!occupied[l]) continue;
+      int shift = l * TIMER_WHEEL_SLOT_BITS;
+      uint32_t index = (baseTick >> shift) & TIMER_WHEEL_SLOT_MASK;
+      // Slots at this level are cascaded when entered, so the current one
+      // is next reached after a full revolution
+      uint32_t ahead = slotsAhead(occupied[l], (index + 1) & TIMER_WHEEL_SLOT_MASK) + 1;
+      uint32_t cascadeTick = ((baseTick >> shift) + ahead) << shift;
+      uint32_t untilCascade = cascadeTick - baseTick;
+      if (untilCascade < ticks) ticks = untilCascade;
+    }
+    uint32_t due = baseMs + ticks * TIMER_WHEEL_TICK_MS;
+    TIMER_WHEEL_UNLOCK();
+
+    if (ticks >= UINT32_MAX / TIMER_WHEEL_TICK_MS) return maxMs;
+    int32_t wait = (int32_t)(due - now);
+    if (wait <= 0) return 0;
+    return (uint32_t)wait < maxMs ? (uint32_t)wait : maxMs;
+  }
+
+private:
+  WheelClockFn clockMs;
+  WheelTimerLink slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+  uint64_t occupied[TIMER_WHEEL_LEVELS];
+  uint32_t baseTick;     // Next tick to process
+  uint32_t baseMs;       // millis() at which baseTick starts
+  bool started;
+  uint32_t pendingCount;
+
+  void start(uint32_t now) {
+    if (!started) {
+      baseMs = now;
+      started = true;
+    }
+  }
+
+  static void listInit(WheelTimerLink &head) {
+    head.prev = head.next = &head;
+  }
+
+  static void listSplice(WheelTimerLink &from, WheelTimerLink &to) {
+    if (from.next == &from) return;
+    to.next = from.next;
+    to.prev = from.prev;
+    to.next->prev = &to;
+    to.prev->next = &to;
+    listInit(from);
+  }
+
+  // Distance (0-63) from slot `from` to the first occupied slot, wrapping
+  static uint32_t slotsAhead(uint64_t bits, uint32_t from) {
+    uint64_t rotated = from ? (bits >> from) | (bits << (TIMER_WHEEL_SLOTS - from)) : bits;
+    return (uint32_t)__builtin_ctzll(rotated);
+  }
+
+  void insert(WheelTimer &t) {
+    uint32_t delta = t.expires - baseTick;
+    uint32_t expires = t.expires;
+    int level = 0;
+    while (level < TIMER_WHEEL_LEVELS - 1 &&
+           delta >= (1UL << ((level + 1) * TIMER_WHEEL_SLOT_BITS))) {
+      level++;
+    }
+    const uint32_t maxDelta = (1UL << (TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOT_BITS)) - 1;
+    if (delta > maxDelta) {
+      expires = baseTick + maxDelta;  // Park in the last level, re-filed on cascade
+    }
+    uint32_t index = (expires >> (level * TIMER_WHEEL_SLOT_BITS)) & TIMER_WHEEL_SLOT_MASK;
+    WheelTimerLink &head = slots[level][index];
+    t.prev = head.prev;
+    t.next = &head;
+    head.prev->next = &t;
+    head.prev = &t;
+    occupied[level] |= 1ULL << index;
+  }
+
+  void unlink(WheelTimer &t) {
+    WheelTimerLink *next = t.next;
+    t.prev->next = t.next;
+    next->prev = t.prev;
+    t.prev = t.next = &t;
+    // A sentinel pointing at itself means the slot is now empty
+    if (next->next == next) {
+      clearOccupied(next);
+    }
+  }
+
+  void clearOccupied(WheelTimerLink *head) {
+    for (int l = 0; l < TIMER_WHEEL_LEVELS; l++) {
+      if (head >= &slots[l][0] && head < &slots[l][0] + TIMER_WHEEL_SLOTS) {
+        occupied[l] &= ~(1ULL << (head - &slots[l][0]));
+        return;
+      }
+    }
+  }
+
+  // Re-file the slot of `level` that baseTick has just entered
+  void cascade(int level) {
+    if (level >= TIMER_WHEEL_LEVELS) return;
+    int shift = level * TIMER_WHEEL_SLOT_BITS;
+    uint32_t index = (baseTick >> shift) & TIMER_WHEEL_SLOT_MASK;
+    if (index == 0) {
+      cascade(level + 1);
+    }
+    if (!(occupied[level] & (1ULL << index))) return;
+
+    WheelTimerLink moving;
+    listInit(moving);
+    listSplice(slots[level][index], moving);
+    occupied[level] &= ~(1ULL << index);
+    while (moving.next != &moving) {
+      WheelTimer *t = static_cast<WheelTimer *>(moving.next);
+      moving.next = t->next;
+      t->next->prev = &moving;
+      insert(*t);
+    }
+  }
+
+  int fire(WheelTimerLink &expired) {
+    int fired = 0;
+    for (;;) {
+      TIMER_WHEEL_LOCK();
+      if (expired.next == &expired) {
+        TIMER_WHEEL_UNLOCK();
+        break;
+      }
+      WheelTimer *t = static_cast<WheelTimer *>(expired.next);
+      t->prev->next = t->next;
+      t->next->prev = t->prev;
+      t->prev = t->next = t;
+      t->pending = false;
+      pendingCount--;
+      WheelTimerFn fn = t->fn;
+      TIMER_WHEEL_UNLOCK();
+
+      fn();
+      fired++;
+    }
+    return fired;
+  }
+};
+
+#endif // TIMER_WHEEL_H
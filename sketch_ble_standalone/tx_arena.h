@@ -0,0 +1,97 @@
+/*
+ * Last Drop - Transmit Arena
+ *
+ * The preallocated buffers behind everything the board sends the app: a
+ * message buffer that responses are serialized straight into, and a
+ * fragment buffer for the notification payload handed to the BLE stack
+ * (see ble_framing.h). Both live for the life of the program, so sending an
+ * event needs no String, no std::string and no heap.
+ *
+ * One message is open at a time. The arena belongs to the game task, which
+ * builds and sends each message before starting the next; a begin() while
+ * one is open is counted as a collision and refused.
+ *
+ * TX_HEAP_ALLOCS() should return a running count of heap allocations made
+ * by the sending task. The arena adds up how far it moved between begin()
+ * and end(), so heapAllocs() staying at 0 shows the send path is
+ * allocation-free. Define it before including this header; the default
+ * disables the check.
+ */
+
+#ifndef TX_ARENA_H
+#define TX_ARENA_H
+
+#include <stdint.h>
+
+#ifndef TX_HEAP_ALLOCS
+#define TX_HEAP_ALLOCS() 0u
+#endif
+
+template <uint32_t MESSAGE_SIZE, uint32_t FRAGMENT_SIZE>
+class TxArena {
+public:
+  TxArena() : open(false), allocsAtBegin(0), messageCount(0), byteCount(0), high(0),
+              overflowCount(0), collisionCount(0), allocCount(0), allocMessageCount(0) {}
+
+  // Buffer for the next message, or nullptr if one is already open
+  char *begin() {
+    if (open) {
+      collisionCount++;
+      return nullptr;
+    }
+    open = true;
+    allocsAtBegin = (uint32_t)TX_HEAP_ALLOCS();
+    return (char *)message;
+  }
+
+  // A serializer wrote len bytes plus a NUL. False if it filled the buffer,
+  // i.e. the message was cut short and must not be sent.
+  bool fits(uint32_t len) {
+    if (len == 0 || len + 1 >= MESSAGE_SIZE) {
+      overflowCount++;
+      return false;
+    }
+    messageCount++;
+    byteCount += len;
+    if (len > high) high = len;
+    return true;
+  }
+
+  // Message sent (or dropped); the buffer is free again
+  void end() {
+    if (!open) return;
+    uint32_t allocs = (uint32_t)TX_HEAP_ALLOCS() - allocsAtBegin;
+    if (allocs > 0) {
+      allocCount += allocs;
+      allocMessageCount++;
+    }
+    open = false;
+  }
+
+  uint8_t *fragment() { return fragmentBuf; }
+  static uint32_t capacity() { return MESSAGE_SIZE; }
+  static uint32_t fragmentCapacity() { return FRAGMENT_SIZE; }
+
+  uint32_t messages() const { return messageCount; }
+  uint32_t bytes() const { return byteCount; }
+  uint32_t highWater() const { return high; }
+  uint32_t overflows() const { return overflowCount; }
+  uint32_t collisions() const { return collisionCount; }
+  uint32_t heapAllocs() const { return allocCount; }
+  uint32_t messagesWithAllocs() const { return allocMessageCount; }
+
+private:
+  uint8_t message[MESSAGE_SIZE];
+  uint8_t fragmentBuf[FRAGMENT_SIZE];
+  bool open;
+  uint32_t allocsAtBegin;
+  uint32_t messageCount;
+  uint32_t byteCount;
+  uint32_t high;
+  uint32_t overflowCount;
+  uint32_t collisionCount;
+  uint32_t allocCount;
+  uint32_t allocMessageCount;
+};
+
+#endif // TX_ARENA_H
@@ -0,0 +1,267 @@
+/*
+ * Last Drop - Binary Wire Protocol
+ *
+ * Compact alternative to the JSON messages on the app link, used only after
+ * the app opts in at pairing (see below). Frames are self-describing by
+ * their first byte: JSON always starts with '{', binary frames with
+ * WIRE_MAGIC | version, so both can share the characteristic and an app
+ * that negotiated binary still handles the events that remain JSON.
+ *
+ * Frame:  [0xB0 | version] [type] field*
+ * Field:  varint key = (tag << 1) | kind, then
+ *           kind 0 (WIRE_KIND_INT):   zigzag varint value
+ *           kind 1 (WIRE_KIND_BYTES): varint length, then that many bytes
+ *
+ * Strings are BYTES fields that include their NUL terminator so a decoder
+ * can hand out pointers into the frame without copying. Decoders skip tags
+ * they do not know, and a field may repeat (list items, in order).
+ *
+ * Board -> app frames carry a WireEventType, app -> board frames a
+ * CommandId (command_table.h). Field tags are one shared WireTag space; the
+ * fields each message uses are listed with its type below.
+ *
+ * Handshake: the board advertises WIRE_VERSION as "wire" in its ready and
+ * pair responses. An app that sends "wire": n with its pair command (or
+ * pairs with a binary frame) gets events in version min(n, WIRE_VERSION)
+ * until it disconnects; the pair response echoes the agreed version.
+ *
+ * The host build of this header is the reference encoder / decoder.
+ */
+
+#ifndef WIRE_PROTOCOL_H
+#define WIRE_PROTOCOL_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define WIRE_MAGIC 0xB0
+#define WIRE_MAGIC_MASK 0xF0
+#define WIRE_VERSION 1
+
+enum WireKind : uint8_t {
+  WIRE_KIND_INT = 0,
+  WIRE_KIND_BYTES = 1
+};
+
+enum WireEventType : uint8_t {
+  WIRE_EVT_ROLL_PROCESSED = 1,  // PLAYER_ID FROM TO TILE_TYPE SCORE_OLD SCORE_NEW SCORE_CHANGE
+                                // ALIVE WAIT_COIN [CHANCE_CARD CHANCE_DESC]
+  WIRE_EVT_UNDO_COMPLETE,       // PLAYER_ID FROM TO SCORE ALIVE
+  WIRE_EVT_COIN_PLACED,         // PLAYER_ID TILE VERIFIED SCORE ALIVE
+  WIRE_EVT_COIN_TIMEOUT,        // PLAYER_ID TILE TIMEOUT_S
+  WIRE_EVT_HEARTBEAT,           // PLAYER_ID TILE ELAPSED_S REMAINING_S
+  WIRE_EVT_MISPLACEMENT_SCAN,   // UNEXPECTED_MASK MISSING_MASK MISSING_PLAYERS
+  WIRE_EVT_STATE_DELTA          // SEQ BASE_SEQ CHECKSUM (STATE_FIELD STATE_VALUE)*
+};
+
+enum WireTag : uint8_t {
+  WIRE_TAG_PLAYER_ID = 1,
+  WIRE_TAG_FROM,
+  WIRE_TAG_TO,
+  WIRE_TAG_TILE_TYPE,        // TileType value
+  WIRE_TAG_SCORE_OLD,
+  WIRE_TAG_SCORE_NEW,
+  WIRE_TAG_SCORE_CHANGE,
+  WIRE_TAG_ALIVE,            // Repeats per player in sync_state
+  WIRE_TAG_WAIT_COIN,
+  WIRE_TAG_CHANCE_CARD,
+  WIRE_TAG_CHANCE_DESC,      // String
+  WIRE_TAG_TILE,
+  WIRE_TAG_VERIFIED,
+  WIRE_TAG_SCORE,            // Repeats per player in sync_state
+  WIRE_TAG_ELAPSED_S,
+  WIRE_TAG_REMAINING_S,
+  WIRE_TAG_TIMEOUT_S,
+  WIRE_TAG_UNEXPECTED_MASK,  // Bit (tile - 1) set per tile
+  WIRE_TAG_MISSING_MASK,
+  WIRE_TAG_MISSING_PLAYERS,  // Bytes: expected player per missing tile, ascending tile
+  WIRE_TAG_DICE_VALUE,
+  WIRE_TAG_PASSWORD,         // String
+  WIRE_TAG_WIRE_VERSION,
+  WIRE_TAG_WINNER_ID,
+  WIRE_TAG_WINNER_COLOR,     // String "RRGGBB"
+  WIRE_TAG_WINNER_NAME,      // String
+  WIRE_TAG_RESET,
+  WIRE_TAG_PLAYER_COUNT,
+  WIRE_TAG_COLOR,            // 0xRRGGBB, repeats per player
+  WIRE_TAG_POSITION,         // Repeats per player
+  WIRE_TAG_HALL_MODE,
+  WIRE_TAG_TURN_DELAY_S,
+  WIRE_TAG_BUDGET_US,
+  WIRE_TAG_GAME_ACTIVE,
+  WIRE_TAG_NICKNAME,         // String
+  WIRE_TAG_SEQ,
+  WIRE_TAG_BASE_SEQ,
+  WIRE_TAG_CHECKSUM,         // uint32 sent as int32
+  WIRE_TAG_STATE_FIELD,      // state_log.h field id, followed by its STATE_VALUE
+  WIRE_TAG_STATE_VALUE,
+  WIRE_TAG_REQUEST_ID,       // Any command, echoed on its responses; uint32 sent as int32
+  WIRE_TAG_MAX = 63          // Keeps every key in one byte
+};
+
+inline bool isWireFrame(const uint8_t *data, uint32_t len) {
+  return len >= 2 && (data[0] & WIRE_MAGIC_MASK) == WIRE_MAGIC;
+}
+
+inline uint32_t wireZigzag(int32_t v) {
+  return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+inline int32_t wireUnzigzag(uint32_t v) {
+  return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+// Encodes one frame into a caller buffer. Overflow is sticky: ok() turns
+// false and nothing more is written, so callers check once at the end.
+class WireWriter {
+public:
+  WireWriter(uint8_t *buf, uint32_t capacity)
+    : buf(buf), capacity(capacity), length(0), overflow(false) {}
+
+  void begin(uint8_t type, uint8_t version = WIRE_VERSION) {
+    length = 0;
+    overflow = false;
+    putByte(WIRE_MAGIC | (version & 0x0F));
+    putByte(type);
+  }
+
+  void putInt(uint8_t tag, int32_t value) {
+    putVarint(((uint32_t)tag << 1) | WIRE_KIND_INT);
+    putVarint(wireZigzag(value));
+  }
+
+  void putBool(uint8_t tag, bool value) { putInt(tag, value ? 1 : 0); }
+
+  void putBytes(uint8_t tag, const uint8_t *data, uint32_t len) {
+    putVarint(((uint32_t)tag << 1) | WIRE_KIND_BYTES);
+    putVarint(len);
+    if (overflow || length + len > capacity) {
+      overflow = true;
+      return;
+    }
+    memcpy(buf + length, data, len);
+    length += len;
+  }
+
+  // Written with its NUL so the decoder can point into the frame
+  void putString(uint8_t tag, const char *s) {
+    if (s == nullptr) return;
+    putBytes(tag, (const uint8_t *)s, (uint32_t)strlen(s) + 1);
+  }
+
+  const uint8_t *data() const { return buf; }
+  uint32_t size() const { return length; }
+  bool ok() const { return !overflow; }
+
+private:
+  uint8_t *buf;
+  uint32_t capacity;
+  uint32_t length;
+  bool overflow;
+
+  void putByte(uint8_t b) {
+    if (overflow || length >= capacity) {
+      overflow = true;
+      return;
+    }
+    buf[length++] = b;
+  }
+
+  void putVarint(uint32_t v) {
+    while (v >= 0x80) {
+      putByte((uint8_t)(v | 0x80));
+      v >>= 7;
+    }
+    putByte((uint8_t)v);
+  }
+};
+
+struct WireField {
+  uint8_t tag;
+  uint8_t kind;
+  int32_t value;         // WIRE_KIND_INT
+  const uint8_t *bytes;  // WIRE_KIND_BYTES, points into the frame
+  uint32_t len;
+
+  // NUL-terminated string field, or nullptr if this is not one
+  const char *str() const {
+    if (kind != WIRE_KIND_BYTES || len == 0 || bytes[len - 1] != '\0') return nullptr;
+    return (const char *)bytes;
+  }
+};
+
+// Walks the fields of one frame without copying. next() returns false at
+// the end of the frame or on malformed input (then error() is true).
+class WireReader {
+public:
+  WireReader(const uint8_t *data, uint32_t len) : data(data), len(len), pos(2), bad(false) {}
+
+  // Binary frame of a version this side understands
+  bool valid() const {
+    return isWireFrame(data, len) && version() >= 1 && version() <= WIRE_VERSION;
+  }
+
+  uint8_t version() const { return len > 0 ? data[0] & 0x0F : 0; }
+  uint8_t type() const { return len > 1 ? data[1] : 0; }
+  bool error() const { return bad; }
+
+  bool next(WireField &field) {
+    if (bad || pos >= len) return false;
+    uint32_t key;
+    if (!readVarint(key) || (key >> 1) > WIRE_TAG_MAX) return fail();
+    field.tag = (uint8_t)(key >> 1);
+    field.kind = (uint8_t)(key & 1);
+    field.value = 0;
+    field.bytes = nullptr;
+    field.len = 0;
+    uint32_t v;
+    if (!readVarint(v)) return fail();
+    if (field.kind == WIRE_KIND_INT) {
+      field.value = wireUnzigzag(v);
+    } else {
+      if (v > len - pos) return fail();
+      field.bytes = data + pos;
+      field.len = v;
+      pos += v;
+    }
+    return true;
+  }
+
+  // First INT field with this tag, scanning the whole frame
+  bool findInt(uint8_t tag, int32_t &value) const {
+    WireReader scan(data, len);
+    WireField field;
+    while (scan.next(field)) {
+      if (field.tag == tag && field.kind == WIRE_KIND_INT) {
+        value = field.value;
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  const uint8_t *data;
+  uint32_t len;
+  uint32_t pos;
+  bool bad;
+
+  bool fail() {
+    bad = true;
+    return false;
+  }
+
+  // At most 5 bytes; a longer or truncated varint is malformed
+  bool readVarint(uint32_t &v) {
+    v = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+      if (pos >= len) return false;
+      uint8_t b = data[pos++];
+      v |= (uint32_t)(b & 0x7F) << shift;
+      if (!(b & 0x80)) return true;
+    }
+    return false;
+  }
+};
+
+#endif // WIRE_PROTOCOL_H
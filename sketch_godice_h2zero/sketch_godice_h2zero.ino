@@ -11,6 +11,7 @@
  */
 
 #include <NimBLEDevice.h>
+#include <GoDice.h>
 
 // GoDice UUIDs
 #define GODICE_SERVICE_UUID        "6e400001-b5a3-f393-e0a9-e50e24dcca9e"  // Nordic UART
@@ -42,52 +43,47 @@ bool deviceConnected = false;
 const int SCAN_TIME = 30;        // seconds
 const int CONNECT_TIMEOUT = 30;  // seconds
 
+// Shared GoDice decoder (libraries/GoDice): whole messages are decoded in
+// place, however the link packs or splits them
+GoDiceDecoder<1> diceDecoder;
+
+void onDiceEvent(const GoDiceEvent& event) {
+    switch (event.type) {
+        case GODICE_EVENT_ROLL:
+            Serial.println("🎲 Dice rolling...");
+            break;
+        case GODICE_EVENT_STABLE:
+            if (event.stable.type == GODICE_STABLE) {
+                Serial.printf("✅ DICE STABLE: %d\n", event.value);
+            } else {  // Only FS / MS / TS are ranked
+                Serial.printf("✅ DICE STABLE: %d (%c, margin %ld)\n",
+                    event.value, event.key, (long)event.stable.margin);
+            }
+            break;
+        case GODICE_EVENT_CHARGE_LEVEL:
+            Serial.printf("🔋 Battery: %d%%\n", event.value);
+            break;
+        case GODICE_EVENT_CHARGING:
+            Serial.printf("🔌 Charging: %s\n", event.value ? "yes" : "no");
+            break;
+        case GODICE_EVENT_COLOR:
+            Serial.printf("🎨 Color code: %d\n", event.value);
+            break;
+        default:  // Taps
+            break;
+    }
+}
+
 // Callback to receive dice data
 void notifyCallback(NimBLERemoteCharacteristic* pChar, uint8_t* pData, size_t length, bool isNotify) {
-    Serial.print("📥 Dice data received (");
-    Serial.print(length);
-    Serial.print(" bytes): ");
-    
-    // Print hex
-    for (size_t i = 0; i < length; i++) {
-        if (pData[i] < 0x10) Serial.print("0");
-        Serial.print(pData[i], HEX);
-        Serial.print(" ");
-    }
-    Serial.println();
-    
-    // Parse GoDice protocol
-    if (length >= 2) {
-        uint8_t msgType = pData[0];
-        switch (msgType) {
-            case 0x52: // 'R' - Roll result
-                if (length >= 2) {
-                    int diceValue = pData[1];
-                    Serial.printf("🎲 DICE ROLLED: %d\n", diceValue);
-                }
-                break;
-            case 0x53: // 'S' - Stable
-                if (length >= 2) {
-                    int diceValue = pData[1];
-                    Serial.printf("✅ DICE STABLE: %d\n", diceValue);
-                }
-                break;
-            case 0x42: // 'B' - Battery
-                if (length >= 2) {
-                    int battery = pData[1];
-                    Serial.printf("🔋 Battery: %d%%\n", battery);
-                }
-                break;
-            default:
-                Serial.printf("Unknown message type: 0x%02X\n", msgType);
-        }
-    }
+    diceDecoder.decode(0, pData, length, millis(), onDiceEvent);
 }
 
 // Client callbacks
 class ClientCallbacks : public NimBLEClientCallbacks {
     void onConnect(NimBLEClient* pClient) override {
         Serial.println("✅ Client connected callback");
+        diceDecoder.reset(0);
         deviceConnected = true;
     }
     
@@ -17,6 +17,7 @@
 #include <BLEDevice.h>
 #include <BLEScan.h>
 #include <BLEAdvertisedDevice.h>
+#include <GoDice.h>
 
 // GoDice UUIDs (Nordic UART Service)
 #define GODICE_SERVICE_UUID        "6e400001-b5a3-f393-e0a9-e50e24dcca9e"
@@ -29,17 +30,6 @@
 #define CMD_SET_LED     0x08  // Set LED color (3 bytes RGB follow)
 #define CMD_PULSE_LED   0x10  // Pulse LED
 
-// GoDice Protocol Messages (received)
-#define MSG_ROLLING     0x52  // 'R' - Dice is rolling
-#define MSG_STABLE      0x53  // 'S' - Dice is stable (includes value)
-#define MSG_FAKE_STABLE 0x46  // 'F' - Fake stable
-#define MSG_TILT_STABLE 0x54  // 'T' - Tilt stable
-#define MSG_MOVE_STABLE 0x4D  // 'M' - Move stable
-#define MSG_BATTERY     0x42  // 'B' - Battery response
-#define MSG_COLOR       0x43  // 'C' - Color response
-#define MSG_TAP         0x31  // Single tap
-#define MSG_DOUBLE_TAP  0x32  // Double tap
-
 // Dice color codes (from dice shell)
 enum DiceColor {
     DICE_COLOR_BLACK = 0,
@@ -51,20 +41,6 @@ enum DiceColor {
     DICE_COLOR_UNKNOWN = 255
 };
 
-// GoDice XYZ vectors for D6 face detection
-// These are the accelerometer readings when each face is UP (visible)
-// Values are approximately ±64 on the dominant axis
-// Mapping calibrated from actual GoDice Orange dice readings
-const int8_t D6_VECTORS[6][3] = {
-    // {  X,   Y,   Z }  // Face UP
-    { -64,  0,   0 },    // Face 1 UP (X negative)
-    {  0,   0,  64 },    // Face 2 UP (Z positive)
-    {  0,  64,   0 },    // Face 3 UP (Y positive)
-    {  0, -64,   0 },    // Face 4 UP (Y negative)
-    {  0,   0, -64 },    // Face 5 UP (Z negative)
-    {  64,  0,   0 }     // Face 6 UP (X positive)
-};
-
 // ==================== Global State ====================
 BLEScan* pScan = nullptr;
 BLEClient* pClient = nullptr;
@@ -89,6 +65,10 @@ unsigned long lastRollTime = 0;
 unsigned long lastStableTime = 0;
 unsigned long rollCount = 0;
 
+// Shared GoDice decoder (libraries/GoDice): frames and decodes notifications
+// in place with the GoDice SDK
+GoDiceDecoder<1> diceDecoder;
+
 // ==================== Helper Functions ====================
 
 const char* getColorName(DiceColor color) {
@@ -103,27 +83,6 @@ const char* getColorName(DiceColor color) {
     }
 }
 
-// Convert accelerometer XYZ to dice face (1-6)
-// D6_VECTORS contains the accelerometer reading when each face is UP
-int xyzToDiceFace(int8_t x, int8_t y, int8_t z) {
-    int bestFace = 1;
-    int bestDistance = 999999;
-    
-    for (int face = 0; face < 6; face++) {
-        int dx = x - D6_VECTORS[face][0];
-        int dy = y - D6_VECTORS[face][1];
-        int dz = z - D6_VECTORS[face][2];
-        int distance = dx*dx + dy*dy + dz*dz;
-        
-        if (distance < bestDistance) {
-            bestDistance = distance;
-            bestFace = face + 1;  // Faces are 1-6
-        }
-    }
-    
-    return bestFace;
-}
-
 // Send command to dice
 void sendCommand(uint8_t cmd) {
     if (pTxChar && connected) {
@@ -181,110 +140,60 @@ void printStatus() {
 
 // ==================== Notification Callback ====================
 
-static void notifyCallback(BLERemoteCharacteristic* pChar, uint8_t* pData, size_t length, bool isNotify) {
-    if (length < 1) return;
-    
-    uint8_t msgType = pData[0];
-    
-    // Debug: Print raw data
-    Serial.print("📥 [");
-    for (size_t i = 0; i < length; i++) {
-        if (pData[i] < 0x10) Serial.print("0");
-        Serial.print(pData[i], HEX);
-        if (i < length - 1) Serial.print(" ");
-    }
-    Serial.print("] ");
-    
-    switch (msgType) {
-        case MSG_ROLLING:
+static void onDiceEvent(const GoDiceEvent& event) {
+    switch (event.type) {
+        case GODICE_EVENT_ROLL:
             isRolling = true;
             lastRollTime = millis();
             Serial.println("🎲 ROLLING...");
             break;
             
-        case MSG_STABLE:  // 0x53 'S' - format: [S][x][y][z]
-            if (length >= 4) {
-                isRolling = false;
-                lastStableTime = millis();
-                rollCount++;
-                
-                // Extract XYZ accelerometer data (signed bytes)
-                int8_t x = (int8_t)pData[1];
-                int8_t y = (int8_t)pData[2];
-                int8_t z = (int8_t)pData[3];
-                
-                // Convert to dice face (returns face facing UP)
-                lastDiceValue = xyzToDiceFace(x, y, z);
-                
-                Serial.printf("✅ STABLE: %d (xyz: %d,%d,%d)\n", lastDiceValue, x, y, z);
-            }
+        case GODICE_EVENT_STABLE:  // S, or FS / TS / MS
+            isRolling = false;
+            lastStableTime = millis();
+            rollCount++;
+            lastDiceValue = event.value;
+            Serial.printf("✅ STABLE: %d (%c, xyz: %d,%d,%d)\n", lastDiceValue, event.key,
+                event.stable.x, event.stable.y, event.stable.z);
             break;
             
-        case MSG_FAKE_STABLE:   // 0x46 'F' - format: [F][S][x][y][z]
-        case MSG_TILT_STABLE:   // 0x54 'T' - format: [T][S][x][y][z]
-        case MSG_MOVE_STABLE:   // 0x4D 'M' - format: [M][S][x][y][z]
-            if (length >= 5) {
-                isRolling = false;
-                lastStableTime = millis();
-                rollCount++;
-                
-                // XYZ starts at offset 2 (after type + 'S')
-                int8_t x = (int8_t)pData[2];
-                int8_t y = (int8_t)pData[3];
-                int8_t z = (int8_t)pData[4];
-                
-                lastDiceValue = xyzToDiceFace(x, y, z);
-                
-                Serial.printf("✅ STABLE: %d (xyz: %d,%d,%d)\n", lastDiceValue, x, y, z);
-            }
+        case GODICE_EVENT_CHARGE_LEVEL:
+            batteryLevel = event.value;
+            Serial.printf("🔋 Battery: %d%%\n", batteryLevel);
             break;
             
-        case MSG_BATTERY:
-            // Response format: "Bat" + value OR just [0x42, value]
-            if (length >= 4 && pData[1] == 'a' && pData[2] == 't') {
-                // "Batd" format - battery is ASCII char at pos 3
-                batteryLevel = pData[3];
-                Serial.printf("🔋 Battery: %d%%\n", batteryLevel);
-            } else if (length >= 2) {
-                batteryLevel = pData[1];
-                Serial.printf("🔋 Battery: %d%%\n", batteryLevel);
-            }
+        case GODICE_EVENT_CHARGING:
+            Serial.printf("🔌 Charging: %s\n", event.value ? "yes" : "no");
             break;
             
-        case MSG_COLOR:
-            // Response format: "Col" + color_code
-            if (length >= 4 && pData[1] == 'o' && pData[2] == 'l') {
-                // "Col" prefix - color is at position 3
-                diceColor = (DiceColor)pData[3];
-                diceColorName = getColorName(diceColor);
-                Serial.printf("🎨 Dice Color: %s (code=%d)\n", diceColorName.c_str(), pData[3]);
-            } else if (length >= 2) {
-                diceColor = (DiceColor)pData[1];
-                diceColorName = getColorName(diceColor);
-                Serial.printf("🎨 Dice Color: %s (code=%d)\n", diceColorName.c_str(), pData[1]);
-            }
+        case GODICE_EVENT_COLOR:
+            diceColor = (DiceColor)event.value;
+            diceColorName = getColorName(diceColor);
+            Serial.printf("🎨 Dice Color: %s (code=%d)\n", diceColorName.c_str(), event.value);
             break;
             
-        case MSG_TAP:
+        case GODICE_EVENT_TAP:
             Serial.println("👆 Single Tap detected");
             break;
             
-        case MSG_DOUBLE_TAP:
+        case GODICE_EVENT_DOUBLE_TAP:
             Serial.println("👆👆 Double Tap detected");
             break;
-            
-        default:
-            Serial.printf("❓ Unknown message: 0x%02X\n", msgType);
-            break;
     }
 }
 
+static void notifyCallback(BLERemoteCharacteristic* pChar, uint8_t* pData, size_t length, bool isNotify) {
+    // A notification may hold several messages or part of one
+    diceDecoder.decode(0, pData, length, millis(), onDiceEvent);
+}
+
 // ==================== BLE Callbacks ====================
 
 // Client callbacks
 class MyClientCallback : public BLEClientCallbacks {
     void onConnect(BLEClient* pclient) override {
         Serial.println("✅ onConnect callback");
+        diceDecoder.reset(0);
         connected = true;
     }
 